@@ -47,6 +47,7 @@ The following flags enable optional features (disable with --no-<option name>).
   --debug-context-mm       use the debug context memory manager
   --statistics             include statistics
   --assertions             turn on assertions
+  --concurrent-nodes       allow sharing a term manager between threads
   --tracing                include tracing code
   --muzzle                 complete silence (no non-result output)
   --clang-tidy             enable clang-tidy static analysis during build
@@ -54,6 +55,7 @@ The following flags enable optional features (disable with --no-<option name>).
   --profiling              support for gprof profiling
   --unit-testing           support for unit testing
   --slow-tests             enable slow (exhaustive) unit tests
+  --benchmarks             build the micro-benchmarks (target bench)
   --python-bindings        build Python bindings based on new C++ API
   --python-only-src        create only Python bindings source files
   --java-bindings          build Java bindings based on new C++ API
@@ -132,6 +134,7 @@ buildtype=default
 
 asan=default
 assertions=default
+benchmarks=default
 auto_download=default
 cln=default
 clang_tidy=default
@@ -157,6 +160,7 @@ java_bindings=default
 editline=default
 mpfr=ON
 build_shared=ON
+concurrent_nodes=default
 safe_mode=default
 slow_tests=default
 stable_mode=default
@@ -309,6 +313,9 @@ do
     --pyvenv) pyvenv=ON;;
     --no-pyvenv) pyvenv=OFF;;
 
+    --concurrent-nodes) concurrent_nodes=ON;;
+    --no-concurrent-nodes) concurrent_nodes=OFF;;
+
     --statistics) statistics=ON;;
     --no-statistics) statistics=OFF;;
 
@@ -318,6 +325,9 @@ do
     --unit-testing) unit_testing=ON;;
     --no-unit-testing) unit_testing=OFF;;
 
+    --benchmarks) benchmarks=ON;;
+    --no-benchmarks) benchmarks=OFF;;
+
     --slow-tests) slow_tests=ON;;
     --no-slow-tests) slow_tests=OFF;;
 
@@ -480,12 +490,16 @@ fi
   && cmake_opts="$cmake_opts -DSTATIC_BINARY=$static_binary"
 [ $statistics != default ] \
   && cmake_opts="$cmake_opts -DENABLE_STATISTICS=$statistics"
+[ $concurrent_nodes != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_CONCURRENT_NODES=$concurrent_nodes"
 [ $tracing != default ] \
   && cmake_opts="$cmake_opts -DENABLE_TRACING=$tracing"
 [ $unit_testing != default ] \
   && cmake_opts="$cmake_opts -DENABLE_UNIT_TESTING=$unit_testing"
 [ $slow_tests != default ] \
   && cmake_opts="$cmake_opts -DENABLE_SLOW_TESTS=$slow_tests"
+[ $benchmarks != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_BENCHMARKS=$benchmarks"
 [ $docs != default ] \
   && cmake_opts="$cmake_opts -DBUILD_DOCS=$docs"
 [ $docs_ga != default ] \
@@ -5186,6 +5186,85 @@ CVC5_EXPORT void cvc5_block_model_values(Cvc5* cvc5,
                                          size_t size,
                                          const Cvc5Term terms[]);
 
+/**
+ * Add an objective that minimizes the given term. The objective is valid
+ * in the current assertion level. If there are objectives, `cvc5_check_sat()`
+ * returns a solution that is optimal for them, see `cvc5_get_objectives()`.
+ * Multiple objectives are combined according to option
+ * :ref:`opt-combination <lbl-option-opt-combination>`.
+ *
+ * SMT-LIB:
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. code:: smtlib
+ *
+ *     (minimize <term>)
+ * \endverbatim
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ * @param term The term to minimize, of sort Int, Real or bit-vector.
+ *             Bit-vector terms are minimized as unsigned numbers.
+ */
+CVC5_EXPORT void cvc5_minimize(Cvc5* cvc5, Cvc5Term term);
+
+/**
+ * Add an objective that maximizes the given term. The objective is valid
+ * in the current assertion level. See `cvc5_minimize()`.
+ *
+ * SMT-LIB:
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. code:: smtlib
+ *
+ *     (maximize <term>)
+ * \endverbatim
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ * @param term The term to maximize, of sort Int, Real or bit-vector.
+ *             Bit-vector terms are maximized as unsigned numbers.
+ */
+CVC5_EXPORT void cvc5_maximize(Cvc5* cvc5, Cvc5Term term);
+
+/**
+ * Get the values of the objectives in the solution of the last call to
+ * `cvc5_check_sat()`. Can be called only if immediately preceded by a SAT or
+ * UNKNOWN response to a query with objectives.
+ *
+ * The status of an objective states how its value relates to its optimum,
+ * see Cvc5OptimizationStatus. If the status is
+ * `CVC5_OPTIMIZATION_STATUS_UNKNOWN`, no solution was found and the value is
+ * NULL.
+ *
+ * SMT-LIB:
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. code:: smtlib
+ *
+ *     (get-objectives)
+ * \endverbatim
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5     The solver instance.
+ * @param size     The resulting number of objectives.
+ * @param terms    The resulting objective terms, in the order in which they
+ *                 were added.
+ * @param values   The resulting values of the objectives.
+ * @param statuses The resulting status of each objective.
+ *
+ * @note The resulting `terms`, `values` and `statuses` array pointers are only
+ *       valid until the next call to this function.
+ */
+CVC5_EXPORT void cvc5_get_objectives(Cvc5* cvc5,
+                                     size_t* size,
+                                     Cvc5Term* terms[],
+                                     Cvc5Term* values[],
+                                     Cvc5OptimizationStatus* statuses[]);
+
 /**
  * @warning This function is experimental and may change in future versions.
  *
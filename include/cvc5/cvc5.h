@@ -3758,6 +3758,12 @@ namespace cvc5 {
 
 /**
  * A cvc5 term manager.
+ *
+ * A term manager may only be used from one thread at a time, unless cvc5 was
+ * configured with `--concurrent-nodes`. In that case, the terms and sorts of
+ * a term manager may be created and shared by several threads, e.g., by
+ * solvers running on different threads that share a common set of terms.
+ * Each solver must still be used from one thread at a time.
  */
 class CVC5_EXPORT TermManager
 {
@@ -6635,6 +6641,113 @@ class CVC5_EXPORT Solver
    */
   void blockModelValues(const std::vector<Term>& terms) const;
 
+  /**
+   * Enumerate the models of the current assertions, projected onto the given
+   * terms.
+   *
+   * This repeatedly checks satisfiability and passes the model values of
+   * `terms` to `callback`, blocking each enumerated assignment of `terms`
+   * (as in blockModelValues()) before the next check. Enumeration stops when
+   * no further model exists, when `limit` models have been enumerated, or
+   * when `callback` returns false. Since the blocking constraints remain
+   * asserted, a subsequent call resumes the enumeration.
+   *
+   * With option :ref:`lazy-model-build <lbl-option-lazy-model-build>`, only
+   * the part of each model that `terms` depend on is built.
+   *
+   * Requires enabling options
+   * :ref:`produce-models <lbl-option-produce-models>` and
+   * :ref:`incremental <lbl-option-incremental>`.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param terms The terms to project the models onto.
+   * @param callback The function called with the values of `terms` in each
+   *                 model. It returns false to stop the enumeration. It must
+   *                 not assert formulas or check satisfiability.
+   * @param limit The maximum number of models to enumerate, or 0 for no limit.
+   * @return The result of the last satisfiability check, which is unsat if
+   *         all models were enumerated.
+   */
+  Result enumerateModels(
+      const std::vector<Term>& terms,
+      std::function<bool(const std::vector<Term>&)> callback,
+      uint64_t limit = 0) const;
+
+  /**
+   * Add an objective that minimizes the given term. The objective is valid
+   * in the current assertion level. If there are objectives, checkSat()
+   * returns a solution that is optimal for them, see getObjectives().
+   * Multiple objectives are combined according to option
+   * :ref:`opt-combination <lbl-option-opt-combination>`.
+   *
+   * SMT-LIB:
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * .. code:: smtlib
+   *
+   *     (minimize <term>)
+   * \endverbatim
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param term The term to minimize, of sort Int, Real or bit-vector.
+   *             Bit-vector terms are minimized as unsigned numbers.
+   */
+  void minimize(const Term& term) const;
+
+  /**
+   * Add an objective that maximizes the given term. The objective is valid
+   * in the current assertion level. See minimize().
+   *
+   * SMT-LIB:
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * .. code:: smtlib
+   *
+   *     (maximize <term>)
+   * \endverbatim
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param term The term to maximize, of sort Int, Real or bit-vector.
+   *             Bit-vector terms are maximized as unsigned numbers.
+   */
+  void maximize(const Term& term) const;
+
+  /**
+   * Get the values of the objectives in the solution of the last call to
+   * checkSat(). Can be called only if immediately preceded by a SAT or
+   * UNKNOWN response to a query with objectives.
+   *
+   * The status of an objective states how its value relates to its optimum:
+   * - OptimizationStatus::OPTIMAL: the value is the optimum.
+   * - OptimizationStatus::LIMIT_OPTIMAL: the value is the supremum (or
+   *   infimum) of a real objective, which is not reached by any solution,
+   *   e.g., 1 is the supremum of x subject to x < 1. The value of the
+   *   objective in the returned solution is then worse than this limit.
+   * - OptimizationStatus::NON_OPTIMAL: the search for the optimum was
+   *   stopped early, e.g., because the objective is unbounded, and the value
+   *   is the best value that was found.
+   * - OptimizationStatus::UNKNOWN: no solution was found, and the value is
+   *   the null term.
+   *
+   * SMT-LIB:
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * .. code:: smtlib
+   *
+   *     (get-objectives)
+   * \endverbatim
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @return The tuples of objectives, their values and their status, in the
+   *         order in which the objectives were added.
+   */
+  std::vector<std::tuple<Term, Term, OptimizationStatus>> getObjectives()
+      const;
+
   /**
    * @warning This function is experimental and may change in future versions.
    *
@@ -100,6 +100,75 @@ CVC5_EXPORT std::string to_string(cvc5::UnknownExplanation exp);
 namespace cvc5 {
 #endif
 
+/* -------------------------------------------------------------------------- */
+/* OptimizationStatus                                                         */
+/* -------------------------------------------------------------------------- */
+
+#ifdef CVC5_API_USE_C_ENUMS
+#undef EVALUE
+#define EVALUE(name) CVC5_OPTIMIZATION_STATUS_##name
+#endif
+
+/**
+ * The status of an objective of an optimization query.
+ *
+ * Specifies how the value of an objective that is returned by
+ * Solver::getObjectives relates to its optimum.
+ */
+enum ENUM(OptimizationStatus)
+{
+  /** The value is the optimum of the objective. */
+  EVALUE(OPTIMAL) = 0,
+  /**
+   * The value is the supremum (or infimum) of a real objective, which is
+   * approached by solutions but not reached by any solution.
+   */
+  EVALUE(LIMIT_OPTIMAL),
+  /**
+   * The value is the best value that was found, but the search for the
+   * optimum was stopped early, e.g., because the objective is unbounded.
+   */
+  EVALUE(NON_OPTIMAL),
+  /** No value was found, since the result of the query is unknown. */
+  EVALUE(UNKNOWN),
+#ifdef CVC5_API_USE_C_ENUMS
+  // must be last entry
+  EVALUE(LAST),
+#endif
+};
+
+#ifdef CVC5_API_USE_C_ENUMS
+#ifndef DOXYGEN_SKIP
+typedef enum ENUM(OptimizationStatus) ENUM(OptimizationStatus);
+#endif
+#endif
+
+#ifdef CVC5_API_USE_C_ENUMS
+/**
+ * Get a string representation of a Cvc5OptimizationStatus.
+ * @param status The optimization status.
+ * @return The string representation.
+ */
+CVC5_EXPORT const char* cvc5_optimization_status_to_string(
+    Cvc5OptimizationStatus status);
+#else
+/**
+ * Serialize an OptimizationStatus to given stream.
+ * @param out The output stream
+ * @param status The status to be serialized to the given output stream
+ * @return The output stream
+ */
+CVC5_EXPORT std::ostream& operator<<(std::ostream& out,
+                                     OptimizationStatus status);
+}  // namespace cvc5
+
+namespace std {
+CVC5_EXPORT std::string to_string(cvc5::OptimizationStatus status);
+}
+
+namespace cvc5 {
+#endif
+
 /* -------------------------------------------------------------------------- */
 /* RoundingMode                                                               */
 /* -------------------------------------------------------------------------- */
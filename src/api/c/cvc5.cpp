@@ -103,6 +103,20 @@ const char* cvc5_unknown_explanation_to_string(Cvc5UnknownExplanation exp)
   return str.c_str();
 }
 
+/* -------------------------------------------------------------------------- */
+/* Cvc5OptimizationStatus                                                     */
+/* -------------------------------------------------------------------------- */
+
+const char* cvc5_optimization_status_to_string(Cvc5OptimizationStatus status)
+{
+  static thread_local std::string str;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_OPTIMIZATION_STATUS(status);
+  str = std::to_string(static_cast<cvc5::OptimizationStatus>(status));
+  CVC5_CAPI_TRY_CATCH_END;
+  return str.c_str();
+}
+
 /* -------------------------------------------------------------------------- */
 /* Cvc5LearnedLitType                                                         */
 /* -------------------------------------------------------------------------- */
@@ -5551,6 +5565,56 @@ void cvc5_block_model_values(Cvc5* cvc5, size_t size, const Cvc5Term terms[])
   CVC5_CAPI_TRY_CATCH_END;
 }
 
+void cvc5_minimize(Cvc5* cvc5, Cvc5Term term)
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_TERM(term);
+  cvc5->d_solver.minimize(term->d_term);
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
+void cvc5_maximize(Cvc5* cvc5, Cvc5Term term)
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_TERM(term);
+  cvc5->d_solver.maximize(term->d_term);
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
+void cvc5_get_objectives(Cvc5* cvc5,
+                         size_t* size,
+                         Cvc5Term* terms[],
+                         Cvc5Term* values[],
+                         Cvc5OptimizationStatus* statuses[])
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_NOT_NULL(size);
+  CVC5_CAPI_CHECK_NOT_NULL(terms);
+  CVC5_CAPI_CHECK_NOT_NULL(values);
+  CVC5_CAPI_CHECK_NOT_NULL(statuses);
+  auto res = cvc5->d_solver.getObjectives();
+  static thread_local std::vector<Cvc5Term> rterms;
+  static thread_local std::vector<Cvc5Term> rvalues;
+  static thread_local std::vector<Cvc5OptimizationStatus> rstatuses;
+  rterms.clear();
+  rvalues.clear();
+  rstatuses.clear();
+  for (const auto& [t, v, status] : res)
+  {
+    rterms.push_back(cvc5->d_tm->export_term(t));
+    rvalues.push_back(v.isNull() ? nullptr : cvc5->d_tm->export_term(v));
+    rstatuses.push_back(static_cast<Cvc5OptimizationStatus>(status));
+  }
+  *size = rterms.size();
+  *terms = rterms.data();
+  *values = rvalues.data();
+  *statuses = rstatuses.data();
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
 const char* cvc5_get_instantiations(Cvc5* cvc5)
 {
   static thread_local std::string str;
@@ -129,6 +129,10 @@ CVC5_EXPORT const char* cvc5_capi_get_error_message();
   CVC5_API_CHECK((e) >= 0 && (e) < CVC5_UNKNOWN_EXPLANATION_LAST) \
       << "invalid unknown explanation kind"
 
+#define CVC5_CAPI_CHECK_OPTIMIZATION_STATUS(status)                         \
+  CVC5_API_CHECK((status) >= 0 && (status) < CVC5_OPTIMIZATION_STATUS_LAST) \
+      << "invalid optimization status"
+
 #define CVC5_CAPI_CHECK_BLOCK_MODELS_MODE(mode)                       \
   CVC5_API_CHECK((mode) >= 0 && (mode) < CVC5_BLOCK_MODELS_MODE_LAST) \
       << "invalid block models mode"
@@ -30,6 +30,7 @@
 #include <cvc5/cvc5.h>
 
 #include <cstring>
+#include <mutex>
 #include <sstream>
 
 #include "api/cpp/cvc5_checks.h"
@@ -99,6 +100,10 @@ struct APIStatistics
   internal::HistogramStat<internal::TypeConstant> d_consts;
   internal::HistogramStat<internal::TypeConstant> d_vars;
   internal::HistogramStat<Kind> d_terms;
+#ifdef CVC5_CONCURRENT_NODES
+  /** Protects the histograms when the term manager is shared by threads. */
+  std::mutex d_mutex;
+#endif
 };
 
 /* -------------------------------------------------------------------------- */
@@ -5300,6 +5305,9 @@ void TermManager::increment_term_stats(Kind kind) const
 {
   if constexpr (internal::configuration::isStatisticsBuild())
   {
+#ifdef CVC5_CONCURRENT_NODES
+    std::lock_guard<std::mutex> lock(d_stats->d_mutex);
+#endif
     d_stats->d_terms << kind;
   }
 }
@@ -5312,6 +5320,9 @@ void TermManager::increment_vars_consts_stats(const internal::TypeNode& type,
     internal::TypeConstant tc = type.getKind() == internal::Kind::TYPE_CONSTANT
                                     ? type.getConst<internal::TypeConstant>()
                                     : internal::LAST_TYPE;
+#ifdef CVC5_CONCURRENT_NODES
+    std::lock_guard<std::mutex> lock(d_stats->d_mutex);
+#endif
     if (is_var)
     {
       d_stats->d_vars << tc;
@@ -8551,6 +8562,108 @@ void Solver::blockModelValues(const std::vector<Term>& terms) const
   CVC5_API_TRY_CATCH_END;
 }
 
+Result Solver::enumerateModels(
+    const std::vector<Term>& terms,
+    std::function<bool(const std::vector<Term>&)> callback,
+    uint64_t limit) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_CHECK(d_slv->getOptions().smt.produceModels)
+      << "cannot enumerate models unless model generation is enabled "
+         "(try --"
+      << internal::options::smt::longName::produceModels << ")";
+  CVC5_API_CHECK(d_slv->getOptions().base.incrementalSolving)
+      << "cannot enumerate models unless incremental solving is enabled "
+         "(try --"
+      << internal::options::base::longName::incrementalSolving << ")";
+  CVC5_API_ARG_SIZE_CHECK_EXPECTED(!terms.empty(), terms)
+      << "a non-empty set of terms";
+  for (const Term& t : terms)
+  {
+    CVC5_API_RECOVERABLE_CHECK(
+        d_slv->getEnv().isFirstClassType(t.getSort().getTypeNode()))
+        << "cannot get value of a term that is not first class.";
+    CVC5_API_RECOVERABLE_CHECK(!t.getSort().isDatatype()
+                               || t.getSort().getDatatype().isWellFounded())
+        << "cannot get value of a term of non-well-founded datatype sort.";
+  }
+  CVC5_API_SOLVER_CHECK_TERMS(terms);
+  ensureWellFormedTerms(terms);
+  //////// all checks before this line
+  return d_slv->enumerateModels(
+      Term::termVectorToNodes(terms),
+      [&](const std::vector<internal::Node>& values) {
+        return callback(Term::nodeVectorToTerms(d_tm.d_nm, values));
+      },
+      limit);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+void Solver::minimize(const Term& term) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERM(term);
+  CVC5_API_ARG_CHECK_EXPECTED(term.getSort().isInteger()
+                                  || term.getSort().isReal()
+                                  || term.getSort().isBitVector(),
+                              term)
+      << "a term of sort Int, Real or bit-vector";
+  ensureWellFormedTerm(term);
+  //////// all checks before this line
+  d_slv->addObjective(*term.d_node, true);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+void Solver::maximize(const Term& term) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERM(term);
+  CVC5_API_ARG_CHECK_EXPECTED(term.getSort().isInteger()
+                                  || term.getSort().isReal()
+                                  || term.getSort().isBitVector(),
+                              term)
+      << "a term of sort Int, Real or bit-vector";
+  ensureWellFormedTerm(term);
+  //////// all checks before this line
+  d_slv->addObjective(*term.d_node, false);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+std::vector<std::tuple<Term, Term, OptimizationStatus>> Solver::getObjectives()
+    const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_RECOVERABLE_CHECK(d_slv->isSmtModeSat())
+      << "can only get objectives after SAT or UNKNOWN response.";
+  //////// all checks before this line
+  std::vector<std::tuple<Term, Term, OptimizationStatus>> res;
+  for (const auto& [target, value, result] : d_slv->getObjectives())
+  {
+    OptimizationStatus status;
+    switch (result.getStatus())
+    {
+      case internal::OmtResult::OPTIMAL:
+        status = OptimizationStatus::OPTIMAL;
+        break;
+      case internal::OmtResult::LIMIT_OPTIMAL:
+        status = OptimizationStatus::LIMIT_OPTIMAL;
+        break;
+      case internal::OmtResult::NON_OPTIMAL:
+        status = OptimizationStatus::NON_OPTIMAL;
+        break;
+      default: status = OptimizationStatus::UNKNOWN; break;
+    }
+    res.emplace_back(
+        Term(d_tm.d_nm, target), Term(d_tm.d_nm, value), status);
+  }
+  return res;
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 std::string Solver::getInstantiations() const
 {
   CVC5_API_TRY_CATCH_BEGIN;
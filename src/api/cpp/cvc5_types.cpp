@@ -84,6 +84,33 @@ std::string to_string(cvc5::UnknownExplanation exp)
 }
 }  // namespace std
 
+namespace cvc5 {
+std::ostream& operator<<(std::ostream& out, OptimizationStatus status)
+{
+  switch (status)
+  {
+    case OptimizationStatus::OPTIMAL: out << "optimal"; break;
+    case OptimizationStatus::LIMIT_OPTIMAL: out << "limit-optimal"; break;
+    case OptimizationStatus::NON_OPTIMAL: out << "non-optimal"; break;
+    case OptimizationStatus::UNKNOWN: out << "unknown"; break;
+    default:
+      throw CVC5ApiException("unhandled enum value '"
+                             + std::to_string(static_cast<int32_t>(status))
+                             + "' encountered");
+  }
+  return out;
+}
+}  // namespace cvc5
+
+namespace std {
+std::string to_string(cvc5::OptimizationStatus status)
+{
+  std::stringstream ss;
+  ss << status;
+  return ss.str();
+}
+}  // namespace std
+
 namespace cvc5::modes {
 std::ostream& operator<<(std::ostream& out, BlockModelsMode mode)
 {
@@ -20,6 +20,7 @@ import io.github.cvc5.modes.ProofComponent;
 import io.github.cvc5.modes.ProofFormat;
 import java.io.IOException;
 import java.util.*;
+import java.util.function.Predicate;
 
 /**
  * A cvc5 solver.
@@ -2683,6 +2684,87 @@ public class Solver extends AbstractPointer
 
   private native Pair<Long, long[]> getTimeoutCoreAssuming(long pointer, long[] assumptionPointers);
 
+  /**
+   * Add an objective that minimizes the given term. The objective is valid
+   * in the current assertion level. If there are objectives, checkSat()
+   * returns a solution that is optimal for them, see getObjectives().
+   * Multiple objectives are combined according to option
+   * {@code opt-combination}.
+   *
+   * SMT-LIB:
+   * {@code
+   * (minimize <term>)
+   * }
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @param term The term to minimize, of sort Int, Real or bit-vector.
+   *             Bit-vector terms are minimized as unsigned numbers.
+   */
+  public void minimize(Term term)
+  {
+    minimize(pointer, term.getPointer());
+  }
+
+  private native void minimize(long pointer, long termPointer);
+
+  /**
+   * Add an objective that maximizes the given term. The objective is valid
+   * in the current assertion level. See minimize().
+   *
+   * SMT-LIB:
+   * {@code
+   * (maximize <term>)
+   * }
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @param term The term to maximize, of sort Int, Real or bit-vector.
+   *             Bit-vector terms are maximized as unsigned numbers.
+   */
+  public void maximize(Term term)
+  {
+    maximize(pointer, term.getPointer());
+  }
+
+  private native void maximize(long pointer, long termPointer);
+
+  /**
+   * Get the values of the objectives in the solution of the last call to
+   * checkSat(). Can be called only if immediately preceded by a SAT or
+   * UNKNOWN response to a query with objectives.
+   *
+   * The status of an objective states how its value relates to its optimum,
+   * see {@link OptimizationStatus}.
+   *
+   * SMT-LIB:
+   * {@code
+   * (get-objectives)
+   * }
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @return The triplets of objectives, their values and their status, in
+   *         the order in which the objectives were added.
+   * @throws CVC5ApiException on error
+   */
+  public List<Triplet<Term, Term, OptimizationStatus>> getObjectives()
+      throws CVC5ApiException
+  {
+    Triplet<long[], long[], int[]> triplet = getObjectives(pointer);
+    Term[] targets = Utils.getTerms(triplet.first);
+    Term[] values = Utils.getTerms(triplet.second);
+    List<Triplet<Term, Term, OptimizationStatus>> ret = new ArrayList<>();
+    for (int i = 0; i < targets.length; i++)
+    {
+      ret.add(new Triplet<>(
+          targets[i], values[i], OptimizationStatus.fromInt(triplet.third[i])));
+    }
+    return ret;
+  }
+
+  private native Triplet<long[], long[], int[]> getObjectives(long pointer);
+
   /**
    * Get refutation proof for the most recent call to checkSat.
    *
@@ -3344,6 +3426,62 @@ public class Solver extends AbstractPointer
 
   private native void blockModelValues(long pointer, long[] termPointers);
 
+  /**
+   * Enumerate the models of the current assertions, projected onto the given
+   * terms.
+   *
+   * This repeatedly checks satisfiability and passes the model values of
+   * {@code terms} to {@code callback}, blocking each enumerated assignment of
+   * {@code terms} (as in {@link #blockModelValues(Term[])}) before the next
+   * check. Enumeration stops when no further model exists, when
+   * {@code limit} models have been enumerated, or when {@code callback}
+   * returns false. Since the blocking constraints remain asserted, a
+   * subsequent call resumes the enumeration. If {@code callback} throws an
+   * exception, the enumeration stops and the exception is rethrown.
+   *
+   * Requires enabling options {@code produce-models} and
+   * {@code incremental}.
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @param terms The terms to project the models onto.
+   * @param callback The function called with the values of {@code terms} in
+   *                 each model. It returns false to stop the enumeration. It
+   *                 must not assert formulas or check satisfiability.
+   * @param limit The maximum number of models to enumerate, or 0 for no
+   *              limit.
+   * @return The result of the last satisfiability check, which is unsat if
+   *         all models were enumerated.
+   */
+  public Result enumerateModels(Term[] terms, Predicate<Term[]> callback, long limit)
+  {
+    long[] pointers = Utils.getPointers(terms);
+    long resultPointer = enumerateModels(pointer, pointers, callback, limit);
+    return new Result(resultPointer);
+  }
+
+  /**
+   * Enumerate all models of the current assertions, projected onto the given
+   * terms.
+   *
+   * @see #enumerateModels(Term[], Predicate, long)
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @param terms The terms to project the models onto.
+   * @param callback The function called with the values of {@code terms} in
+   *                 each model. It returns false to stop the enumeration.
+   * @return The result of the last satisfiability check, which is unsat if
+   *         all models were enumerated.
+   */
+  public Result enumerateModels(Term[] terms, Predicate<Term[]> callback)
+  {
+    return enumerateModels(terms, callback, 0);
+  }
+
+  private native long enumerateModels(
+      long pointer, long[] termPointers, Predicate<Term[]> callback, long limit);
+
   /**
    * Get a string that contains information about all instantiations made by
    * the quantifiers module.
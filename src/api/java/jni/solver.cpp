@@ -677,6 +677,76 @@ JNIEXPORT jobject JNICALL Java_io_github_cvc5_Solver_getTimeoutCoreAssuming(
   CVC5_JAVA_API_TRY_CATCH_END_RETURN(env, nullptr);
 }
 
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    minimize
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_minimize(JNIEnv* env,
+                                                           jobject,
+                                                           jlong pointer,
+                                                           jlong termPointer)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  Term* term = reinterpret_cast<Term*>(termPointer);
+  solver->minimize(*term);
+  CVC5_JAVA_API_TRY_CATCH_END(env);
+}
+
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    maximize
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_maximize(JNIEnv* env,
+                                                           jobject,
+                                                           jlong pointer,
+                                                           jlong termPointer)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  Term* term = reinterpret_cast<Term*>(termPointer);
+  solver->maximize(*term);
+  CVC5_JAVA_API_TRY_CATCH_END(env);
+}
+
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    getObjectives
+ * Signature: (J)Lio/github/cvc5/Triplet;
+ */
+JNIEXPORT jobject JNICALL
+Java_io_github_cvc5_Solver_getObjectives(JNIEnv* env, jobject, jlong pointer)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  std::vector<Term> targets;
+  std::vector<Term> values;
+  std::vector<jint> statuses;
+  for (const auto& [target, value, status] : solver->getObjectives())
+  {
+    targets.push_back(target);
+    values.push_back(value);
+    statuses.push_back(static_cast<jint>(status));
+  }
+  jlongArray t = getPointersFromObjects<Term>(env, targets);
+  jlongArray v = getPointersFromObjects<Term>(env, values);
+  jintArray s = env->NewIntArray(statuses.size());
+  env->SetIntArrayRegion(s, 0, statuses.size(), statuses.data());
+
+  // Triplet triplet = new Triplet<long[], long[], int[]>(t, v, s);
+  jclass tripletClass = env->FindClass("Lio/github/cvc5/Triplet;");
+  jmethodID tripletConstructor = env->GetMethodID(
+      tripletClass,
+      "<init>",
+      "(Ljava/lang/Object;Ljava/lang/Object;Ljava/lang/Object;)V");
+  jobject triplet = env->NewObject(tripletClass, tripletConstructor, t, v, s);
+
+  return triplet;
+  CVC5_JAVA_API_TRY_CATCH_END_RETURN(env, nullptr);
+}
+
 /*
  * Class:     io_github_cvc5_Solver
  * Method:    getProof
@@ -1216,6 +1286,51 @@ JNIEXPORT void JNICALL Java_io_github_cvc5_Solver_blockModelValues(
   CVC5_JAVA_API_TRY_CATCH_END(env);
 }
 
+/*
+ * Class:     io_github_cvc5_Solver
+ * Method:    enumerateModels
+ * Signature: (J[JLjava/util/function/Predicate;J)J
+ */
+JNIEXPORT jlong JNICALL
+Java_io_github_cvc5_Solver_enumerateModels(JNIEnv* env,
+                                           jobject,
+                                           jlong pointer,
+                                           jlongArray jTerms,
+                                           jobject callback,
+                                           jlong limit)
+{
+  CVC5_JAVA_API_TRY_CATCH_BEGIN;
+  Solver* solver = reinterpret_cast<Solver*>(pointer);
+  std::vector<Term> terms = getObjectsFromPointers<Term>(env, jTerms);
+  jclass termClass = env->FindClass("Lio/github/cvc5/Term;");
+  jmethodID termConstructor = env->GetMethodID(termClass, "<init>", "(J)V");
+  jclass callbackClass = env->GetObjectClass(callback);
+  jmethodID testMethod =
+      env->GetMethodID(callbackClass, "test", "(Ljava/lang/Object;)Z");
+  Result* retPointer = new Result(solver->enumerateModels(
+      terms,
+      [&](const std::vector<Term>& values) {
+        jobjectArray jValues =
+            env->NewObjectArray(values.size(), termClass, nullptr);
+        for (size_t i = 0, size = values.size(); i < size; i++)
+        {
+          jlong valuePointer = reinterpret_cast<jlong>(new Term(values[i]));
+          jobject jValue =
+              env->NewObject(termClass, termConstructor, valuePointer);
+          env->SetObjectArrayElement(jValues, i, jValue);
+          env->DeleteLocalRef(jValue);
+        }
+        jboolean cont = env->CallBooleanMethod(callback, testMethod, jValues);
+        env->DeleteLocalRef(jValues);
+        // stop the enumeration if the callback threw an exception, which is
+        // rethrown when returning to Java
+        return cont && !env->ExceptionCheck();
+      },
+      static_cast<uint64_t>(limit)));
+  return reinterpret_cast<jlong>(retPointer);
+  CVC5_JAVA_API_TRY_CATCH_END_RETURN(env, 0);
+}
+
 /*
  * Class:     io_github_cvc5_Solver
  * Method:    getInstantiations
@@ -21,7 +21,7 @@ from libcpp.map cimport map
 from libcpp.optional cimport optional
 from libcpp.pair cimport pair
 from cvc5kinds cimport Kind, SortKind
-from cvc5types cimport BlockModelsMode, LearnedLitType, ProofComponent, ProofFormat, RoundingMode, UnknownExplanation, FindSynthTarget, InputLanguage, OptionCategory
+from cvc5types cimport BlockModelsMode, LearnedLitType, OptimizationStatus, ProofComponent, ProofFormat, RoundingMode, UnknownExplanation, FindSynthTarget, InputLanguage, OptionCategory
 from cvc5proofrules cimport ProofRewriteRule, ProofRule
 from cvc5skolemids cimport SkolemId
 
@@ -63,6 +63,9 @@ cdef extern from "<tuple>" namespace "std":
     uint32_t get0 "std::get<0>"(tuple[uint32_t,uint32_t,Term]) except +
     uint32_t get1 "std::get<1>"(tuple[uint32_t,uint32_t,Term]) except +
     Term get2 "std::get<2>"(tuple[uint32_t,uint32_t,Term]) except +
+    Term get0 "std::get<0>"(tuple[Term,Term,OptimizationStatus]) except +
+    Term get1 "std::get<1>"(tuple[Term,Term,OptimizationStatus]) except +
+    OptimizationStatus get2 "std::get<2>"(tuple[Term,Term,OptimizationStatus]) except +
 
 cdef extern from "<cvc5/cvc5.h>" namespace "cvc5":
     cdef cppclass Options:
@@ -472,6 +475,9 @@ cdef extern from "<cvc5/cvc5.h>" namespace "cvc5":
         map[Term,Term] getDifficulty() except +
         pair[Result, vector[Term]] getTimeoutCore() except +
         pair[Result, vector[Term]] getTimeoutCoreAssuming(const vector[Term]& assumptions) except +
+        void minimize(const Term& term) except +
+        void maximize(const Term& term) except +
+        vector[tuple[Term, Term, OptimizationStatus]] getObjectives() except +
         Term getValue(Term term) except +
         vector[Term] getValue(const vector[Term]& terms) except +
         Term getQuantifierElimination(const Term& q) except +
@@ -716,6 +722,12 @@ cdef extern from "<cvc5/cvc5.h>" namespace "cvc5":
         size_t operator()(const Proof&) except +
 
 
+cdef extern from "py_callback.h" namespace "cvc5":
+    Result pyEnumerateModels(Solver& solver, const vector[Term]& terms,
+                             cpy_ref.PyObject* callback,
+                             cpy_ref.PyObject* tm, uint64_t limit) except +
+
+
 cdef extern from "<cvc5/cvc5_parser.h>" namespace "cvc5::parser":
     cdef cppclass SymbolManager:
         SymbolManager(TermManager& tm) except +
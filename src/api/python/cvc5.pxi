@@ -47,6 +47,7 @@ from cvc5 cimport TermManager as c_TermManager
 from cvc5 cimport Solver as c_Solver
 from cvc5 cimport Plugin as c_Plugin
 from cvc5 cimport PyPlugin as c_PyPlugin
+from cvc5 cimport pyEnumerateModels as c_pyEnumerateModels
 from cvc5 cimport Statistics as c_Statistics
 from cvc5 cimport Stat as c_Stat
 from cvc5 cimport Grammar as c_Grammar
@@ -4231,6 +4232,82 @@ cdef class Solver:
         r.cr = res.first
         return (r, core)
 
+    def minimize(self, Term term):
+        """
+            Add an objective that minimizes the given term. The objective is
+            valid in the current assertion level. If there are objectives,
+            :py:meth:`Solver.checkSat()` returns a solution that is optimal
+            for them, see :py:meth:`Solver.getObjectives()`. Multiple
+            objectives are combined according to option
+            :ref:`opt-combination <lbl-option-opt-combination>`.
+
+            SMT-LIB:
+
+            .. code-block:: smtlib
+
+                (minimize <term>)
+
+            .. warning::
+
+                This function is experimental and may change in future versions.
+
+            :param term: The term to minimize, of sort Int, Real or
+                         bit-vector. Bit-vector terms are minimized as
+                         unsigned numbers.
+        """
+        self.csolver.minimize(term.cterm)
+
+    def maximize(self, Term term):
+        """
+            Add an objective that maximizes the given term. The objective is
+            valid in the current assertion level. See
+            :py:meth:`Solver.minimize()`.
+
+            SMT-LIB:
+
+            .. code-block:: smtlib
+
+                (maximize <term>)
+
+            .. warning::
+
+                This function is experimental and may change in future versions.
+
+            :param term: The term to maximize, of sort Int, Real or
+                         bit-vector. Bit-vector terms are maximized as
+                         unsigned numbers.
+        """
+        self.csolver.maximize(term.cterm)
+
+    def getObjectives(self):
+        """
+            Get the values of the objectives in the solution of the last call
+            to :py:meth:`Solver.checkSat()`. Can be called only if immediately
+            preceded by a SAT or UNKNOWN response to a query with objectives.
+
+            The status of an objective states how its value relates to its
+            optimum, see :py:obj:`OptimizationStatus <cvc5.OptimizationStatus>`.
+
+            SMT-LIB:
+
+            .. code-block:: smtlib
+
+                (get-objectives)
+
+            .. warning::
+
+                This function is experimental and may change in future versions.
+
+            :return: The tuples of objectives, their values and their status,
+                     in the order in which the objectives were added.
+        """
+        objs = []
+        for o in self.csolver.getObjectives():
+            objs.append((_term(self.tm, get0(o)),
+                         _term(self.tm, get1(o)),
+                         OptimizationStatus(<int> get2(o))))
+        return objs
+
     def getValue(self, term_or_list):
         """
             Get the value of the given term or list of terms in the current
@@ -4760,6 +4837,48 @@ cdef class Solver:
             nts.push_back((<Term?> t).cterm)
         self.csolver.blockModelValues(nts)
 
+    def enumerateModels(self, terms, callback, limit=0):
+        """
+           Enumerate the models of the current assertions, projected onto
+           the given terms.
+
+           This repeatedly checks satisfiability and calls `callback` with
+           the list of model values of `terms`, blocking each enumerated
+           assignment of `terms` (as in :py:meth:`blockModelValues()`)
+           before the next check. Enumeration stops when no further model
+           exists, when `limit` models have been enumerated, or when
+           `callback` returns False. Since the blocking constraints remain
+           asserted, a subsequent call resumes the enumeration. If
+           `callback` raises an exception, the enumeration stops and a
+           RuntimeError is raised.
+
+           Requires enabling options
+           :ref:`produce-models <lbl-option-produce-models>` and
+           :ref:`incremental <lbl-option-incremental>`.
+
+           .. warning::
+
+                This function is experimental and may change in future versions.
+
+           :param terms: The terms to project the models onto.
+           :param callback: The function called with the values of `terms`
+                            in each model. It returns False to stop the
+                            enumeration. It must not assert formulas or
+                            check satisfiability.
+           :param limit: The maximum number of models to enumerate, or 0 for
+                         no limit.
+           :return: The result of the last satisfiability check, which is
+                    unsat if all models were enumerated.
+        """
+        cdef vector[c_Term] nts
+        for t in terms:
+            nts.push_back((<Term?> t).cterm)
+        cdef Result r = Result()
+        r.cr = c_pyEnumerateModels(dereference(self.csolver), nts,
+                                   <cpy_ref.PyObject*> callback,
+                                   <cpy_ref.PyObject*> self.tm, limit)
+        return r
+
     def getInstantiations(self):
         """
             Return a string that contains information about all instantiations
@@ -6228,6 +6347,13 @@ cdef public api:
         return result
 
 
+    bint cy_call_model_callback(object func, object tm, const vector[c_Term]& values, string *error):
+        try:
+            return bool(func([_term(tm, v) for v in values]))
+        except Exception as e:
+            error[0] = traceback.format_exc().encode()
+        return False
+
     void cy_call_void_func_term(object self, string method, const c_Term& t, string *error):
         try:
             func = getattr(self, method.decode())
@@ -0,0 +1,40 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ */
+
+#include "py_callback.h"
+
+namespace cvc5 {
+
+Result pyEnumerateModels(Solver& solver,
+                         const std::vector<Term>& terms,
+                         PyObject* callback,
+                         PyObject* tm,
+                         uint64_t limit)
+{
+  // Provided by "cvc5_python_base_api.h"
+  if (import_cvc5__cvc5_python_base())
+  {
+    throw std::runtime_error("Error executing import_cvc5__cvc5_python_base");
+  }
+  std::string error;
+  Result r = solver.enumerateModels(
+      terms,
+      [&](const std::vector<Term>& values) {
+        // stop the enumeration if the callback raised an exception
+        return cy_call_model_callback(callback, tm, values, &error)
+               && error.empty();
+      },
+      limit);
+  if (!error.empty()) throw std::runtime_error(error);
+  return r;
+}
+
+}  // namespace cvc5
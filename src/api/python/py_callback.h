@@ -0,0 +1,39 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Wrappers for cvc5 C++ API functions that take callbacks.
+ */
+
+#ifndef CVC5__PY_CALLBACK_H
+#define CVC5__PY_CALLBACK_H
+
+// Python.h must come first to avoid libc macro redefinition warnings
+#include <Python.h>
+#include <cvc5/cvc5.h>
+
+// Created by Cython when providing 'public api' keywords
+#include "cvc5_python_base_api.h"
+
+namespace cvc5 {
+
+/**
+ * Call Solver::enumerateModels with a callback that passes the values of
+ * each model as a list of terms of term manager tm to the Python callable
+ * callback. If callback raises an exception, the enumeration stops and the
+ * exception is rethrown as a std::runtime_error.
+ */
+Result pyEnumerateModels(Solver& solver,
+                         const std::vector<Term>& terms,
+                         PyObject* callback,
+                         PyObject* tm,
+                         uint64_t limit);
+
+}  // namespace cvc5
+
+#endif /* CVC5__PY_CALLBACK_H */
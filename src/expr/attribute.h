@@ -543,6 +543,7 @@ template <class AttrKind>
 inline typename AttrKind::value_type NodeManager::getAttribute(
     expr::NodeValue* nv, const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(nv, AttrKind());
 }
 
@@ -550,6 +551,7 @@ template <class AttrKind>
 inline bool NodeManager::hasAttribute(expr::NodeValue* nv,
                                       const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->hasAttribute(nv, AttrKind());
 }
 
@@ -558,6 +560,7 @@ inline bool NodeManager::getAttribute(expr::NodeValue* nv,
                                       const AttrKind&,
                                       typename AttrKind::value_type& ret) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(nv, AttrKind(), ret);
 }
 
@@ -567,6 +570,7 @@ inline void NodeManager::setAttribute(
     const AttrKind&,
     const typename AttrKind::value_type& value)
 {
+  AttrLock lock(this);
   d_attrManager->setAttribute(nv, AttrKind(), value);
 }
 
@@ -574,12 +578,14 @@ template <class AttrKind>
 inline typename AttrKind::value_type NodeManager::getAttribute(
     TNode n, const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool NodeManager::hasAttribute(TNode n, const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -588,6 +594,7 @@ inline bool NodeManager::getAttribute(TNode n,
                                       const AttrKind&,
                                       typename AttrKind::value_type& ret) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -595,6 +602,7 @@ template <class AttrKind>
 inline void NodeManager::setAttribute(
     TNode n, const AttrKind&, const typename AttrKind::value_type& value)
 {
+  AttrLock lock(this);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
@@ -602,12 +610,14 @@ template <class AttrKind>
 inline typename AttrKind::value_type NodeManager::getAttribute(
     TypeNode n, const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool NodeManager::hasAttribute(TypeNode n, const AttrKind&) const
 {
+  AttrLock lock(this);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -616,6 +626,7 @@ inline bool NodeManager::getAttribute(TypeNode n,
                                       const AttrKind&,
                                       typename AttrKind::value_type& ret) const
 {
+  AttrLock lock(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -623,6 +634,7 @@ template <class AttrKind>
 inline void NodeManager::setAttribute(
     TypeNode n, const AttrKind&, const typename AttrKind::value_type& value)
 {
+  AttrLock lock(this);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
@@ -56,6 +56,7 @@ Node BoundVarManager::getCacheValue(TNode cv, size_t i)
 
 Node BoundVarManager::mkBoundVar(BoundVarId id, Node n, TypeNode tn)
 {
+  NodeManager::TableLock lock(tn.getNodeManager());
   std::tuple<BoundVarId, TypeNode, Node> key(id, tn, n);
   std::map<std::tuple<BoundVarId, TypeNode, Node>, Node>::iterator it =
       d_cache.find(key);
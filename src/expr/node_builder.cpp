@@ -339,14 +339,21 @@ void NodeBuilder::decrRefCounts()
 
 TypeNode NodeBuilder::constructTypeNode()
 {
+  // the pool is locked until the result is constructed
+  NodeManager::PoolGuard guard(d_nm, d_nv);
   // NOLINTNEXTLINE(clang-analyzer-unix.Malloc)
   return TypeNode(constructNV());
 }
 
 Node NodeBuilder::constructNode()
 {
-  // NOLINTNEXTLINE(clang-analyzer-unix.Malloc)
-  Node n(constructNV());
+  Node n;
+  {
+    // the pool is locked until n is constructed, but not during type checking
+    NodeManager::PoolGuard guard(d_nm, d_nv);
+    // NOLINTNEXTLINE(clang-analyzer-unix.Malloc)
+    n = Node(constructNV());
+  }
   maybeCheckType(n);
   return n;
 }
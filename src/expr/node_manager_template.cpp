@@ -50,12 +50,14 @@ namespace {
 /**
  * This class sets it reference argument to true and ensures that it gets set
  * to false on destruction. This can be used to make sure a flag gets toggled
- * in a function even on exceptional exit (e.g., see reclaimZombies()).
+ * in a function even on exceptional exit (e.g., see reclaimZombies()). The
+ * flag is a std::atomic<bool> when building with concurrent nodes.
  */
+template <class Flag>
 struct ScopedBool {
-  bool& d_value;
+  Flag& d_value;
 
-  ScopedBool(bool& value) :
+  ScopedBool(Flag& value) :
     d_value(value) {
 
     Trace("gc") << ">> setting ScopedBool\n";
@@ -87,6 +89,15 @@ struct NVReclaim {
   }
 };
 
+#ifdef CVC5_CONCURRENT_NODES
+/**
+ * The number of pool shard and attribute locks held by this thread. Zombies
+ * are not reclaimed while it is non-zero, since reclamation takes these locks
+ * itself and must not delete a NodeValue that a caller is about to reference.
+ */
+thread_local size_t s_nodeLocksHeld = 0;
+#endif
+
 } // namespace
 
 // clang-format off
@@ -103,6 +114,42 @@ struct LambdaBoundVarListTag
 typedef expr::Attribute<attr::LambdaBoundVarListTag, Node>
     LambdaBoundVarListAttr;
 
+#ifdef CVC5_CONCURRENT_NODES
+NodeManager::PoolGuard::PoolGuard(NodeManager* nm, const expr::NodeValue* nv)
+    : d_mutex(nullptr)
+{
+  kind::MetaKind mk = nv->getMetaKind();
+  if (mk != kind::metakind::VARIABLE && mk != kind::metakind::NULLARY_OPERATOR)
+  {
+    d_mutex = &nm->d_pool[poolShardOf(nv)].d_mutex;
+    d_mutex->lock();
+    ++s_nodeLocksHeld;
+  }
+}
+
+NodeManager::PoolGuard::~PoolGuard()
+{
+  if (d_mutex != nullptr)
+  {
+    --s_nodeLocksHeld;
+    d_mutex->unlock();
+  }
+}
+
+NodeManager::AttrLock::AttrLock(const NodeManager* nm)
+    : d_mutex(nm->d_attrMutex)
+{
+  d_mutex.lock();
+  ++s_nodeLocksHeld;
+}
+
+NodeManager::AttrLock::~AttrLock()
+{
+  --s_nodeLocksHeld;
+  d_mutex.unlock();
+}
+#endif
+
 NodeManager::NodeManager()
     : d_skManager(new SkolemManager(this)),
       d_bvManager(new BoundVarManager),
@@ -284,13 +331,13 @@ NodeManager::~NodeManager()
   if (TraceIsOn("gc:leaks"))
   {
     Trace("gc:leaks") << "still in pool:" << endl;
-    for (NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
-                                       iend = d_nodeValuePool.end();
-         i != iend;
-         ++i)
+    for (const PoolShard& shard : d_pool)
     {
-      Trace("gc:leaks") << "  " << *i << " id=" << (*i)->d_id
-                        << " rc=" << (*i)->d_rc << " " << **i << endl;
+      for (const NodeValue* nv : shard.d_nodes)
+      {
+        Trace("gc:leaks") << "  " << nv << " id=" << nv->d_id
+                          << " rc=" << nv->d_rc << " " << *nv << endl;
+      }
     }
     Trace("gc:leaks") << ":end:" << endl;
   }
@@ -333,6 +380,7 @@ const DType& NodeManager::getDTypeFor(Node n) const
 
 const DType& NodeManager::getDTypeForIndex(size_t index) const
 {
+  TableLock lock(this);
   // if this assertion fails, it is likely due to not managing datatypes
   // properly w.r.t. multiple NodeManagers.
   Assert(index < d_dtypes.size());
@@ -345,9 +393,17 @@ void NodeManager::reclaimZombies()
 
   Trace("gc") << "reclaiming " << d_zombies.size() << " zombie(s)!\n";
 
+#ifdef CVC5_CONCURRENT_NODES
+  // another thread may have started reclaiming since we last checked
+  if (d_inReclaimZombies.exchange(true))
+  {
+    return;
+  }
+#else
   // during reclamation, reclaimZombies() is never supposed to be called
   Assert(!d_inReclaimZombies)
       << "NodeManager::reclaimZombies() not re-entrant!";
+#endif
 
   // whether exit is normal or exceptional, the Reclaim dtor is called
   // and ensures that d_inReclaimZombies is set back to false.
@@ -367,12 +423,17 @@ void NodeManager::reclaimZombies()
   // iterator, causing a crash.  So we need to copy the set away.
 
   vector<NodeValue*> zombies;
-  zombies.reserve(d_zombies.size());
-  remove_copy_if(d_zombies.begin(),
-                 d_zombies.end(),
-                 back_inserter(zombies),
-                 NodeValueReferenceCountNonZero());
-  d_zombies.clear();
+  {
+#ifdef CVC5_CONCURRENT_NODES
+    std::lock_guard<std::mutex> lock(d_zombieMutex);
+#endif
+    zombies.reserve(d_zombies.size());
+    remove_copy_if(d_zombies.begin(),
+                   d_zombies.end(),
+                   back_inserter(zombies),
+                   NodeValueReferenceCountNonZero());
+    d_zombies.clear();
+  }
 
 #ifdef _LIBCPP_VERSION
   NodeValue* last = nullptr;
@@ -392,7 +453,7 @@ void NodeManager::reclaimZombies()
 #endif
 
     // collect ONLY IF still zero
-    if (nv->d_rc == 0)
+    if (claimZombie(nv))
     {
       if (TraceIsOn("gc"))
       {
@@ -401,14 +462,7 @@ void NodeManager::reclaimZombies()
         nv->printAst(Trace("gc"));
         Trace("gc") << endl;
       }
-
-      // remove from the pool
       kind::MetaKind mk = nv->getMetaKind();
-      if (mk != kind::metakind::VARIABLE
-          && mk != kind::metakind::NULLARY_OPERATOR)
-      {
-        poolRemove(nv);
-      }
 
       // whether exit is normal or exceptional, the NVReclaim dtor is
       // called and ensures that d_nodeUnderDeletion is set back to
@@ -426,7 +480,10 @@ void NodeManager::reclaimZombies()
         Assert(nv->d_rc == 1);
       }
       nv->d_rc = 0;
-      d_attrManager->deleteAllAttributes(nv);
+      {
+        AttrLock lock(this);
+        d_attrManager->deleteAllAttributes(nv);
+      }
 
       // decr ref counts of children
       nv->decrRefCounts();
@@ -446,6 +503,68 @@ void NodeManager::reclaimZombies()
   }
 } /* NodeManager::reclaimZombies() */
 
+bool NodeManager::claimZombie(NodeValue* nv)
+{
+  kind::MetaKind mk = nv->getMetaKind();
+  bool inPool = mk != kind::metakind::VARIABLE
+                && mk != kind::metakind::NULLARY_OPERATOR;
+#ifdef CVC5_CONCURRENT_NODES
+  // Lookups hold the lock of the shard until they have referenced their
+  // result, hence nv cannot be resurrected once we have checked its reference
+  // count and removed it from the pool under that lock. The zombie lock
+  // serializes this with tryMarkForDeletion(), which may have added nv to the
+  // zombies again after it was resurrected and released.
+  std::unique_lock<std::mutex> shardLock;
+  if (inPool)
+  {
+    shardLock = std::unique_lock<std::mutex>(d_pool[poolShardOf(nv)].d_mutex);
+  }
+  std::lock_guard<std::mutex> zombieLock(d_zombieMutex);
+  if (nv->d_rc != 0)
+  {
+    return false;
+  }
+  d_zombies.erase(nv);
+#else
+  if (nv->d_rc != 0)
+  {
+    return false;
+  }
+#endif
+  // remove from the pool
+  if (inPool)
+  {
+    poolRemove(nv);
+  }
+  return true;
+}
+
+#ifdef CVC5_CONCURRENT_NODES
+bool NodeManager::tryMarkForDeletion(NodeValue* nv)
+{
+  {
+    std::lock_guard<std::mutex> lock(d_zombieMutex);
+    uint32_t rc = 1;
+    if (!nv->d_rc.compare_exchange_strong(rc, 0, std::memory_order_acq_rel))
+    {
+      return false;
+    }
+    Trace("gc") << "zombifying node value " << nv << " [" << nv->d_id << "]"
+                << std::endl;
+    d_zombies.insert(nv);
+    if (d_zombies.size() <= 5000)
+    {
+      return true;
+    }
+  }
+  if (safeToReclaimZombies())
+  {
+    reclaimZombies();
+  }
+  return true;
+}
+#endif
+
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots)
 {
@@ -662,6 +781,7 @@ std::vector<TypeNode> NodeManager::mkMutualDatatypeTypesInternal(
   // simple self- and mutual-recursion, for example in the definition
   // "nat = succ(pred:nat) | zero", a named resolution can handle the
   // pred selector.
+  TableLock lock(this);
   DatatypeIndexAttr dia;
   for (const DType& dt : datatypes)
   {
@@ -971,12 +1091,14 @@ TypeNode NodeManager::mkFunctionType(const std::vector<TypeNode>& argTypes,
 
 TypeNode NodeManager::mkTupleType(const std::vector<TypeNode>& types)
 {
+  TableLock lock(this);
   return d_tt_cache.getTupleType(this, types);
 }
 
 TypeNode NodeManager::mkNullableType(const TypeNode& type)
 {
   Assert(!type.isNull());
+  TableLock lock(this);
   auto it = d_nt_cache.find(type);
   if (it != d_nt_cache.end())
   {
@@ -1005,6 +1127,7 @@ TypeNode NodeManager::mkNullableType(const TypeNode& type)
 
 TypeNode NodeManager::mkRecordType(const Record& rec)
 {
+  TableLock lock(this);
   return d_rt_cache.getRecordType(this, rec);
 }
 
@@ -1052,6 +1175,7 @@ TypeNode NodeManager::mkSortConstructor(const std::string& name,
 {
   if (!fresh)
   {
+    TableLock lock(this);
     std::pair<std::string, size_t> key(name, arity);
     std::map<std::pair<std::string, size_t>, TypeNode>::iterator it =
         d_nfreshSorts.find(key);
@@ -1093,6 +1217,7 @@ Node NodeManager::mkOracle(Oracle& o)
   Node n = NodeBuilder(this, Kind::ORACLE);
   n.setAttribute(TypeAttr(), builtinOperatorType());
   n.setAttribute(TypeCheckedAttr(), true);
+  TableLock lock(this);
   n.setAttribute(OracleIndexAttr(), d_oracles.size());
   // we allocate a new oracle, to take ownership
   d_oracles.push_back(std::unique_ptr<Oracle>(new Oracle(o.getFunction())));
@@ -1103,6 +1228,7 @@ const Oracle& NodeManager::getOracleFor(const Node& n) const
 {
   Assert(n.getKind() == Kind::ORACLE);
   size_t index = n.getAttribute(OracleIndexAttr());
+  TableLock lock(this);
   Assert(index < d_oracles.size());
   return *d_oracles[index];
 }
@@ -1121,6 +1247,7 @@ Node NodeManager::mkVar(const std::string& name,
   }
   // Note that the constructed variable must have kind VARIABLE, not SKOLEM,
   // which is why this is not implemented as a case inside SkolemManager.
+  TableLock lock(this);
   std::pair<std::string, TypeNode> key(name, type);
   std::map<std::pair<std::string, TypeNode>, Node>::iterator it;
   it = d_nfreshVars.find(key);
@@ -1289,6 +1416,7 @@ Node NodeManager::mkRawSymbol(const std::string& name, const TypeNode& type)
 
 Node NodeManager::mkNullaryOperator(const TypeNode& type, Kind k)
 {
+  TableLock lock(this);
   std::map<TypeNode, Node>::iterator it = d_unique_vars[k].find(type);
   if (it == d_unique_vars[k].end())
   {
@@ -1355,6 +1483,8 @@ NodeClass NodeManager::mkConstInternal(Kind k, const T& val)
 
   nvStack.d_children[0] = const_cast<expr::NodeValue*>(
       reinterpret_cast<const expr::NodeValue*>(&val));
+  // held until the result below is constructed
+  PoolGuard guard(this, &nvStack);
   expr::NodeValue* nv = poolLookup(&nvStack);
 
 #if defined(__GNUC__) \
@@ -1413,12 +1543,19 @@ Node NodeManager::mkDummySkolem(const std::string& prefix,
 
 bool NodeManager::safeToReclaimZombies() const
 {
+#ifdef CVC5_CONCURRENT_NODES
+  if (s_nodeLocksHeld > 0)
+  {
+    return false;
+  }
+#endif
   return !d_inReclaimZombies && !d_attrManager->inGarbageCollection();
 }
 
 void NodeManager::deleteAttributes(
     const std::vector<const expr::attr::AttributeUniqueId*>& ids)
 {
+  AttrLock lock(this);
   d_attrManager->deleteAttributes(ids);
 }
 
@@ -12,10 +12,6 @@
 
 #include "cvc5_private.h"
 
-#ifdef CVC5_POLY_IMP
-#include <poly/polyxx.h>
-#endif
-
 /* circular dependency; force node.h first */
 #include "expr/node.h"
 #include "expr/type_node.h"
@@ -26,6 +22,10 @@
 #include <string>
 #include <unordered_set>
 #include <vector>
+#ifdef CVC5_CONCURRENT_NODES
+#include <atomic>
+#include <mutex>
+#endif
 
 #include "base/check.h"
 #include "expr/internal_skolem_id.h"
@@ -72,6 +72,7 @@ class NodeManager
   friend class expr::NodeValue;
   friend class expr::TypeChecker;
   friend class SkolemManager;
+  friend class BoundVarManager;
 
   friend class NodeBuilder;
 
@@ -117,10 +118,6 @@ class NodeManager
   SkolemManager* getSkolemManager() { return d_skManager.get(); }
   /** Get this node manager's bound variable manager */
   BoundVarManager* getBoundVarManager() { return d_bvManager.get(); }
-#ifdef CVC5_POLY_IMP
-  /** Get this node manager's libpoly context */
-  const poly::Context& getPolyContext() { return d_polyCtx; }
-#endif
 
   /**
    * Return the datatype at the given index owned by this class. Type nodes are
@@ -837,6 +834,98 @@ class NodeManager
                              expr::NodeValueIDEquality>
       NodeValueIDSet;
 
+#ifdef CVC5_CONCURRENT_NODES
+  /** The number of shards of the node value pool. */
+  static constexpr size_t NUM_POOL_SHARDS = 64;
+#else
+  static constexpr size_t NUM_POOL_SHARDS = 1;
+#endif
+
+  /**
+   * A shard of the node value pool. Each NodeValue belongs to the shard
+   * given by poolShardOf().
+   */
+  struct PoolShard
+  {
+    NodeValuePool d_nodes;
+#ifdef CVC5_CONCURRENT_NODES
+    /** Protects d_nodes. */
+    std::mutex d_mutex;
+#endif
+  };
+
+  /**
+   * RAII guard that holds the lock of the pool shard of a NodeValue. It must
+   * be held from the lookup of a NodeValue in the pool until a reference to
+   * the result is taken, so that a zombie found in the pool cannot be
+   * reclaimed by another thread in the meantime. It is a no-op unless cvc5 is
+   * built with concurrent nodes.
+   */
+  class PoolGuard
+  {
+   public:
+#ifdef CVC5_CONCURRENT_NODES
+    PoolGuard(NodeManager* nm, const expr::NodeValue* nv);
+    ~PoolGuard();
+
+   private:
+    /** The mutex of the locked shard, if any */
+    std::mutex* d_mutex;
+#else
+    PoolGuard(NodeManager*, const expr::NodeValue*) {}
+#endif
+  };
+
+  /**
+   * RAII guard for the tables of this NodeManager that are not part of the
+   * node value pool, e.g. the datatypes and the caches of tuple types. The
+   * skolem and bound variable managers use it as well. It is a no-op unless
+   * cvc5 is built with concurrent nodes.
+   */
+  class TableLock
+  {
+   public:
+#ifdef CVC5_CONCURRENT_NODES
+    TableLock(const NodeManager* nm) : d_lock(nm->d_tableMutex) {}
+
+   private:
+    std::lock_guard<std::recursive_mutex> d_lock;
+#else
+    TableLock(const NodeManager*) {}
+#endif
+  };
+
+  /**
+   * RAII guard for the attribute tables. It is a no-op unless cvc5 is built
+   * with concurrent nodes.
+   */
+  class AttrLock
+  {
+   public:
+#ifdef CVC5_CONCURRENT_NODES
+    AttrLock(const NodeManager* nm);
+    ~AttrLock();
+
+   private:
+    std::recursive_mutex& d_mutex;
+#else
+    AttrLock(const NodeManager*) {}
+#endif
+  };
+
+  /** Get the index of the pool shard of nv. */
+  static size_t poolShardOf(CVC5_UNUSED const expr::NodeValue* nv)
+  {
+#ifdef CVC5_CONCURRENT_NODES
+    // use the high bits of the multiplicative hash, since the pools use the
+    // low bits of poolHash() for their buckets
+    uint64_t h = static_cast<uint64_t>(nv->poolHash());
+    return (h * 0x9e3779b97f4a7c15ull) >> 58;
+#else
+    return 0;
+#endif
+  }
+
   /** Predicate for use with STL algorithms */
   struct NodeValueReferenceCountNonZero
   {
@@ -940,6 +1029,21 @@ class NodeManager
    */
   void poolRemove(expr::NodeValue* nv);
 
+  /**
+   * Remove the zombie nv from the pool if its reference count is still zero.
+   * Returns true if nv was removed, in which case it must be deleted.
+   */
+  bool claimZombie(expr::NodeValue* nv);
+
+#ifdef CVC5_CONCURRENT_NODES
+  /**
+   * Decrement the reference count of nv from 1 to 0 and register it as a
+   * zombie, atomically w.r.t. zombie reclamation. Returns false if the
+   * reference count was not 1.
+   */
+  bool tryMarkForDeletion(expr::NodeValue* nv);
+#endif
+
   /**
    * Register a NodeValue as a zombie.
    */
@@ -962,6 +1066,9 @@ class NodeManager
     // already contains a node value with the same id as `nv`, but the pointers
     // are different, then the wrong `NodeManager` was in scope for one of the
     // two nodes when it reached refcount zero.
+#ifdef CVC5_CONCURRENT_NODES
+    std::unique_lock<std::mutex> lock(d_zombieMutex);
+#endif
     Assert(d_zombies.find(nv) == d_zombies.end() || *d_zombies.find(nv) == nv);
 
     d_zombies.insert(nv);
@@ -970,6 +1077,9 @@ class NodeManager
     {
       if (d_zombies.size() > 5000)
       {
+#ifdef CVC5_CONCURRENT_NODES
+        lock.unlock();
+#endif
         reclaimZombies();
       }
     }
@@ -987,6 +1097,9 @@ class NodeManager
       Trace("gc") << "marking node value " << nv << " [" << nv->d_id
                   << "]: as maxed out" << std::endl;
     }
+#ifdef CVC5_CONCURRENT_NODES
+    std::lock_guard<std::mutex> lock(d_zombieMutex);
+#endif
     d_maxedOut.push_back(nv);
   }
 
@@ -1029,15 +1142,16 @@ class NodeManager
   std::unique_ptr<SkolemManager> d_skManager;
   /** The bound variable manager */
   std::unique_ptr<BoundVarManager> d_bvManager;
-#ifdef CVC5_POLY_IMP
-  /** The libpoly context */
-  poly::Context d_polyCtx;
-#endif
 
-  NodeValuePool d_nodeValuePool;
+  /** The node value pool, split into shards */
+  PoolShard d_pool[NUM_POOL_SHARDS];
 
   /** The next node identifier */
+#ifdef CVC5_CONCURRENT_NODES
+  std::atomic<size_t> d_nextId;
+#else
   size_t d_nextId;
+#endif
 
   expr::attr::AttributeManager* d_attrManager;
 
@@ -1057,7 +1171,11 @@ class NodeManager
    * NodeValues, but these shouldn't trigger a (recursive) call to
    * reclaimZombies().
    */
+#ifdef CVC5_CONCURRENT_NODES
+  std::atomic<bool> d_inReclaimZombies;
+#else
   bool d_inReclaimZombies;
+#endif
 
   /**
    * The set of zombie nodes.  We may want to revisit this design, as
@@ -1072,6 +1190,15 @@ class NodeManager
    */
   std::vector<expr::NodeValue*> d_maxedOut;
 
+#ifdef CVC5_CONCURRENT_NODES
+  /** Protects d_zombies and d_maxedOut. */
+  std::mutex d_zombieMutex;
+  /** Protects the attribute tables, see AttrLock. */
+  mutable std::recursive_mutex d_attrMutex;
+  /** Protects the tables below and the skolem manager, see TableLock. */
+  mutable std::recursive_mutex d_tableMutex;
+#endif
+
   /**
    * A set of operator singletons (w.r.t.  to this NodeManager
    * instance) for operators.  Conceptually, Nodes with kind, say,
@@ -1123,8 +1250,9 @@ inline TypeNode NodeManager::mkSetType(TypeNode elementType)
 
 inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const
 {
-  NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
-  if (find == d_nodeValuePool.end())
+  const NodeValuePool& pool = d_pool[poolShardOf(nv)].d_nodes;
+  NodeValuePool::const_iterator find = pool.find(nv);
+  if (find == pool.end())
   {
     return nullptr;
   }
@@ -1136,17 +1264,17 @@ inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const
 
 inline void NodeManager::poolInsert(expr::NodeValue* nv)
 {
-  Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end())
-      << "NodeValue already in the pool!";
-  d_nodeValuePool.insert(nv);
+  NodeValuePool& pool = d_pool[poolShardOf(nv)].d_nodes;
+  Assert(pool.find(nv) == pool.end()) << "NodeValue already in the pool!";
+  pool.insert(nv);
 }
 
 inline void NodeManager::poolRemove(expr::NodeValue* nv)
 {
-  Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end())
-      << "NodeValue is not in the pool!";
+  NodeValuePool& pool = d_pool[poolShardOf(nv)].d_nodes;
+  Assert(pool.find(nv) != pool.end()) << "NodeValue is not in the pool!";
 
-  d_nodeValuePool.erase(nv);
+  pool.erase(nv);
 }
 
 inline Kind NodeManager::operatorToKind(TNode n)
@@ -120,5 +120,16 @@ void NodeValue::markForDeletion()
   d_nm->markForDeletion(this);
 }
 
+#ifdef CVC5_CONCURRENT_NODES
+bool NodeValue::tryMarkForDeletion()
+{
+  Assert(d_nm != nullptr)
+      << "No current NodeManager on destruction of NodeValue: "
+         "maybe a public cvc5 interface function is missing a "
+         "NodeManagerScope ?";
+  return d_nm->tryMarkForDeletion(this);
+}
+#endif
+
 }  // namespace expr
 }  // namespace cvc5::internal
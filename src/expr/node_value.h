@@ -20,6 +20,9 @@
 #ifndef CVC5__EXPR__NODE_VALUE_H
 #define CVC5__EXPR__NODE_VALUE_H
 
+#ifdef CVC5_CONCURRENT_NODES
+#include <atomic>
+#endif
 #include <iterator>
 #include <string>
 
@@ -290,6 +293,54 @@ class CVC5_EXPORT NodeValue
   /** Private constructor for the null value. */
   NodeValue(int);
 
+#ifdef CVC5_CONCURRENT_NODES
+  /**
+   * With concurrent nodes, the reference count is updated with compare and
+   * swap so that it stays sticky once it reaches MAX_RC, and so that exactly
+   * one thread performs the transition to 0.
+   */
+  void inc()
+  {
+    uint32_t rc = d_rc.load(std::memory_order_relaxed);
+    while (__builtin_expect((rc < MAX_RC), true))
+    {
+      if (d_rc.compare_exchange_weak(rc, rc + 1, std::memory_order_relaxed))
+      {
+        if (__builtin_expect((rc == MAX_RC - 1), false))
+        {
+          markRefCountMaxedOut();
+        }
+        return;
+      }
+    }
+  }
+
+  void dec()
+  {
+    uint32_t rc = d_rc.load(std::memory_order_relaxed);
+    while (__builtin_expect((rc < MAX_RC), true))
+    {
+      if (__builtin_expect((rc == 1), false))
+      {
+        // the last reference is dropped by the node manager, so that it is
+        // not interleaved with zombie reclamation
+        if (tryMarkForDeletion())
+        {
+          return;
+        }
+        rc = d_rc.load(std::memory_order_relaxed);
+      }
+      else if (d_rc.compare_exchange_weak(
+                   rc, rc - 1, std::memory_order_acq_rel))
+      {
+        return;
+      }
+    }
+  }
+
+  /** Decrement the reference count from 1 to 0 and mark for deletion. */
+  bool tryMarkForDeletion();
+#else
   void inc()
   {
     if (__builtin_expect((d_rc < MAX_RC - 1), true))
@@ -314,6 +365,7 @@ class CVC5_EXPORT NodeValue
       }
     }
   }
+#endif
 
   void markRefCountMaxedOut();
   void markForDeletion();
@@ -346,8 +398,17 @@ class CVC5_EXPORT NodeValue
   /** The ID (0 is reserved for the null value) */
   uint64_t d_id : NBITS_ID;
 
+#ifdef CVC5_CONCURRENT_NODES
+  /**
+   * The expression's reference count. This is a separate atomic field (not a
+   * bit-field) so that it can be shared between threads; it is still bounded
+   * by MAX_RC.
+   */
+  std::atomic<uint32_t> d_rc;
+#else
   /** The expression's reference count. */
   uint32_t d_rc : NBITS_REFCOUNT;
+#endif
 
   /** Kind of the expression */
   uint32_t d_kind : NBITS_KIND;
@@ -100,6 +100,7 @@ Node SkolemManager::mkSkolemFunctionTyped(SkolemId id,
                                           TypeNode tn,
                                           Node cacheVal)
 {
+  NodeManager::TableLock lock(d_nm);
   std::tuple<SkolemId, TypeNode, Node> key(id, tn, cacheVal);
   std::map<std::tuple<SkolemId, TypeNode, Node>, Node>::iterator it =
       d_skolemFuns.find(key);
@@ -169,6 +170,7 @@ bool SkolemManager::isSkolemFunction(TNode k, SkolemId& id, Node& cacheVal)
   {
     return false;
   }
+  NodeManager::TableLock lock(skm->d_nm);
   std::map<Node, std::tuple<SkolemId, TypeNode, Node>>::const_iterator it =
       skm->d_skolemFunMap.find(k);
   Assert(it != skm->d_skolemFunMap.end());
@@ -353,7 +355,10 @@ Node SkolemManager::mkSkolemNode(Kind k,
   else
   {
     std::stringstream name;
-    name << prefix << '_' << ++d_skolemCounter;
+    {
+      NodeManager::TableLock lock(d_nm);
+      name << prefix << '_' << ++d_skolemCounter;
+    }
     n.setAttribute(expr::VarNameAttr(), name.str());
   }
   n.setAttribute(expr::TypeAttr(), type);
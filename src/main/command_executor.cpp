@@ -100,6 +100,7 @@ void CommandExecutor::printStatistics(std::ostream& out) const
       }
     }
   }
+  d_solver->d_slv->printInferenceProfile(out);
 }
 
 void CommandExecutor::printStatisticsSafe(int fd) const
@@ -109,6 +110,12 @@ void CommandExecutor::printStatisticsSafe(int fd) const
     d_solver->getTermManager().printStatisticsSafe(fd);
     d_solver->printStatisticsSafe(fd);
   }
+  d_solver->d_slv->printInferenceProfileSafe(fd);
+}
+
+void CommandExecutor::flushTraceEventsSafe() const
+{
+  d_solver->d_slv->flushTraceEventsSafe();
 }
 
 bool CommandExecutor::doCommand(Command* cmd)
@@ -243,6 +250,8 @@ bool CommandExecutor::solverInvoke(cvc5::Solver* solver,
 void CommandExecutor::flushOutputStreams()
 {
   printStatistics(d_solver->getDriverOptions().err());
+  // the destructors do not run on an early exit
+  d_solver->d_slv->flushTraceEvents();
 
   // make sure out and err streams are flushed too
   d_solver->getDriverOptions().out() << std::flush;
@@ -92,20 +92,27 @@ class CommandExecutor
   void setOptionInternal(const std::string& key, const std::string& value);
 
   /**
-   * Prints statistics to an output stream.
+   * Prints statistics to an output stream, followed by the inference profile
+   * if enabled.
    * Checks whether statistics should be printed according to the options.
    * Thus, this method can always be called without checking the options.
    */
   virtual void printStatistics(std::ostream& out) const;
 
   /**
-   * Safely prints statistics to a file descriptor.
+   * Safely prints statistics and the inference profile to a file descriptor.
    * This method is safe to be used within a signal handler.
    * Checks whether statistics should be printed according to the options.
    * Thus, this method can always be called without checking the options.
    */
   void printStatisticsSafe(int fd) const;
 
+  /**
+   * Writes the trace events, if enabled. This method is safe to be used within
+   * a signal handler.
+   */
+  void flushTraceEventsSafe() const;
+
   void flushOutputStreams();
 
  protected:
@@ -55,6 +55,8 @@ void print_statistics()
   if (pExecutor != nullptr)
   {
     pExecutor->printStatisticsSafe(STDERR_FILENO);
+    // the trace is otherwise only written when the solver is destroyed
+    pExecutor->flushTraceEventsSafe();
   }
 }
 
@@ -1379,6 +1379,47 @@ void SimplifyCommand::toStream(std::ostream& out) const
                                                           termToNode(d_term));
 }
 
+/* -------------------------------------------------------------------------- */
+/* class OptimizeCommand                                                      */
+/* -------------------------------------------------------------------------- */
+
+OptimizeCommand::OptimizeCommand(const cvc5::Term& term, bool minimize)
+    : d_term(term), d_minimize(minimize)
+{
+}
+cvc5::Term OptimizeCommand::getTerm() const { return d_term; }
+bool OptimizeCommand::isMinimize() const { return d_minimize; }
+void OptimizeCommand::invoke(cvc5::Solver* solver, CVC5_UNUSED SymManager* sm)
+{
+  try
+  {
+    if (d_minimize)
+    {
+      solver->minimize(d_term);
+    }
+    else
+    {
+      solver->maximize(d_term);
+    }
+    d_commandStatus = CommandSuccess::instance();
+  }
+  catch (exception& e)
+  {
+    d_commandStatus = new CommandFailure(e.what());
+  }
+}
+
+std::string OptimizeCommand::getCommandName() const
+{
+  return d_minimize ? "minimize" : "maximize";
+}
+
+void OptimizeCommand::toStream(std::ostream& out) const
+{
+  internal::Printer::getPrinter(out)->toStreamCmdOptimize(
+      out, termToNode(d_term), d_minimize);
+}
+
 /* -------------------------------------------------------------------------- */
 /* class GetValueCommand                                                      */
 /* -------------------------------------------------------------------------- */
@@ -2308,6 +2349,71 @@ void GetDifficultyCommand::toStream(std::ostream& out) const
   internal::Printer::getPrinter(out)->toStreamCmdGetDifficulty(out);
 }
 
+/* -------------------------------------------------------------------------- */
+/* class GetObjectivesCommand */
+/* -------------------------------------------------------------------------- */
+
+GetObjectivesCommand::GetObjectivesCommand() {}
+void GetObjectivesCommand::invoke(cvc5::Solver* solver,
+                                  CVC5_UNUSED SymManager* sm)
+{
+  try
+  {
+    d_result = solver->getObjectives();
+
+    d_commandStatus = CommandSuccess::instance();
+  }
+  catch (cvc5::CVC5ApiRecoverableException& e)
+  {
+    d_commandStatus = new CommandRecoverableFailure(e.what());
+  }
+  catch (exception& e)
+  {
+    d_commandStatus = new CommandFailure(e.what());
+  }
+}
+
+void GetObjectivesCommand::printResult(CVC5_UNUSED cvc5::Solver* solver,
+                                       std::ostream& out) const
+{
+  out << "(";
+  bool firstTime = true;
+  for (const auto& [target, value, status] : d_result)
+  {
+    if (firstTime)
+    {
+      firstTime = false;
+    }
+    else
+    {
+      out << " ";
+    }
+    out << "(" << target << " ";
+    if (!value.isNull())
+    {
+      out << value << " ";
+    }
+    out << status << ")";
+  }
+  out << ")" << std::endl;
+}
+
+const std::vector<std::tuple<cvc5::Term, cvc5::Term, OptimizationStatus>>&
+GetObjectivesCommand::getObjectives() const
+{
+  return d_result;
+}
+
+std::string GetObjectivesCommand::getCommandName() const
+{
+  return "get-objectives";
+}
+
+void GetObjectivesCommand::toStream(std::ostream& out) const
+{
+  internal::Printer::getPrinter(out)->toStreamCmdGetObjectives(out);
+}
+
 /* -------------------------------------------------------------------------- */
 /* class GetTimeoutCoreCommand */
 /* -------------------------------------------------------------------------- */
@@ -709,6 +709,24 @@ class CVC5_EXPORT SimplifyCommand : public Cmd
   void toStream(std::ostream& out) const override;
 }; /* class SimplifyCommand */
 
+class CVC5_EXPORT OptimizeCommand : public Cmd
+{
+ protected:
+  /** The term to optimize */
+  cvc5::Term d_term;
+  /** Whether the term is minimized (or maximized) */
+  bool d_minimize;
+
+ public:
+  OptimizeCommand(const cvc5::Term& term, bool minimize);
+
+  cvc5::Term getTerm() const;
+  bool isMinimize() const;
+  void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
+  std::string getCommandName() const override;
+  void toStream(std::ostream& out) const override;
+}; /* class OptimizeCommand */
+
 class CVC5_EXPORT GetValueCommand : public Cmd
 {
  protected:
@@ -1060,6 +1078,25 @@ class CVC5_EXPORT GetDifficultyCommand : public Cmd
   std::map<cvc5::Term, cvc5::Term> d_result;
 };
 
+class CVC5_EXPORT GetObjectivesCommand : public Cmd
+{
+ public:
+  GetObjectivesCommand();
+  const std::vector<std::tuple<cvc5::Term, cvc5::Term, OptimizationStatus>>&
+  getObjectives() const;
+
+  void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
+  void printResult(cvc5::Solver* solver, std::ostream& out) const override;
+
+  std::string getCommandName() const override;
+  void toStream(std::ostream& out) const override;
+
+ protected:
+  /** the result of the get objectives call */
+  std::vector<std::tuple<cvc5::Term, cvc5::Term, OptimizationStatus>>
+      d_result;
+};
+
 class CVC5_EXPORT GetTimeoutCoreCommand : public Cmd
 {
  public:
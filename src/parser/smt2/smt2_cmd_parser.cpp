@@ -78,9 +78,12 @@ Smt2CmdParser::Smt2CmdParser(Smt2Lexer& lex,
     d_table["get-interpolant-next"] = Token::GET_INTERPOL_NEXT_TOK;
     d_table["get-interpolant"] = Token::GET_INTERPOL_TOK;
     d_table["get-learned-literals"] = Token::GET_LEARNED_LITERALS_TOK;
+    d_table["get-objectives"] = Token::GET_OBJECTIVES_TOK;
     d_table["get-qe-disjunct"] = Token::GET_QE_DISJUNCT_TOK;
     d_table["get-qe"] = Token::GET_QE_TOK;
     d_table["include"] = Token::INCLUDE_TOK;
+    d_table["maximize"] = Token::MAXIMIZE_TOK;
+    d_table["minimize"] = Token::MINIMIZE_TOK;
     d_table["simplify"] = Token::SIMPLIFY_TOK;
   }
   if (d_lex.isSygus())
@@ -654,6 +657,13 @@ std::unique_ptr<Cmd> Smt2CmdParser::parseNextCommand()
       cmd.reset(new GetModelCommand());
     }
     break;
+    // (get-objectives)
+    case Token::GET_OBJECTIVES_TOK:
+    {
+      d_state.checkThatLogicIsSet();
+      cmd.reset(new GetObjectivesCommand);
+    }
+    break;
     // (get-option <keyword>)
     case Token::GET_OPTION_TOK:
     {
@@ -783,6 +793,16 @@ std::unique_ptr<Cmd> Smt2CmdParser::parseNextCommand()
       cmd = d_state.invConstraint(names);
     }
     break;
+    // (maximize <term>)
+    // (minimize <term>)
+    case Token::MAXIMIZE_TOK:
+    case Token::MINIMIZE_TOK:
+    {
+      d_state.checkThatLogicIsSet();
+      Term t = d_tparser.parseTerm();
+      cmd.reset(new OptimizeCommand(t, tok == Token::MINIMIZE_TOK));
+    }
+    break;
     // (pop <numeral>?)
     case Token::POP_TOK:
     {
@@ -72,6 +72,7 @@ std::ostream& operator<<(std::ostream& o, Token t)
       o << "GET_LEARNED_LITERALS_TOK";
       break;
     case Token::GET_MODEL_TOK: o << "GET_MODEL_TOK"; break;
+    case Token::GET_OBJECTIVES_TOK: o << "GET_OBJECTIVES_TOK"; break;
     case Token::GET_OPTION_TOK: o << "GET_OPTION_TOK"; break;
     case Token::GET_PROOF_TOK: o << "GET_PROOF_TOK"; break;
     case Token::GET_QE_DISJUNCT_TOK: o << "GET_QE_DISJUNCT_TOK"; break;
@@ -97,6 +98,8 @@ std::ostream& operator<<(std::ostream& o, Token t)
     case Token::LET_TOK: o << "LET_TOK"; break;
     case Token::LPAREN_TOK: o << "LPAREN_TOK"; break;
     case Token::MATCH_TOK: o << "MATCH_TOK"; break;
+    case Token::MAXIMIZE_TOK: o << "MAXIMIZE_TOK"; break;
+    case Token::MINIMIZE_TOK: o << "MINIMIZE_TOK"; break;
     case Token::NUMERAL: o << "NUMERAL"; break;
     case Token::PAR_TOK: o << "PAR_TOK"; break;
     case Token::POP_TOK: o << "POP_TOK"; break;
@@ -73,6 +73,7 @@ enum Token : uint32_t
   GET_INTERPOL_TOK,
   GET_LEARNED_LITERALS_TOK,
   GET_MODEL_TOK,
+  GET_OBJECTIVES_TOK,
   GET_OPTION_TOK,
   GET_PROOF_TOK,
   GET_QE_DISJUNCT_TOK,
@@ -93,6 +94,8 @@ enum Token : uint32_t
   LET_TOK,
   LPAREN_TOK,
   MATCH_TOK,
+  MAXIMIZE_TOK,
+  MINIMIZE_TOK,
   NUMERAL,
   PAR_TOK,
   POP_TOK,
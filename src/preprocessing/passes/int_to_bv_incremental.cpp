@@ -0,0 +1,385 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The IntToBVIncremental preprocessing pass.
+ *
+ * Attempts to find a model of a pure integer problem by bitblasting it at
+ * increasing bitwidths. The initial and maximal widths are controlled through
+ * the `--solve-int-as-bv-inc-*` command line options.
+ */
+
+#include "preprocessing/passes/int_to_bv_incremental.h"
+
+#include <algorithm>
+
+#include "expr/node_traversal.h"
+#include "expr/skolem_manager.h"
+#include "options/smt_options.h"
+#include "preprocessing/assertion_pipeline.h"
+#include "preprocessing/preprocessing_pass_context.h"
+#include "smt/set_defaults.h"
+#include "smt/solver_engine.h"
+#include "theory/logic_info.h"
+#include "theory/smt_engine_subsolver.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace preprocessing {
+namespace passes {
+
+using namespace cvc5::internal::theory;
+
+namespace {
+
+/** The number of bits of the smallest signed bit-vector that contains c */
+uint32_t getSignedWidth(const Integer& c)
+{
+  Integer a = c.sgn() >= 0 ? c : -(c + Integer(1));
+  return static_cast<uint32_t>(a.length()) + 1;
+}
+
+}  // namespace
+
+IntToBVIncremental::IntToBVIncremental(PreprocessingPassContext* preprocContext)
+    : PreprocessingPass(preprocContext, "int-to-bv-inc"),
+      d_statRounds(statisticsRegistry().registerInt("int-to-bv-inc::rounds")),
+      d_statSuccess(statisticsRegistry().registerInt("int-to-bv-inc::success")),
+      d_statGaveUp(statisticsRegistry().registerInt("int-to-bv-inc::gave-up"))
+{
+}
+
+bool IntToBVIncremental::collectVariables(TNode n,
+                                          std::unordered_set<TNode>& visited)
+{
+  std::vector<TNode> visit;
+  visit.push_back(n);
+  do
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    TypeNode tn = cur.getType();
+    if (!tn.isBoolean() && !tn.isInteger())
+    {
+      return false;
+    }
+    if (cur.isVar())
+    {
+      if (cur.getKind() == Kind::BOUND_VARIABLE)
+      {
+        return false;
+      }
+      (tn.isInteger() ? d_intVars : d_boolVars).push_back(cur);
+      continue;
+    }
+    if (cur.isConst())
+    {
+      continue;
+    }
+    switch (cur.getKind())
+    {
+      case Kind::NOT:
+      case Kind::AND:
+      case Kind::OR:
+      case Kind::IMPLIES:
+      case Kind::XOR:
+      case Kind::ITE:
+      case Kind::EQUAL:
+      case Kind::LT:
+      case Kind::LEQ:
+      case Kind::GT:
+      case Kind::GEQ:
+      case Kind::ADD:
+      case Kind::SUB:
+      case Kind::NEG:
+      case Kind::MULT:
+      case Kind::NONLINEAR_MULT: break;
+      default:
+        Trace("int-to-bv-inc") << "...unsupported term " << cur << std::endl;
+        return false;
+    }
+    visit.insert(visit.end(), cur.begin(), cur.end());
+  } while (!visit.empty());
+  return true;
+}
+
+Node IntToBVIncremental::signExtend(const Node& n, uint32_t w)
+{
+  uint32_t size = n.getType().getBitVectorSize();
+  if (size >= w)
+  {
+    return n;
+  }
+  NodeManager* nm = nodeManager();
+  Node op = nm->mkConst<BitVectorSignExtend>(BitVectorSignExtend(w - size));
+  return nm->mkNode(op, n);
+}
+
+Node IntToBVIncremental::translate(TNode n,
+                                   std::unordered_map<Node, Node>& cache)
+{
+  NodeManager* nm = nodeManager();
+  for (TNode cur :
+       NodeDfsIterable(n, VisitOrder::POSTORDER, [&cache](TNode nn) {
+         return cache.count(nn) > 0;
+       }))
+  {
+    Node res;
+    if (cur.isVar())
+    {
+      std::unordered_map<Node, Node>::const_iterator it = d_bvVars.find(cur);
+      res = it == d_bvVars.end() ? Node(cur) : it->second;
+    }
+    else if (cur.isConst())
+    {
+      res = cur;
+      if (cur.getType().isInteger())
+      {
+        const Integer& c = cur.getConst<Rational>().getNumerator();
+        res = nm->mkConst(BitVector(getSignedWidth(c), c));
+      }
+    }
+    else
+    {
+      std::vector<Node> children;
+      uint32_t max = 0;
+      for (const Node& c : cur)
+      {
+        Assert(cache.find(c) != cache.end());
+        children.push_back(cache[c]);
+        if (children.back().getType().isBitVector())
+        {
+          max = std::max(max, children.back().getType().getBitVectorSize());
+        }
+      }
+      Kind k = cur.getKind();
+      switch (k)
+      {
+        case Kind::ADD:
+        case Kind::SUB:
+        case Kind::MULT:
+        case Kind::NONLINEAR_MULT:
+        {
+          // each intermediate result is wide enough to not overflow
+          bool isMult = (k == Kind::MULT || k == Kind::NONLINEAR_MULT);
+          Kind bk = isMult ? Kind::BITVECTOR_MULT
+                           : (k == Kind::ADD ? Kind::BITVECTOR_ADD
+                                             : Kind::BITVECTOR_SUB);
+          res = children[0];
+          for (size_t i = 1, nchild = children.size(); i < nchild; ++i)
+          {
+            uint32_t sa = res.getType().getBitVectorSize();
+            uint32_t sb = children[i].getType().getBitVectorSize();
+            uint32_t w = isMult ? sa + sb : std::max(sa, sb) + 1;
+            res = nm->mkNode(bk, signExtend(res, w), signExtend(children[i], w));
+          }
+          break;
+        }
+        case Kind::NEG:
+          res = nm->mkNode(Kind::BITVECTOR_NEG, signExtend(children[0], max + 1));
+          break;
+        case Kind::LT:
+        case Kind::LEQ:
+        case Kind::GT:
+        case Kind::GEQ:
+        {
+          Kind bk = k == Kind::LT    ? Kind::BITVECTOR_SLT
+                    : k == Kind::LEQ ? Kind::BITVECTOR_SLE
+                    : k == Kind::GT  ? Kind::BITVECTOR_SGT
+                                     : Kind::BITVECTOR_SGE;
+          res = nm->mkNode(
+              bk, signExtend(children[0], max), signExtend(children[1], max));
+          break;
+        }
+        default:
+          // Boolean connectives, and equalities and ites over integers
+          Assert(max > 0 || !cur.getType().isInteger());
+          if (max > 0)
+          {
+            for (Node& c : children)
+            {
+              if (c.getType().isBitVector())
+              {
+                c = signExtend(c, max);
+              }
+            }
+          }
+          res = nm->mkNode(k, children);
+          break;
+      }
+    }
+    cache[cur] = res;
+  }
+  return cache[n];
+}
+
+PreprocessingPassResult IntToBVIncremental::applyInternal(
+    AssertionPipeline* assertionsToPreprocess)
+{
+  d_intVars.clear();
+  d_boolVars.clear();
+  std::unordered_set<TNode> visited;
+  for (const Node& a : assertionsToPreprocess->ref())
+  {
+    if (!collectVariables(a, visited))
+    {
+      return PreprocessingPassResult::NO_CONFLICT;
+    }
+  }
+  if (d_intVars.empty())
+  {
+    return PreprocessingPassResult::NO_CONFLICT;
+  }
+  NodeManager* nm = nodeManager();
+  uint32_t maxWidth =
+      static_cast<uint32_t>(options().smt.solveIntAsBVIncMax);
+  uint32_t startWidth = std::min(
+      static_cast<uint32_t>(options().smt.solveIntAsBVIncStart), maxWidth);
+  std::unordered_map<Node, uint32_t> widths;
+  for (const Node& v : d_intVars)
+  {
+    widths[v] = startWidth;
+  }
+  Options subOptions;
+  subOptions.copyValues(options());
+  subOptions.write_smt().solveIntAsBVInc = false;
+  subOptions.write_smt().produceModels = true;
+  subOptions.write_smt().unsatAssumptions = true;
+  smt::SetDefaults::disableChecking(subOptions);
+  LogicInfo subLogic("QF_BV");
+  SubsolverSetupInfo ssi(subOptions, subLogic);
+  // each round is limited, since the bit-blasted problems grow with the
+  // widths
+  uint64_t timeout = options().smt.solveIntAsBVIncTimeout;
+  uint64_t rlimit = options().smt.solveIntAsBVIncRlimit;
+  while (true)
+  {
+    ++d_statRounds;
+    // a variable x of width w is a bit-vector of width w + 1, guarded by the
+    // assumption that it fits into w bits
+    d_bvVars.clear();
+    std::unordered_map<Node, Node> guards;
+    std::vector<Node> assumptions;
+    for (const Node& v : d_intVars)
+    {
+      uint32_t w = widths[v];
+      Node bv = NodeManager::mkDummySkolem("__intToBVInc_var",
+                                           nm->mkBitVectorType(w + 1));
+      d_bvVars[v] = bv;
+      Node ext = nm->mkNode(nm->mkConst(BitVectorExtract(w - 1, 0)), bv);
+      Node guard = bv.eqNode(signExtend(ext, w + 1));
+      guards[guard] = v;
+      assumptions.push_back(guard);
+    }
+    std::unique_ptr<SolverEngine> subsolver;
+    initializeSubsolver(nm, subsolver, ssi, timeout != 0, timeout);
+    if (rlimit != 0)
+    {
+      subsolver->setResourceLimit(rlimit);
+    }
+    std::unordered_map<Node, Node> cache;
+    for (const Node& a : assertionsToPreprocess->ref())
+    {
+      subsolver->assertFormula(translate(a, cache));
+    }
+    Result r = subsolver->checkSat(assumptions);
+    Trace("int-to-bv-inc") << "IntToBVIncremental: " << r << " with widths";
+    for (const Node& v : d_intVars)
+    {
+      Trace("int-to-bv-inc") << " " << v << ":" << widths[v];
+    }
+    Trace("int-to-bv-inc") << std::endl;
+    if (r.getStatus() == Result::SAT)
+    {
+      std::vector<Node> vars = d_intVars;
+      std::vector<Node> values;
+      for (const Node& v : d_intVars)
+      {
+        Node bvv = subsolver->getValue(d_bvVars[v]);
+        Rational c(bvv.getConst<BitVector>().toSignedInteger());
+        values.push_back(nm->mkConstInt(c));
+      }
+      for (const Node& v : d_boolVars)
+      {
+        vars.push_back(v);
+        values.push_back(subsolver->getValue(v));
+      }
+      // verify the model, and replace the assertions by true
+      for (const Node& a : assertionsToPreprocess->ref())
+      {
+        Node sa = rewrite(a.substitute(
+            vars.begin(), vars.end(), values.begin(), values.end()));
+        if (!sa.isConst() || !sa.getConst<bool>())
+        {
+          Trace("int-to-bv-inc") << "...model does not satisfy " << a
+                                 << std::endl;
+          return PreprocessingPassResult::NO_CONFLICT;
+        }
+      }
+      ++d_statSuccess;
+      for (size_t i = 0, nvars = vars.size(); i < nvars; ++i)
+      {
+        d_preprocContext->addSubstitution(vars[i], values[i]);
+      }
+      Node tnode = nm->mkConst(true);
+      for (size_t i = 0, size = assertionsToPreprocess->size(); i < size; ++i)
+      {
+        assertionsToPreprocess->replace(i, tnode);
+      }
+      return PreprocessingPassResult::NO_CONFLICT;
+    }
+    if (r.getStatus() != Result::UNSAT)
+    {
+      // the round ran out of time or resources, or the subsolver failed,
+      // hence we solve the problem as usual
+      Trace("int-to-bv-inc") << "...giving up" << std::endl;
+      ++d_statGaveUp;
+      return PreprocessingPassResult::NO_CONFLICT;
+    }
+    // grow the widths of the variables whose guards are in the core, or of
+    // all variables if there are none, since then the additional bit of each
+    // variable may be too small as well
+    std::vector<Node> grow;
+    for (const Node& u : subsolver->getUnsatAssumptions())
+    {
+      std::unordered_map<Node, Node>::const_iterator it = guards.find(u);
+      if (it != guards.end())
+      {
+        grow.push_back(it->second);
+      }
+    }
+    if (grow.empty())
+    {
+      grow = d_intVars;
+    }
+    bool changed = false;
+    for (const Node& v : grow)
+    {
+      if (widths[v] < maxWidth)
+      {
+        widths[v] = std::min(2 * widths[v], maxWidth);
+        changed = true;
+      }
+    }
+    if (!changed)
+    {
+      Trace("int-to-bv-inc") << "...maximal width reached" << std::endl;
+      return PreprocessingPassResult::NO_CONFLICT;
+    }
+  }
+}
+
+}  // namespace passes
+}  // namespace preprocessing
+}  // namespace cvc5::internal
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The IntToBVIncremental preprocessing pass.
+ *
+ * Attempts to find a model of a pure integer problem by bitblasting it at
+ * increasing bitwidths. The initial and maximal widths are controlled through
+ * the `--solve-int-as-bv-inc-*` command line options.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PREPROCESSING__PASSES__INT_TO_BV_INCREMENTAL_H
+#define CVC5__PREPROCESSING__PASSES__INT_TO_BV_INCREMENTAL_H
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "expr/node.h"
+#include "preprocessing/preprocessing_pass.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace preprocessing {
+namespace passes {
+
+/**
+ * Searches for a model of the assertions by encoding them as bit-vector
+ * constraints, in which each integer variable x is restricted to a width w_x
+ * and all intermediate terms have a width large enough to not overflow.
+ *
+ * Each variable x is encoded by a bit-vector of width w_x + 1, together with
+ * a guard that states that its value fits into w_x bits. The encoding is
+ * solved by a subsolver under the guards as assumptions. If it is
+ * satisfiable, the model is an integer model of the assertions, which are
+ * then replaced by true and the variables are substituted by their values.
+ * If it is unsatisfiable and the unsat assumptions contain guards, this may
+ * be due to the bounds on the variables of these guards, whose widths are
+ * doubled. If they contain no guards, the widths of all variables are
+ * doubled. This is repeated until a model is found or the widths reach
+ * solveIntAsBVIncMax, in which case the assertions are left unchanged. The
+ * same holds if a round exceeds the limits given by solveIntAsBVIncTimeout
+ * and solveIntAsBVIncRlimit.
+ *
+ * Unlike IntToBV, this pass never changes satisfiability, and hence is not
+ * refutation unsound. It does nothing if the assertions contain terms other
+ * than integer and Boolean variables, constants, linear and non-linear
+ * integer arithmetic and Boolean connectives.
+ */
+class IntToBVIncremental : public PreprocessingPass
+{
+ public:
+  IntToBVIncremental(PreprocessingPassContext* preprocContext);
+
+ protected:
+  PreprocessingPassResult applyInternal(
+      AssertionPipeline* assertionsToPreprocess) override;
+
+ private:
+  /**
+   * Collect the integer and Boolean variables of n into d_intVars and
+   * d_boolVars, where visited are the terms that were already collected.
+   * Returns false if n contains a term that is not supported.
+   */
+  bool collectVariables(TNode n, std::unordered_set<TNode>& visited);
+  /**
+   * Translate n to a bit-vector term or a Boolean formula, where the integer
+   * variables are mapped to the terms in d_bvVars.
+   */
+  Node translate(TNode n, std::unordered_map<Node, Node>& cache);
+  /** Sign extend the bit-vector term n to width w */
+  Node signExtend(const Node& n, uint32_t w);
+  /** The integer variables of the assertions */
+  std::vector<Node> d_intVars;
+  /** The Boolean variables of the assertions */
+  std::vector<Node> d_boolVars;
+  /** The bit-vector variables for d_intVars in the current round */
+  std::unordered_map<Node, Node> d_bvVars;
+  /** Number of calls to the subsolver */
+  IntStat d_statRounds;
+  /** Number of problems for which a model was found */
+  IntStat d_statSuccess;
+  /** Number of rounds that ran out of time or resources */
+  IntStat d_statGaveUp;
+};
+
+}  // namespace passes
+}  // namespace preprocessing
+}  // namespace cvc5::internal
+
+#endif /* CVC5__PREPROCESSING__PASSES__INT_TO_BV_INCREMENTAL_H */
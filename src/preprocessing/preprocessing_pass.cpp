@@ -20,6 +20,7 @@
 #include "smt/env.h"
 #include "theory/trust_substitutions.h"
 #include "util/statistics_stats.h"
+#include "util/trace_events.h"
 
 namespace cvc5::internal {
 namespace preprocessing {
@@ -28,6 +29,7 @@ PreprocessingPassResult PreprocessingPass::apply(
     AssertionPipeline* assertionsToPreprocess)
 {
   TimerStat::CodeTimer codeTimer(d_timer);
+  TraceEventScope traceEvent(d_env.getTraceEvents(), "preprocess", d_name);
   Trace("preprocessing") << "PRE " << d_name << std::endl;
   verbose(2) << d_name << "..." << std::endl;
   PreprocessingPassResult result = applyInternal(assertionsToPreprocess);
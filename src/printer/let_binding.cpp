@@ -30,6 +30,7 @@ LetBinding::LetBinding(const std::string& prefix,
       d_visitList(&d_context),
       d_count(&d_context),
       d_letList(&d_context),
+      d_trackNewLetTerms(false),
       d_letMap(&d_context)
 {
 }
@@ -60,12 +61,34 @@ void LetBinding::letify(Node n, std::vector<Node>& letList)
 void LetBinding::letify(std::vector<Node>& letList)
 {
   size_t prevSize = d_letList.size();
-  // populate the d_letList and d_letMap
+  // populate the d_letList and d_letMap, which subsumes the new let terms
   convertCountToLet();
+  d_newLetTerms.clear();
   // add the new entries to the letList
   letList.insert(letList.end(), d_letList.begin() + prevSize, d_letList.end());
 }
 
+void LetBinding::getNewLetTerms(std::vector<Node>& terms)
+{
+  terms.insert(terms.end(), d_newLetTerms.begin(), d_newLetTerms.end());
+  d_newLetTerms.clear();
+}
+
+void LetBinding::setTrackNewLetTerms(bool val) { d_trackNewLetTerms = val; }
+
+uint32_t LetBinding::bind(Node n)
+{
+  uint32_t id = getId(n);
+  if (id == 0)
+  {
+    d_letList.push_back(n);
+    // start with id 1
+    id = d_letMap.size() + 1;
+    d_letMap[n] = id;
+  }
+  return id;
+}
+
 void LetBinding::pushScope() { d_context.push(); }
 
 void LetBinding::popScope() { d_context.pop(); }
@@ -200,11 +223,18 @@ void LetBinding::updateCounts(Node n)
     }
     else
     {
-      if ((*it).second == 0)
+      // when tracking new let terms, the terms are bound by the user and
+      // d_visitList is never converted, hence we do not store it
+      if ((*it).second == 0 && !d_trackNewLetTerms)
       {
         d_visitList.push_back(cur);
       }
-      d_count[cur] = (*it).second + 1;
+      uint32_t count = (*it).second + 1;
+      d_count[cur] = count;
+      if (d_trackNewLetTerms && count == d_thresh)
+      {
+        d_newLetTerms.push_back(cur);
+      }
       visit.pop_back();
     }
   } while (!visit.empty());
@@ -124,6 +124,34 @@ class LetBinding
    * Same as above, without a node to letify.
    */
   void letify(std::vector<Node>& letList);
+  /**
+   * Get the terms whose count reached the threshold since the last call to
+   * this method or to letify. Unlike letify, this does not traverse all terms
+   * processed so far, and does not assign identifiers. It is intended for
+   * introducing let bindings incrementally, e.g. when printing a stream of
+   * terms: the caller defines each returned term that does not yet have an
+   * identifier, and then calls bind on it. Definitions must be printed in the
+   * order of calls to bind, since the definition of a term may use the
+   * identifiers of terms bound before it.
+   *
+   * Terms are only recorded for this method after a call to
+   * setTrackNewLetTerms(true).
+   *
+   * @param terms The list to add the terms to.
+   */
+  void getNewLetTerms(std::vector<Node>& terms);
+  /**
+   * Set whether we record terms for getNewLetTerms. While this is true, the
+   * processed terms are not recorded for letify, which hence only assigns
+   * identifiers to the terms processed before. This ensures that we only
+   * store one count per term when letifying a stream of terms.
+   */
+  void setTrackNewLetTerms(bool val);
+  /**
+   * Assign the next identifier to n, if it does not already have one.
+   * @return the identifier for n.
+   */
+  uint32_t bind(Node n);
   /** Push scope */
   void pushScope();
   /** Pop scope for n, reverts the state change of the above method */
@@ -172,6 +200,10 @@ class LetBinding
   NodeIdMap d_count;
   /** The let list */
   NodeList d_letList;
+  /** Whether we record terms in d_newLetTerms */
+  bool d_trackNewLetTerms;
+  /** Terms whose count reached the threshold, see getNewLetTerms */
+  std::vector<Node> d_newLetTerms;
 
  protected:
   /** The let map */
@@ -445,6 +445,13 @@ void Printer::toStreamCmdSimplify(std::ostream& out, CVC5_UNUSED Node n) const
   printUnknownCommand(out, "simplify");
 }
 
+void Printer::toStreamCmdOptimize(std::ostream& out,
+                                  CVC5_UNUSED Node n,
+                                  bool minimize) const
+{
+  printUnknownCommand(out, minimize ? "minimize" : "maximize");
+}
+
 void Printer::toStreamCmdGetValue(
     std::ostream& out, CVC5_UNUSED const std::vector<Node>& nodes) const
 {
@@ -538,6 +545,11 @@ void Printer::toStreamCmdGetDifficulty(std::ostream& out) const
   printUnknownCommand(out, "get-difficulty");
 }
 
+void Printer::toStreamCmdGetObjectives(std::ostream& out) const
+{
+  printUnknownCommand(out, "get-objectives");
+}
+
 void Printer::toStreamCmdGetTimeoutCore(std::ostream& out) const
 {
   printUnknownCommand(out, "get-timeout-core");
@@ -229,6 +229,11 @@ class CVC5_EXPORT Printer
   /** Print simplify command */
   virtual void toStreamCmdSimplify(std::ostream& out, Node n) const;
 
+  /** Print minimize or maximize command */
+  virtual void toStreamCmdOptimize(std::ostream& out,
+                                   Node n,
+                                   bool minimize) const;
+
   /** Print get-value command */
   virtual void toStreamCmdGetValue(std::ostream& out,
                                    const std::vector<Node>& nodes) const;
@@ -290,6 +295,9 @@ class CVC5_EXPORT Printer
   /** Print get-difficulty command */
   virtual void toStreamCmdGetDifficulty(std::ostream& out) const;
 
+  /** Print get-objectives command */
+  virtual void toStreamCmdGetObjectives(std::ostream& out) const;
+
   /** Print get-timeout-core command */
   virtual void toStreamCmdGetTimeoutCore(std::ostream& out) const;
 
@@ -1937,6 +1937,13 @@ void Smt2Printer::toStreamCmdSimplify(std::ostream& out, Node n) const
   out << "(simplify " << n << ')';
 }
 
+void Smt2Printer::toStreamCmdOptimize(std::ostream& out,
+                                      Node n,
+                                      bool minimize) const
+{
+  out << (minimize ? "(minimize " : "(maximize ") << n << ')';
+}
+
 void Smt2Printer::toStreamCmdGetValue(std::ostream& out,
                                       const std::vector<Node>& nodes) const
 {
@@ -2020,6 +2027,11 @@ void Smt2Printer::toStreamCmdGetDifficulty(std::ostream& out) const
   out << "(get-difficulty)";
 }
 
+void Smt2Printer::toStreamCmdGetObjectives(std::ostream& out) const
+{
+  out << "(get-objectives)";
+}
+
 void Smt2Printer::toStreamCmdGetTimeoutCore(std::ostream& out) const
 {
   out << "(get-timeout-core)";
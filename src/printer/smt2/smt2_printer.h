@@ -177,6 +177,11 @@ class Smt2Printer : public cvc5::internal::Printer
   /** Print simplify command */
   void toStreamCmdSimplify(std::ostream& out, Node nodes) const override;
 
+  /** Print minimize or maximize command */
+  void toStreamCmdOptimize(std::ostream& out,
+                           Node n,
+                           bool minimize) const override;
+
   /** Print get-value command */
   void toStreamCmdGetValue(std::ostream& out,
                            const std::vector<Node>& n) const override;
@@ -235,6 +240,9 @@ class Smt2Printer : public cvc5::internal::Printer
   /** Print get-difficulty command */
   void toStreamCmdGetDifficulty(std::ostream& out) const override;
 
+  /** Print get-objectives command */
+  void toStreamCmdGetObjectives(std::ostream& out) const override;
+
   /** Print get-timeout-core command */
   void toStreamCmdGetTimeoutCore(std::ostream& out) const override;
 
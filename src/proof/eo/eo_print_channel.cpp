@@ -188,6 +188,78 @@ void EoPrintChannelOut::printTypeNodeInternal(std::ostream& out, TypeNode tn)
   tn.toStream(out);
 }
 
+EoPrintChannelStream::EoPrintChannelStream(std::ostream& out,
+                                           LetBinding* lbind,
+                                           const std::string& tprefix,
+                                           bool trackWarn)
+    : EoPrintChannelOut(out, lbind, tprefix, trackWarn),
+      d_lbindStream(lbind),
+      d_termLetPrefix(tprefix)
+{
+  Assert(d_lbindStream != nullptr);
+  d_lbindStream->setTrackNewLetTerms(true);
+}
+
+void EoPrintChannelStream::printAssume(TNode n, size_t i, bool isPush)
+{
+  printDefinitions(n);
+  EoPrintChannelOut::printAssume(n, i, isPush);
+}
+
+void EoPrintChannelStream::printStep(const std::string& rname,
+                                     TNode n,
+                                     size_t i,
+                                     const std::vector<size_t>& premises,
+                                     const std::vector<Node>& args,
+                                     bool isPop)
+{
+  printDefinitions(n);
+  for (const Node& a : args)
+  {
+    printDefinitions(a);
+  }
+  EoPrintChannelOut::printStep(rname, n, i, premises, args, isPop);
+}
+
+void EoPrintChannelStream::printTrustStep(ProofRule r,
+                                          TNode n,
+                                          size_t i,
+                                          const std::vector<size_t>& premises,
+                                          const std::vector<Node>& args,
+                                          TNode nc)
+{
+  printDefinitions(nc);
+  EoPrintChannelOut::printTrustStep(r, n, i, premises, args, nc);
+}
+
+void EoPrintChannelStream::printDefinitions(const Node& n)
+{
+  if (n.isNull())
+  {
+    return;
+  }
+  d_lbindStream->process(n);
+  std::vector<Node> terms;
+  d_lbindStream->getNewLetTerms(terms);
+  std::ostream& out = getOStream();
+  for (const Node& t : terms)
+  {
+    if (d_lbindStream->getId(t) != 0)
+    {
+      continue;
+    }
+    // print the body before binding t, so that it may only refer to the
+    // definitions printed so far
+    std::stringstream body;
+    // inherit the print options of the output stream
+    body.copyfmt(out);
+    Printer::getPrinter(out)->toStream(body, t, d_lbindStream, false);
+    // use define command which does not invoke type checking
+    out << "(define " << d_termLetPrefix << d_lbindStream->bind(t) << " () "
+        << body.str() << ")" << std::endl;
+  }
+}
+
 EoPrintChannelPre::EoPrintChannelPre(LetBinding* lbind) : d_lbind(lbind) {}
 
 void EoPrintChannelPre::printNode(TNode n)
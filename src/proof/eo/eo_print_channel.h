@@ -30,6 +30,8 @@ namespace proof {
  * letification of terms in the proof as well as other information that is
  * required for printing the preamble of the proof. The second phase prints the
  * proof to an output stream. This is the base class for these two phases.
+ * With --proof-print-stream, the first phase is skipped and
+ * EoPrintChannelStream letifies terms while printing.
  */
 class EoPrintChannel
 {
@@ -127,6 +129,48 @@ class EoPrintChannelOut : public EoPrintChannel
   bool d_trackWarn;
 };
 
+/**
+ * Prints the proof to an output stream in a single phase. Instead of relying
+ * on a letification computed for the entire proof beforehand, this channel
+ * letifies the terms of each assumption and step when it is printed, and
+ * prints the definitions of terms that have now occurred often enough just
+ * before it. Hence, the let binding only has to be computed for the part of
+ * the proof that has been printed so far, at the cost of printing the first
+ * occurrences of shared terms in full.
+ */
+class EoPrintChannelStream : public EoPrintChannelOut
+{
+ public:
+  EoPrintChannelStream(std::ostream& out,
+                       LetBinding* lbind,
+                       const std::string& tprefix,
+                       bool trackWarn);
+  void printAssume(TNode n, size_t i, bool isPush) override;
+  void printStep(const std::string& rname,
+                 TNode n,
+                 size_t i,
+                 const std::vector<size_t>& premises,
+                 const std::vector<Node>& args,
+                 bool isPop = false) override;
+  void printTrustStep(ProofRule r,
+                      TNode n,
+                      size_t i,
+                      const std::vector<size_t>& premises,
+                      const std::vector<Node>& args,
+                      TNode conc) override;
+
+ private:
+  /**
+   * Process n for letification, and print the definitions of its subterms
+   * that have reached the let threshold.
+   */
+  void printDefinitions(const Node& n);
+  /** The let binding, which we update as we print */
+  LetBinding* d_lbindStream;
+  /** term prefix */
+  std::string d_termLetPrefix;
+};
+
 /**
  * Run on the proof before it is printed, and does two preparation steps:
  * - Computes the letification of nodes that appear in the proof.
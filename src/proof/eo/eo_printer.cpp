@@ -58,7 +58,10 @@ EoPrinter::EoPrinter(Env& env,
       // utility.
       d_lbind(d_termLetPrefix, letThresh, true, true),
       d_lbindUse(options().proof.proofDagGlobal ? &d_lbind : nullptr),
-      d_eletify(d_lbindUse)
+      d_eletify(d_lbindUse),
+      // streaming introduces definitions through the let binding, hence it
+      // is only possible if we use one
+      d_stream(options().proof.proofPrintStream && d_lbindUse != nullptr)
 {
   d_pfType = nodeManager()->mkSort("proofType");
   d_false = nodeManager()->mkConst(false);
@@ -847,6 +850,13 @@ void EoPrinter::print(std::ostream& out,
   options::ioutils::applyOutputLanguage(out, Language::LANG_SMTLIB_V2_6);
   options::ioutils::applyPrintArithLitToken(out, true);
   options::ioutils::applyPrintSkolemDefinitions(out, true);
+  if (d_stream)
+  {
+    // print term definitions when they are first needed, see print below
+    EoPrintChannelStream sprint(out, d_lbindUse, d_termLetPrefix, true);
+    print(sprint, pfn, psm);
+    return;
+  }
   // allocate a print channel
   EoPrintChannelOut aprint(out, d_lbindUse, d_termLetPrefix, true);
   print(aprint, pfn, psm);
@@ -889,7 +899,10 @@ void EoPrinter::print(EoPrintChannelOut& aout,
       ascope != nullptr ? ascope->getArguments() : d_emptyVec;
 
   bool wasAlloc;
-  for (size_t i = 0; i < 2; i++)
+  // When streaming, we skip the first pass that letifies the entire proof.
+  // Instead, the print channel introduces term definitions while printing,
+  // and each step is written to the output as soon as it is printed.
+  for (size_t i = d_stream ? 1 : 0; i < 2; i++)
   {
     EoPrintChannel* ao;
     if (i == 0)
@@ -918,7 +931,10 @@ void EoPrinter::print(EoPrintChannelOut& aout,
         out << outDef.str();
       }
       // [3] print proof-level term bindings
-      printLetList(out, d_lbind);
+      if (!d_stream)
+      {
+        printLetList(out, d_lbind);
+      }
     }
     // [4] print (unique) assumptions, including definitions
     std::unordered_set<Node> processed;
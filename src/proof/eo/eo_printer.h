@@ -55,7 +55,9 @@ class EoPrinter : protected EnvObj
              std::shared_ptr<ProofNode> pfn,
              ProofScopeMode psm = ProofScopeMode::DEFINITIONS_AND_ASSERTIONS);
   /**
-   * Same as above, but with a Eunoia print channel.
+   * Same as above, but with a Eunoia print channel. If proofs are printed in
+   * a single pass (see d_stream), out must be an EoPrintChannelStream, since
+   * otherwise the term definitions are not printed.
    * @param out The output stream.
    * @param pfn The proof node.
    * @param psm The scope mode.
@@ -204,6 +206,12 @@ class EoPrinter : protected EnvObj
   LetBinding* d_lbindUse;
   /** The letification channel. */
   EoPrintChannelPre d_eletify;
+  /**
+   * Whether we print in a single pass, i.e. proofPrintStream is true and we
+   * use a let binding. The print(ostream&, ...) method then uses an
+   * EoPrintChannelStream.
+   */
+  bool d_stream;
   /** A cache for explicit type-of variables, for printing DSL_REWRITE steps */
   std::map<ProofRewriteRule, std::vector<Node>> d_explicitTypeOf;
 };
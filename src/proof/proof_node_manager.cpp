@@ -12,6 +12,7 @@
 
 #include "proof/proof_node_manager.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "options/proof_options.h"
@@ -20,16 +21,24 @@
 #include "proof/proof_node.h"
 #include "proof/proof_node_algorithm.h"
 #include "theory/rewriter.h"
+#include "util/hash.h"
+#include "util/statistics_registry.h"
 
 using namespace cvc5::internal::kind;
 
 namespace cvc5::internal {
 
-ProofNodeManager::ProofNodeManager(NodeManager* nm,
+ProofNodeManager::ProofNodeManager(StatisticsRegistry& sr,
+                                   NodeManager* nm,
                                    const Options& opts,
                                    theory::Rewriter* rr,
                                    ProofChecker* pc)
-    : d_opts(opts), d_rewriter(rr), d_checker(pc)
+    : d_opts(opts),
+      d_rewriter(rr),
+      d_checker(pc),
+      d_internPurgeLimit(1024),
+      d_internReuse(sr.registerHistogram<ProofRule>(
+          "ProofNodeManager::internReuse"))
 {
   d_true = nm->mkConst(true);
   // we always allocate a proof checker, regardless of the proof checking mode
@@ -44,6 +53,27 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
 {
   Trace("pnm") << "ProofNodeManager::mkNode " << id << " {" << expected.getId()
                << "} " << expected << "\n";
+  bool intern = d_opts.proof.proofIntern && isInternable(id, children);
+  InternKey key;
+  if (intern)
+  {
+    key.d_rule = id;
+    key.d_args = args;
+    auto it = d_interned.find(key);
+    if (it != d_interned.end())
+    {
+      std::shared_ptr<ProofNode> pn = it->second.d_node.lock();
+      // the conclusion may differ if the step was not checked
+      if (pn != nullptr && (expected.isNull() || pn->getResult() == expected))
+      {
+        Trace("pnm-intern") << "ProofNodeManager::mkNode: reuse " << id
+                            << std::endl;
+        d_internReuse << id;
+        it->second.d_shared = true;
+        return pn;
+      }
+    }
+  }
   bool didCheck = false;
   Node res = checkInternal(id, children, args, expected, didCheck);
   if (res.isNull())
@@ -56,6 +86,19 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
       std::make_shared<ProofNode>(id, children, args);
   pn->d_proven = res;
   pn->d_provenChecked = didCheck;
+  if (intern)
+  {
+    d_interned[key] = InternEntry{pn, false};
+    if (d_interned.size() >= d_internPurgeLimit)
+    {
+      for (auto it = d_interned.begin(); it != d_interned.end();)
+      {
+        it = it->second.d_node.expired() ? d_interned.erase(it)
+                                         : std::next(it);
+      }
+      d_internPurgeLimit = std::max<size_t>(1024, 2 * d_interned.size());
+    }
+  }
   return pn;
 }
 
@@ -394,6 +437,28 @@ bool ProofNodeManager::updateNodeInternal(
     bool needsCheck)
 {
   Assert(pn != nullptr);
+  if (d_opts.proof.proofIntern
+      && isInternable(pn->getRule(), pn->getChildren()))
+  {
+    InternKey key;
+    key.d_rule = pn->getRule();
+    key.d_args = pn->getArguments();
+    auto it = d_interned.find(key);
+    if (it != d_interned.end() && it->second.d_node.lock().get() == pn)
+    {
+      if (it->second.d_shared)
+      {
+        // Updating pn in place would change the other proofs that contain
+        // it. Interned leaves are closed proofs of their conclusion, hence
+        // keeping pn is a valid update.
+        Trace("pnm-intern") << "ProofNodeManager::updateNode: keep shared "
+                            << pn->getRule() << std::endl;
+        return true;
+      }
+      // pn is no longer handed out by mkNode, since it changes below
+      d_interned.erase(it);
+    }
+  }
   // ---------------- check for cyclic
   if (d_opts.proof.proofCheck == options::ProofCheckMode::EAGER)
   {
@@ -445,4 +510,26 @@ bool ProofNodeManager::updateNodeInternal(
   return true;
 }
 
+bool ProofNodeManager::InternKey::operator==(const InternKey& k) const
+{
+  return d_rule == k.d_rule && d_args == k.d_args;
+}
+
+size_t ProofNodeManager::InternKeyHashFunction::operator()(
+    const InternKey& k) const
+{
+  uint64_t ret = fnv1a::fnv1a_64(static_cast<size_t>(k.d_rule));
+  for (const Node& a : k.d_args)
+  {
+    ret = fnv1a::fnv1a_64(std::hash<Node>()(a), ret);
+  }
+  return static_cast<size_t>(ret);
+}
+
+bool ProofNodeManager::isInternable(
+    ProofRule id, const std::vector<std::shared_ptr<ProofNode>>& children)
+{
+  return children.empty() && id == ProofRule::REFL;
+}
+
 }  // namespace cvc5::internal
@@ -15,17 +15,21 @@
 #ifndef CVC5__PROOF__PROOF_NODE_MANAGER_H
 #define CVC5__PROOF__PROOF_NODE_MANAGER_H
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "cvc5/cvc5_proof_rule.h"
 #include "expr/node.h"
 #include "proof/trust_id.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
 class ProofChecker;
 class ProofNode;
 class Options;
+class StatisticsRegistry;
 
 namespace theory {
 class Rewriter;
@@ -49,15 +53,22 @@ class Rewriter;
  * unchanged and updates (if possible) the remaining content of a given proof
  * node.
  *
- * Notice that ProofNode objects are mutable, and hence this class does not
- * cache the results of mkNode. A version of this class that caches
- * immutable version of ProofNode objects could be built as an extension
- * or layer on top of this class.
+ * Notice that ProofNode objects are mutable, and hence by default this class
+ * does not cache the results of mkNode. If proofIntern is enabled, mkNode
+ * hash-conses the REFL steps it constructs by their arguments, so that
+ * identical ones constructed by different theories are shared. Other steps
+ * are never shared: updating them in place, e.g. when the free assumptions of
+ * a SCOPE are connected to their proofs or when the post-processor expands a
+ * macro step, would change all proofs containing them. A REFL step is a
+ * closed proof that never needs to be expanded, so updateNode leaves a shared
+ * one unchanged. An interned step that was not shared yet is removed from
+ * the table when it is updated.
  */
 class ProofNodeManager
 {
  public:
-  ProofNodeManager(NodeManager* nm,
+  ProofNodeManager(StatisticsRegistry& sr,
+                   NodeManager* nm,
                    const Options& opts,
                    theory::Rewriter* rr,
                    ProofChecker* pc = nullptr);
@@ -211,6 +222,34 @@ class ProofNodeManager
   ProofChecker* d_checker;
   /** the true node */
   Node d_true;
+  /** The key of an interned leaf: its rule and arguments. */
+  struct InternKey
+  {
+    ProofRule d_rule;
+    std::vector<Node> d_args;
+    bool operator==(const InternKey& k) const;
+  };
+  struct InternKeyHashFunction
+  {
+    size_t operator()(const InternKey& k) const;
+  };
+  /** An interned leaf */
+  struct InternEntry
+  {
+    /** The leaf, which is weak so that interning does not extend its life */
+    std::weak_ptr<ProofNode> d_node;
+    /** Whether the leaf was handed out by mkNode more than once */
+    bool d_shared = false;
+  };
+  /** The interned leaves, if proofIntern is enabled. */
+  std::unordered_map<InternKey, InternEntry, InternKeyHashFunction> d_interned;
+  /** The size of d_interned above which expired entries are purged. */
+  size_t d_internPurgeLimit;
+  /** The number of times an interned leaf was reused, per rule */
+  HistogramStat<ProofRule> d_internReuse;
+  /** Can steps with the given rule and children be interned? */
+  static bool isInternable(
+      ProofRule id, const std::vector<std::shared_ptr<ProofNode>>& children);
   /** Check internal
    *
    * This returns the result of proof checking a ProofNode with the provided
@@ -31,6 +31,7 @@
 #include "util/resource_manager.h"
 #include "util/statistics_registry.h"
 #include "util/string.h"
+#include "util/trace_events.h"
 
 namespace cvc5::internal::prop {
 using namespace cadical;
@@ -153,6 +154,7 @@ SatValue CadicalSolver::_solve(const std::vector<SatLiteral>& assumptions)
     d_propagator->renotify_fixed();
   }
   TimerStat::CodeTimer codeTimer(d_statistics.d_solveTime);
+  TraceEventScope traceEvent(d_env.getTraceEvents(), "sat", "solve");
   d_assumptions.clear();
   if (d_propagator)
   {
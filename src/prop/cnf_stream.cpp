@@ -24,6 +24,7 @@
 #include "smt/env.h"
 #include "theory/theory.h"
 #include "theory/theory_engine.h"
+#include "util/trace_events.h"
 
 namespace cvc5::internal {
 namespace prop {
@@ -765,6 +766,7 @@ void CnfStream::convertAndAssert(TNode node, bool removable, bool negated)
                << ", removable = " << (removable ? "true" : "false") << ")\n";
   d_removable = removable;
   TimerStat::CodeTimer codeTimer(d_stats.d_cnfConversionTime, true);
+  TraceEventScope traceEvent(d_env.getTraceEvents(), "cnf", "convertAndAssert");
   convertAndAssert(node, negated);
 }
 
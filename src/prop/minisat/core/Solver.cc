@@ -35,6 +35,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "prop/minisat/minisat.h"
 #include "prop/minisat/mtl/Sort.h"
 #include "prop/theory_proxy.h"
+#include "theory/inference_profiler.h"
+#include "util/trace_events.h"
 
 using namespace cvc5::internal::prop;
 
@@ -141,6 +143,7 @@ Solver::Solver(Env& env,
       assertionLevel(0),
       d_pfManager(nullptr),
       d_enable_incremental(enableIncremental),
+      d_infProfiler(env.getInferenceProfiler()),
       minisat_busy(false)
       // Parameters (user settable):
       //
@@ -462,6 +465,9 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
       lemmas.push();
       ps.copyTo(lemmas.last());
       lemmas_removable.push(removable);
+      lemmas_id.push(d_infProfiler != nullptr
+                         ? d_infProfiler->getCurrentLemma()
+                         : theory::InferenceId::NONE);
     } else {
       Assert(decisionLevel() == 0);
 
@@ -497,6 +503,10 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
         cr = ca.alloc(clauseLevel, ps, false);
         clauses_persistent.push(cr);
         attachClause(cr);
+        if (d_infProfiler != nullptr)
+        {
+          tagClause(cr, d_infProfiler->getCurrentLemma());
+        }
         if (needProof() && clauseLevel < assertionLevel)
         {
           if (TraceIsOn("pf::sat"))
@@ -870,6 +880,10 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 
         if (c.removable()) claBumpActivity(c);
       }
+      if (d_infProfiler != nullptr)
+      {
+        notifyClauseUse(confl, true);
+      }
 
         if (TraceIsOn("pf::sat"))
         {
@@ -1338,8 +1352,13 @@ CRef Solver::propagateBool()
                 // Copy the remaining watches:
                 while (i < end)
                     *j++ = *i++;
-            }else
+            }else{
                 uncheckedEnqueue(first, cr);
+                if (d_infProfiler != nullptr)
+                {
+                  notifyClauseUse(cr, false);
+                }
+            }
 
         NextClause:;
         }
@@ -1751,9 +1770,18 @@ lbool Solver::solve_()
 
     // Search:
     int curr_restarts = 0;
+    TraceEventRecorder* traceEvents = d_env.getTraceEvents();
     while (status == l_Undef){
         double rest_base = luby_restart ? luby(restart_inc, curr_restarts) : pow(restart_inc, curr_restarts);
-        status = search(rest_base * restart_first);
+        if (traceEvents != nullptr && curr_restarts > 0)
+        {
+          traceEvents->instant("sat", "restart");
+        }
+        {
+          // each call to search ends with a restart (or a result)
+          TraceEventScope traceEvent(traceEvents, "sat", "search");
+          status = search(rest_base * restart_first);
+        }
         if (!withinBudget(Resource::SatConflictStep))
           break;  // FIXME add restart option?
         curr_restarts++;
@@ -1903,6 +1931,46 @@ void Solver::relocAll(ClauseAllocator& to)
     {
       ca.reloc(clauses_persistent[i], to);
     }
+    // The identifiers of the lemmas of the clauses, where clauses that were
+    // not relocated have been removed
+    if (!d_clauseInfIds.empty())
+    {
+      std::unordered_map<CRef, theory::InferenceId> clauseInfIds;
+      for (const std::pair<const CRef, theory::InferenceId>& c : d_clauseInfIds)
+      {
+        if (ca[c.first].reloced())
+        {
+          clauseInfIds[ca[c.first].relocation()] = c.second;
+        }
+      }
+      d_clauseInfIds.swap(clauseInfIds);
+    }
+}
+
+void Solver::tagClause(CRef cr, theory::InferenceId id)
+{
+  if (id != theory::InferenceId::NONE)
+  {
+    d_clauseInfIds[cr] = id;
+  }
+}
+
+void Solver::notifyClauseUse(CRef cr, bool conflict)
+{
+  std::unordered_map<CRef, theory::InferenceId>::const_iterator it =
+      d_clauseInfIds.find(cr);
+  if (it == d_clauseInfIds.end())
+  {
+    return;
+  }
+  if (conflict)
+  {
+    d_infProfiler->notifyConflict(it->second);
+  }
+  else
+  {
+    d_infProfiler->notifyPropagation(it->second);
+  }
 }
 
 
@@ -2094,6 +2162,7 @@ CRef Solver::updateLemmas() {
         clauses_persistent.push(lemma_ref);
       }
       attachClause(lemma_ref);
+      tagClause(lemma_ref, lemmas_id[j]);
     }
 
     // If the lemma is propagating enqueue its literal (or set the conflict)
@@ -2113,11 +2182,21 @@ CRef Solver::updateLemmas() {
             {
               d_pfManager->storeUnitConflict(lemma[0]);
             }
+            if (d_infProfiler != nullptr
+                && lemmas_id[j] != theory::InferenceId::NONE)
+            {
+              d_infProfiler->notifyConflict(lemmas_id[j]);
+            }
           }
         } else {
           Trace("minisat::lemmas") << "lemma size is " << lemma.size() << std::endl;
           Trace("minisat::lemmas") << "lemma ref is " << lemma_ref << std::endl;
           uncheckedEnqueue(lemma[0], lemma_ref);
+          if (d_infProfiler != nullptr
+              && lemmas_id[j] != theory::InferenceId::NONE)
+          {
+            d_infProfiler->notifyPropagation(lemmas_id[j]);
+          }
         }
       }
     }
@@ -2126,6 +2205,7 @@ CRef Solver::updateLemmas() {
   // Clear the lemmas
   lemmas.clear();
   lemmas_removable.clear();
+  lemmas_id.clear();
 
   if (conflict != CRef_Undef) {
     theoryConflict = true;
@@ -24,6 +24,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define Minisat_Solver_h
 
 #include <iosfwd>
+#include <unordered_map>
 
 #include "base/check.h"
 #include "base/output.h"
@@ -38,6 +39,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "prop/minisat/sat_proof_manager.h"
 #include "prop/minisat/utils/Options.h"
 #include "smt/env_obj.h"
+#include "theory/inference_id.h"
 #include "theory/theory.h"
 #include "util/resource_manager.h"
 
@@ -48,6 +50,10 @@ class PropEngine;
 class TheoryProxy;
 class PropPfManager;
 }  // namespace prop
+
+namespace theory {
+class InferenceProfiler;
+}  // namespace theory
 }  // namespace cvc5::internal
 
 namespace cvc5::internal {
@@ -106,6 +112,24 @@ class Solver : protected EnvObj
   /** Is the lemma removable */
   vec<bool> lemmas_removable;
 
+  /** The identifier of the lemma each clause in lemmas stems from */
+  vec<theory::InferenceId> lemmas_id;
+
+  /** The inference profiler, or nullptr if we are not profiling */
+  theory::InferenceProfiler* d_infProfiler;
+
+  /**
+   * The identifier of the lemma each clause stems from, for the clauses that
+   * stem from lemmas, when profiling.
+   */
+  std::unordered_map<CRef, theory::InferenceId> d_clauseInfIds;
+
+  /** Record that clause cr stems from a lemma with identifier id, if any */
+  void tagClause(CRef cr, theory::InferenceId id);
+
+  /** Notify the profiler that clause cr propagated or was in a conflict */
+  void notifyClauseUse(CRef cr, bool conflict);
+
   /** Do a another check if FULL_EFFORT was the last one */
   bool recheck;
 
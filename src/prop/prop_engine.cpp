@@ -32,6 +32,7 @@
 #include "prop/sat_solver_factory.h"
 #include "prop/theory_proxy.h"
 #include "smt/env.h"
+#include "theory/inference_profiler.h"
 #include "theory/output_channel.h"
 #include "theory/theory_engine.h"
 #include "util/resource_manager.h"
@@ -259,7 +260,17 @@ void PropEngine::assertTrustedLemmaInternal(theory::InferenceId id,
     d_theoryLemmaPg.addTrustedStep(actualNode, TrustId::THEORY_LEMMA, {}, {});
     trn = TrustNode::mkReplaceGenTrustNode(trn, &d_theoryLemmaPg);
   }
+  // tag the clauses of the lemma with its identifier when profiling
+  theory::InferenceProfiler* profiler = d_env.getInferenceProfiler();
+  if (profiler != nullptr)
+  {
+    profiler->setCurrentLemma(id);
+  }
   assertInternal(id, node, negated, removable, false, trn.getGenerator());
+  if (profiler != nullptr)
+  {
+    profiler->setCurrentLemma(theory::InferenceId::NONE);
+  }
 }
 
 void PropEngine::assertInternal(theory::InferenceId id,
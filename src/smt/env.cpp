@@ -13,6 +13,10 @@
 
 #include "smt/env.h"
 
+#ifdef CVC5_POLY_IMP
+#include <poly/polyxx.h>
+#endif
+
 #include "context/context.h"
 #include "expr/node.h"
 #include "expr/node_algorithm.h"
@@ -28,12 +32,14 @@
 #include "smt/proof_manager.h"
 #include "smt/solver_engine_stats.h"
 #include "theory/evaluator.h"
+#include "theory/inference_profiler.h"
 #include "theory/quantifiers/oracle_checker.h"
 #include "theory/rewriter.h"
 #include "theory/theory.h"
 #include "theory/trust_substitutions.h"
 #include "util/resource_manager.h"
 #include "util/statistics_registry.h"
+#include "util/trace_events.h"
 
 using namespace cvc5::internal::smt;
 
@@ -43,6 +49,9 @@ Env::Env(NodeManager* nm, const Options* opts)
     : d_nm(nm),
       d_context(new context::Context()),
       d_userContext(new context::UserContext()),
+#ifdef CVC5_POLY_IMP
+      d_polyCtx(new poly::Context()),
+#endif
       d_pfManager(nullptr),
       d_proofNodeManager(nullptr),
       d_rewriter(new theory::Rewriter(nm)),
@@ -76,6 +85,10 @@ Env::~Env() {}
 
 NodeManager* Env::getNodeManager() const { return d_nm; }
 
+#ifdef CVC5_POLY_IMP
+const poly::Context& Env::getPolyContext() const { return *d_polyCtx; }
+#endif
+
 void Env::finishInit(smt::PfManager* pm)
 {
   if (pm != nullptr)
@@ -150,6 +163,13 @@ StatisticsRegistry& Env::getStatisticsRegistry()
   return *d_statisticsRegistry;
 }
 
+TraceEventRecorder* Env::getTraceEvents() const { return d_traceEvents.get(); }
+
+theory::InferenceProfiler* Env::getInferenceProfiler() const
+{
+  return d_infProfiler.get();
+}
+
 const Options& Env::getOptions() const { return d_options; }
 
 ResourceManager* Env::getResourceManager() const
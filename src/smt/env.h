@@ -30,6 +30,12 @@ class Context;
 class UserContext;
 }  // namespace cvc5::context
 
+#ifdef CVC5_POLY_IMP
+namespace poly {
+class Context;
+}
+#endif
+
 namespace cvc5::internal {
 
 class NodeManager;
@@ -39,6 +45,7 @@ class ProofLogger;
 class ProofNodeManager;
 class Printer;
 class ResourceManager;
+class TraceEventRecorder;
 namespace options {
 enum class OutputTag;
 }
@@ -50,6 +57,7 @@ class PfManager;
 
 namespace theory {
 class Evaluator;
+class InferenceProfiler;
 class Rewriter;
 class TrustSubstitutionMap;
 
@@ -81,6 +89,15 @@ class Env
   /** Get a pointer to the node manager */
   NodeManager* getNodeManager() const;
 
+#ifdef CVC5_POLY_IMP
+  /**
+   * Get the libpoly context of this Env. Each solver has its own context,
+   * since it holds the variable order of the polynomials of the solver, and
+   * hence may not be shared with solvers running on other threads.
+   */
+  const poly::Context& getPolyContext() const;
+#endif
+
   /** Get a pointer to the Context owned by this Env. */
   context::Context* getContext();
 
@@ -151,6 +168,22 @@ class Env
   /** Get a pointer to the StatisticsRegistry. */
   StatisticsRegistry& getStatisticsRegistry();
 
+  /**
+   * Get the recorder of trace events, or nullptr if the `trace-events` option
+   * is not set. This is only available after the SolverEngine that owns this
+   * environment is initialized, and is always nullptr for internal
+   * subsolvers.
+   */
+  TraceEventRecorder* getTraceEvents() const;
+
+  /**
+   * Get the inference profiler, or nullptr if the `profile-inferences` option
+   * is not set. Like the trace event recorder, this is only available after
+   * the SolverEngine that owns this environment is initialized, and is always
+   * nullptr for internal subsolvers.
+   */
+  theory::InferenceProfiler* getInferenceProfiler() const;
+
   /* Option helpers---------------------------------------------------------- */
 
   /**
@@ -356,6 +389,10 @@ class Env
   std::unique_ptr<context::Context> d_context;
   /** User level context owned by this Env */
   std::unique_ptr<context::UserContext> d_userContext;
+#ifdef CVC5_POLY_IMP
+  /** The libpoly context owned by this Env */
+  std::unique_ptr<poly::Context> d_polyCtx;
+#endif
   /**
    * The proof manager of the solver engine.
    */
@@ -392,6 +429,10 @@ class Env
    * The statistics registry owned by this Env.
    */
   std::unique_ptr<StatisticsRegistry> d_statisticsRegistry;
+  /** The recorder of trace events, if any */
+  std::unique_ptr<TraceEventRecorder> d_traceEvents;
+  /** The inference profiler, if any */
+  std::unique_ptr<theory::InferenceProfiler> d_infProfiler;
   /**
    * The options object, which contains the modified version of the options
    * provided as input to the SolverEngine that owns this environment. Note
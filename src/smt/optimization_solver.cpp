@@ -0,0 +1,498 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The solver for optimization (minimize/maximize) queries.
+ */
+
+#include "smt/optimization_solver.h"
+
+#include <algorithm>
+
+#include "options/smt_options.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+#include "theory/smt_engine_subsolver.h"
+#include "util/bitvector.h"
+
+namespace cvc5::internal {
+namespace smt {
+
+OptimizationSolver::OptimizationSolver(Env& env)
+    : EnvObj(env),
+      d_objectives(userContext()),
+      d_paretoBlocks(userContext()),
+      d_statQueries(statisticsRegistry().registerInt(
+          "smt::OptimizationSolver::queries")),
+      d_statChecks(statisticsRegistry().registerInt(
+          "smt::OptimizationSolver::checks"))
+{
+}
+
+OptimizationSolver::~OptimizationSolver() {}
+
+void OptimizationSolver::addObjective(const Node& target, bool minimize)
+{
+  Assert(target.getType().isRealOrInt() || target.getType().isBitVector());
+  d_objectives.push_back(OptimizationObjective(target, minimize));
+}
+
+bool OptimizationSolver::hasObjectives() const
+{
+  return !d_objectives.empty();
+}
+
+Result OptimizationSolver::checkOpt(const std::vector<Node>& assertions,
+                                    const std::unordered_set<Node>& defs,
+                                    const std::vector<Node>& assumptions)
+{
+  Assert(hasObjectives());
+  ++d_statQueries;
+  d_results.clear();
+  d_results.resize(d_objectives.size());
+  // Set up the subsolver, which is incremental since we check it once for
+  // each bound on an objective. We do not disable checking in the subsolver,
+  // since its last check is the one that is reported to the user.
+  d_subSolver.reset(nullptr);
+  theory::initializeSubsolver(d_subSolver, d_env);
+  d_subSolver->setOption("incremental", "true");
+  d_subSolver->setOption("produce-models", "true");
+  std::unordered_set<Node> removed;
+  theory::assertToSubsolver(*d_subSolver.get(), assertions, defs, removed);
+  Result r;
+  switch (options().smt.optCombination)
+  {
+    case options::OptCombinationMode::BOX: r = optimizeBox(assumptions); break;
+    case options::OptCombinationMode::LEX: r = optimizeLex(assumptions); break;
+    case options::OptCombinationMode::PARETO:
+      r = optimizePareto(assumptions);
+      break;
+    default: Unhandled() << options().smt.optCombination;
+  }
+  Trace("opt") << "OptimizationSolver::checkOpt: result is " << r << std::endl;
+  return r;
+}
+
+const std::vector<OptimizationResult>& OptimizationSolver::getResults() const
+{
+  return d_results;
+}
+
+std::vector<OptimizationObjective> OptimizationSolver::getObjectives() const
+{
+  return std::vector<OptimizationObjective>(d_objectives.begin(),
+                                            d_objectives.end());
+}
+
+SolverEngine* OptimizationSolver::getSubSolver() { return d_subSolver.get(); }
+
+Result OptimizationSolver::check(const std::vector<Node>& assumptions)
+{
+  ++d_statChecks;
+  Result r = d_subSolver->checkSat(assumptions);
+  Trace("opt-debug") << "check " << assumptions << " => " << r << std::endl;
+  return r;
+}
+
+OptimizationResult OptimizationSolver::optimize(
+    size_t i, const std::vector<Node>& assumptions, Result& r)
+{
+  const OptimizationObjective& obj = d_objectives[i];
+  Trace("opt") << "optimize " << (obj.d_minimize ? "min " : "max ")
+               << obj.d_target << std::endl;
+  r = check(assumptions);
+  if (r.getStatus() == Result::UNSAT)
+  {
+    return OptimizationResult(OmtResult(OmtResult::UNSAT), Node::null());
+  }
+  Node v = r.getStatus() == Result::SAT ? getValue(i) : Node::null();
+  if (v.isNull())
+  {
+    return OptimizationResult(
+        OmtResult(OmtResult::UNKNOWN, r.getUnknownExplanation()),
+        Node::null());
+  }
+  TypeNode tn = obj.d_target.getType();
+  // the direction in which the objective improves
+  Rational dir(obj.d_minimize ? -1 : 1);
+  Rational vr = getRational(v);
+  // A bound lb such that no model is better than or equal to lb, which for
+  // bit-vectors is the value just beyond the range of the type.
+  Rational lb;
+  bool hasLb = false;
+  if (tn.isBitVector())
+  {
+    lb = obj.d_minimize ? Rational(-1)
+                        : Rational(Integer(2).pow(tn.getBitVectorSize()));
+    hasLb = true;
+  }
+  uint64_t maxIterations = options().smt.optMaxIterations;
+  uint64_t iterations = 0;
+  // whether the current value is known to be optimal
+  bool optimal = false;
+  // the supremum (or infimum) of a real objective that cannot be reached
+  Node limit;
+  // The models for smaller infinitesimals are only guaranteed to exist for
+  // pure linear real arithmetic, since other theories may depend on the
+  // values of arithmetic terms.
+  const LogicInfo& logic = logicInfo();
+  bool isPureLra = logic.isPure(theory::THEORY_ARITH) && logic.isLinear()
+                   && !logic.areIntegersUsed() && !logic.isQuantified();
+  std::vector<Node> asserts = assumptions;
+  asserts.push_back(Node::null());
+  // find a bound by doubling the step
+  Rational step(1);
+  while (!hasLb && iterations < maxIterations)
+  {
+    iterations++;
+    Rational cand = vr + dir * step;
+    asserts.back() = mkBound(i, mkValue(i, cand), false);
+    Result rc = check(asserts);
+    if (rc.getStatus() == Result::SAT)
+    {
+      Node vc = getValue(i);
+      if (vc.isNull())
+      {
+        break;
+      }
+      v = vc;
+      vr = getRational(v);
+      step = step * Rational(2);
+    }
+    else if (rc.getStatus() == Result::UNSAT)
+    {
+      lb = cand;
+      hasLb = true;
+    }
+    else
+    {
+      break;
+    }
+  }
+  if (hasLb)
+  {
+    bool isInt = !tn.isReal();
+    while (iterations < maxIterations)
+    {
+      if (isInt)
+      {
+        // binary search in the interval between lb and v
+        if ((lb - vr).abs() <= Rational(1))
+        {
+          break;
+        }
+        iterations++;
+        Rational mid = (lb + vr) / Rational(2);
+        mid = obj.d_minimize ? Rational(mid.floor()) : Rational(mid.ceiling());
+        asserts.back() = mkBound(i, mkValue(i, mid), false);
+        Result rc = check(asserts);
+        if (rc.getStatus() == Result::SAT)
+        {
+          Node vc = getValue(i);
+          if (vc.isNull())
+          {
+            break;
+          }
+          v = vc;
+          vr = getRational(v);
+        }
+        else if (rc.getStatus() == Result::UNSAT)
+        {
+          lb = mid;
+        }
+        else
+        {
+          break;
+        }
+      }
+      else
+      {
+        iterations++;
+        // The value v of a real objective is c + k * d for the infinitesimal
+        // d of the arithmetic solver. If the objective improves as d
+        // decreases, we check whether its limit c can be reached. If not, c
+        // is its supremum (or infimum).
+        Node c = getLimit(i);
+        if (!c.isNull())
+        {
+          asserts.back() = mkBound(i, c, false);
+          Result rc = check(asserts);
+          if (rc.getStatus() == Result::UNSAT)
+          {
+            if (isPureLra)
+            {
+              limit = c;
+            }
+            break;
+          }
+          Node vc = rc.getStatus() == Result::SAT ? getValue(i) : Node::null();
+          if (vc.isNull())
+          {
+            break;
+          }
+          v = vc;
+          vr = getRational(v);
+          continue;
+        }
+        // otherwise, we check whether v can be improved, which finds another
+        // vertex of the feasible region
+        asserts.back() = mkBound(i, v, true);
+        Result rc = check(asserts);
+        if (rc.getStatus() == Result::UNSAT)
+        {
+          optimal = true;
+          break;
+        }
+        Node vc = rc.getStatus() == Result::SAT ? getValue(i) : Node::null();
+        if (vc.isNull())
+        {
+          break;
+        }
+        v = vc;
+        vr = getRational(v);
+      }
+    }
+    if (isInt && (lb - vr).abs() <= Rational(1))
+    {
+      // no value between lb and v
+      optimal = true;
+    }
+  }
+  Trace("opt") << "...value " << v << (optimal ? " (optimal)" : "")
+               << ", limit " << limit << " after " << iterations
+               << " iterations" << std::endl;
+  if (!limit.isNull())
+  {
+    return OptimizationResult(OmtResult(OmtResult::LIMIT_OPTIMAL), limit, v);
+  }
+  return OptimizationResult(
+      OmtResult(optimal ? OmtResult::OPTIMAL : OmtResult::NON_OPTIMAL), v);
+}
+
+Result OptimizationSolver::optimizeBox(const std::vector<Node>& assumptions)
+{
+  Result r;
+  for (size_t i = 0, nobjs = d_objectives.size(); i < nobjs; i++)
+  {
+    d_results[i] = optimize(i, assumptions, r);
+    if (d_results[i].d_value.isNull())
+    {
+      // unsat or unknown, which is the same for all objectives
+      for (OptimizationResult& res : d_results)
+      {
+        res = d_results[i];
+      }
+      return r;
+    }
+  }
+  // the returned model is one in which the last objective is optimal
+  std::vector<Node> asserts = assumptions;
+  asserts.push_back(mkFixed(d_objectives.size() - 1));
+  return check(asserts);
+}
+
+Result OptimizationSolver::optimizeLex(const std::vector<Node>& assumptions)
+{
+  Result r;
+  std::vector<Node> asserts = assumptions;
+  for (size_t i = 0, nobjs = d_objectives.size(); i < nobjs; i++)
+  {
+    d_results[i] = optimize(i, asserts, r);
+    if (d_results[i].d_value.isNull())
+    {
+      for (size_t j = i; j < nobjs; j++)
+      {
+        d_results[j] = d_results[i];
+      }
+      return r;
+    }
+    // fix the value of this objective for optimizing the next ones
+    asserts.push_back(mkFixed(i));
+  }
+  return check(asserts);
+}
+
+Result OptimizationSolver::optimizePareto(
+    const std::vector<Node>& assumptions)
+{
+  NodeManager* nm = nodeManager();
+  size_t nobjs = d_objectives.size();
+  std::vector<Node> asserts = assumptions;
+  asserts.insert(asserts.end(), d_paretoBlocks.begin(), d_paretoBlocks.end());
+  Result r = check(asserts);
+  std::vector<Node> values;
+  if (r.getStatus() == Result::SAT)
+  {
+    for (size_t i = 0; i < nobjs; i++)
+    {
+      values.push_back(getValue(i));
+      if (values.back().isNull())
+      {
+        r = Result(Result::UNKNOWN, UnknownExplanation::INCOMPLETE);
+        break;
+      }
+    }
+  }
+  if (r.getStatus() != Result::SAT)
+  {
+    OptimizationResult res(
+        r.getStatus() == Result::UNSAT
+            ? OmtResult(OmtResult::UNSAT)
+            : OmtResult(OmtResult::UNKNOWN, r.getUnknownExplanation()),
+        Node::null());
+    d_results.assign(nobjs, res);
+    return r;
+  }
+  // Improve the solution until it is not dominated by any other solution,
+  // i.e. until no objective can be improved without making another worse.
+  size_t nasserts = asserts.size();
+  uint64_t maxIterations = options().smt.optMaxIterations;
+  bool optimal = false;
+  for (uint64_t iterations = 0; iterations < maxIterations; iterations++)
+  {
+    asserts.resize(nasserts);
+    std::vector<Node> better;
+    for (size_t i = 0; i < nobjs; i++)
+    {
+      asserts.push_back(mkBound(i, values[i], false));
+      better.push_back(mkBound(i, values[i], true));
+    }
+    asserts.push_back(nm->mkOr(better));
+    Result rc = check(asserts);
+    if (rc.getStatus() == Result::UNSAT)
+    {
+      optimal = true;
+      break;
+    }
+    else if (rc.getStatus() != Result::SAT)
+    {
+      break;
+    }
+    std::vector<Node> nvalues;
+    for (size_t i = 0; i < nobjs; i++)
+    {
+      nvalues.push_back(getValue(i));
+    }
+    if (std::find(nvalues.begin(), nvalues.end(), Node::null())
+        != nvalues.end())
+    {
+      break;
+    }
+    values = nvalues;
+  }
+  std::vector<Node> block;
+  for (size_t i = 0; i < nobjs; i++)
+  {
+    d_results[i] = OptimizationResult(
+        OmtResult(optimal ? OmtResult::OPTIMAL : OmtResult::NON_OPTIMAL),
+        values[i]);
+    block.push_back(mkBound(i, values[i], true));
+  }
+  asserts.resize(nasserts);
+  for (size_t i = 0; i < nobjs; i++)
+  {
+    asserts.push_back(mkFixed(i));
+  }
+  r = check(asserts);
+  // the next solution must be better in some objective
+  d_paretoBlocks.push_back(nm->mkOr(block));
+  return r;
+}
+
+Node OptimizationSolver::mkFixed(size_t i) const
+{
+  const OptimizationResult& res = d_results[i];
+  Assert(!res.d_value.isNull());
+  if (res.d_result.getStatus() == OmtResult::LIMIT_OPTIMAL)
+  {
+    // the limit is not reached, hence we require the value of the best
+    // solution that was found
+    return mkBound(i, res.d_modelValue, false);
+  }
+  return d_objectives[i].d_target.eqNode(res.d_value);
+}
+
+Node OptimizationSolver::getLimit(size_t i)
+{
+  const OptimizationObjective& obj = d_objectives[i];
+  std::pair<Node, Node> val = d_subSolver->getInfinitesimalValue(obj.d_target);
+  if (val.first.isNull())
+  {
+    return Node::null();
+  }
+  // the objective improves as the infinitesimal decreases if its coefficient
+  // is positive for a minimized objective, or negative for a maximized one
+  int sgn = val.second.getConst<Rational>().sgn();
+  if (sgn == 0 || (sgn > 0) != obj.d_minimize)
+  {
+    return Node::null();
+  }
+  return mkValue(i, val.first.getConst<Rational>());
+}
+
+Node OptimizationSolver::getValue(size_t i)
+{
+  Node v = d_subSolver->getValue(d_objectives[i].d_target);
+  Kind k = v.getKind();
+  if (k == Kind::CONST_INTEGER || k == Kind::CONST_RATIONAL
+      || k == Kind::CONST_BITVECTOR)
+  {
+    return v;
+  }
+  return Node::null();
+}
+
+Node OptimizationSolver::mkValue(size_t i, const Rational& c) const
+{
+  TypeNode tn = d_objectives[i].d_target.getType();
+  if (tn.isBitVector())
+  {
+    Assert(c.isIntegral() && c.sgn() >= 0);
+    return nodeManager()->mkConst(
+        BitVector(tn.getBitVectorSize(), c.getNumerator()));
+  }
+  return NodeManager::mkConstRealOrInt(tn, c);
+}
+
+Rational OptimizationSolver::getRational(const Node& c)
+{
+  if (c.getKind() == Kind::CONST_BITVECTOR)
+  {
+    return Rational(c.getConst<BitVector>().toInteger());
+  }
+  return c.getConst<Rational>();
+}
+
+Node OptimizationSolver::mkBound(size_t i, const Node& c, bool strict) const
+{
+  const OptimizationObjective& obj = d_objectives[i];
+  Kind k;
+  if (obj.d_target.getType().isBitVector())
+  {
+    if (obj.d_minimize)
+    {
+      k = strict ? Kind::BITVECTOR_ULT : Kind::BITVECTOR_ULE;
+    }
+    else
+    {
+      k = strict ? Kind::BITVECTOR_UGT : Kind::BITVECTOR_UGE;
+    }
+  }
+  else if (obj.d_minimize)
+  {
+    k = strict ? Kind::LT : Kind::LEQ;
+  }
+  else
+  {
+    k = strict ? Kind::GT : Kind::GEQ;
+  }
+  return nodeManager()->mkNode(k, obj.d_target, c);
+}
+
+}  // namespace smt
+}  // namespace cvc5::internal
@@ -0,0 +1,204 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The solver for optimization (minimize/maximize) queries.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__OPTIMIZATION_SOLVER_H
+#define CVC5__SMT__OPTIMIZATION_SOLVER_H
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "context/cdlist.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/omt_result.h"
+#include "util/rational.h"
+#include "util/result.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class SolverEngine;
+
+namespace smt {
+
+/** An objective of an optimization query */
+struct OptimizationObjective
+{
+  OptimizationObjective(Node target, bool minimize)
+      : d_target(target), d_minimize(minimize)
+  {
+  }
+  /** The term to optimize, of type Int, Real or bit-vector */
+  Node d_target;
+  /** Whether the term is minimized (or maximized) */
+  bool d_minimize;
+};
+
+/** The result of optimizing an objective */
+struct OptimizationResult
+{
+  OptimizationResult() {}
+  OptimizationResult(const OmtResult& r, Node value)
+      : d_result(r), d_value(value), d_modelValue(value)
+  {
+  }
+  OptimizationResult(const OmtResult& r, Node value, Node modelValue)
+      : d_result(r), d_value(value), d_modelValue(modelValue)
+  {
+  }
+  /** The status of the objective */
+  OmtResult d_result;
+  /**
+   * The value of the objective. This is the optimum if the status is
+   * OPTIMAL, the supremum (or infimum) of the objective if it is
+   * LIMIT_OPTIMAL, and the best value found if it is NON_OPTIMAL. It is null
+   * if no solution was found.
+   */
+  Node d_value;
+  /**
+   * The value of the objective in the best solution that was found, which
+   * differs from d_value only if the status is LIMIT_OPTIMAL.
+   */
+  Node d_modelValue;
+};
+
+/**
+ * A module for solving optimization queries, i.e., for finding a model of the
+ * current assertions that minimizes or maximizes a set of objectives.
+ *
+ * Each query is solved by a single incremental subsolver, where the
+ * assertions are asserted once and the bounds on the objectives are passed as
+ * assumptions. Hence the learned clauses and theory lemmas are kept between
+ * the satisfiability checks of a query.
+ *
+ * An objective t is optimized as follows, where we describe minimization:
+ * given a model with value v for t, we check satisfiability of t <= v - s
+ * for a step s that is doubled as long as the check is satisfiable, which
+ * quickly finds a lower bound if one exists. For Int and bit-vector
+ * objectives, the remaining interval is then closed by binary search, which
+ * determines the optimum exactly. For Real objectives, the linear arithmetic
+ * solver gives the value of t as c + k * d for its infinitesimal d. If t
+ * improves as d decreases, we check whether t can reach c. If not, c is the
+ * supremum (or infimum) of t, which is reported as LIMIT_OPTIMAL. Otherwise,
+ * we check t < v for the best value v, which finds another vertex of the
+ * feasible region, until this is unsatisfiable, in which case v is the
+ * optimum. Hence the number of checks is bounded by the number of vertices
+ * that are visited, instead of the infinitely many values that approach an
+ * open bound.
+ * Bit-vector objectives are optimized with respect to the unsigned order.
+ *
+ * Multiple objectives are combined according to the option optCombination:
+ * - box: each objective is optimized independently,
+ * - lex: each objective is optimized while the previous ones are fixed to
+ *   their optimum,
+ * - pareto: a solution is improved until no objective can be improved
+ *   without making another one worse. The solution is then blocked, so that
+ *   the next query in the same user context returns another Pareto-optimal
+ *   solution.
+ */
+class OptimizationSolver : protected EnvObj
+{
+ public:
+  OptimizationSolver(Env& env);
+  ~OptimizationSolver();
+  /** Add an objective, which is valid in the current user context. */
+  void addObjective(const Node& target, bool minimize);
+  /** Are there objectives in the current user context? */
+  bool hasObjectives() const;
+  /**
+   * Check satisfiability of the given assertions and assumptions, and if
+   * they are satisfiable, optimize the objectives. If the result is sat, the
+   * model of the subsolver (see getSubSolver) is the returned solution.
+   *
+   * @param assertions The current input assertions
+   * @param defs The assertions that are function definitions
+   * @param assumptions The assumptions of the check
+   * @return The result of the satisfiability check
+   */
+  Result checkOpt(const std::vector<Node>& assertions,
+                  const std::unordered_set<Node>& defs,
+                  const std::vector<Node>& assumptions);
+  /**
+   * Get the results of the last call to checkOpt, one for each objective in
+   * the order in which they were added.
+   */
+  const std::vector<OptimizationResult>& getResults() const;
+  /** Get the objectives of the current user context */
+  std::vector<OptimizationObjective> getObjectives() const;
+  /** Get the subsolver that solved the last query */
+  SolverEngine* getSubSolver();
+
+ private:
+  /** Check the subsolver with the given assumptions */
+  Result check(const std::vector<Node>& assumptions);
+  /**
+   * Optimize the objective with index i, given the assumptions. The result
+   * of the first satisfiability check is stored in r. The subsolver may not
+   * have a model for the returned value on return.
+   */
+  OptimizationResult optimize(size_t i,
+                              const std::vector<Node>& assumptions,
+                              Result& r);
+  /** Optimize all objectives in the given combination mode */
+  Result optimizeBox(const std::vector<Node>& assumptions);
+  Result optimizeLex(const std::vector<Node>& assumptions);
+  Result optimizePareto(const std::vector<Node>& assumptions);
+  /**
+   * Make the equality that fixes the objective with index i to its value in
+   * d_results. If the value is a limit that cannot be reached, this is
+   * the bound on the objective of the best solution that was found instead.
+   */
+  Node mkFixed(size_t i) const;
+  /**
+   * Get the limit c of the real objective with index i whose value in the
+   * current model of the subsolver is c + k * d, where d is the
+   * infinitesimal of the linear arithmetic solver. Returns the null node if
+   * the value is not of this form, or the objective does not improve as d
+   * decreases.
+   */
+  Node getLimit(size_t i);
+  /**
+   * Get the value of the objective with index i in the current model of the
+   * subsolver. Returns the null node if the value is not a constant whose
+   * rational value we can compute, e.g. if it is a real algebraic number.
+   */
+  Node getValue(size_t i);
+  /** Get the value of c as a constant of the type of objective i */
+  Node mkValue(size_t i, const Rational& c) const;
+  /** Get the rational value of constant c */
+  static Rational getRational(const Node& c);
+  /**
+   * Make the literal that states the objective with index i is at least as
+   * good as c, or strictly better than c if strict is true.
+   */
+  Node mkBound(size_t i, const Node& c, bool strict) const;
+  /** The objectives */
+  context::CDList<OptimizationObjective> d_objectives;
+  /** The blocking formulas of the Pareto-optimal solutions found so far */
+  context::CDList<Node> d_paretoBlocks;
+  /** The results of the last query */
+  std::vector<OptimizationResult> d_results;
+  /** The subsolver */
+  std::unique_ptr<SolverEngine> d_subSolver;
+  /** Number of optimization queries */
+  IntStat d_statQueries;
+  /** Number of satisfiability checks of the subsolver */
+  IntStat d_statChecks;
+};
+
+}  // namespace smt
+}  // namespace cvc5::internal
+
+#endif /* CVC5__SMT__OPTIMIZATION_SOLVER_H */
@@ -189,6 +189,11 @@ bool ProcessAssertions::apply(AssertionPipeline& ap)
     applyPass("int-to-bv", ap);
   }
 
+  if (options().smt.solveIntAsBVInc)
+  {
+    applyPass("int-to-bv-inc", ap);
+  }
+
   Trace("smt") << " assertions     : " << ap.size() << endl;
 
   bool noConflict = true;
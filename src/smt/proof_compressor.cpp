@@ -0,0 +1,479 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Compression of the resolution part of proofs.
+ */
+
+#include "smt/proof_compressor.h"
+
+#include <algorithm>
+
+#include "base/output.h"
+#include "proof/proof_checker.h"
+#include "proof/proof_node.h"
+#include "proof/proof_node_manager.h"
+#include "smt/env.h"
+
+namespace cvc5::internal {
+namespace smt {
+
+ProofCompressor::ProofCompressor(Env& env)
+    : EnvObj(env),
+      d_stepsBefore(
+          statisticsRegistry().registerInt("proofCompress::chainStepsBefore")),
+      d_stepsAfter(
+          statisticsRegistry().registerInt("proofCompress::chainStepsAfter")),
+      d_premisesBefore(statisticsRegistry().registerInt(
+          "proofCompress::chainPremisesBefore")),
+      d_premisesAfter(statisticsRegistry().registerInt(
+          "proofCompress::chainPremisesAfter")),
+      d_numLoweredUnits(
+          statisticsRegistry().registerInt("proofCompress::loweredUnits")),
+      d_numRejected(
+          statisticsRegistry().registerInt("proofCompress::rejectedSteps")),
+      d_time(statisticsRegistry().registerTimer("proofCompress::time"))
+{
+  d_true = nodeManager()->mkConst(true);
+  d_false = nodeManager()->mkConst(false);
+}
+
+void ProofCompressor::compress(std::shared_ptr<ProofNode> pf, uint64_t millis)
+{
+  CodeTimer codeTimer(d_time);
+  uint64_t steps = 0;
+  uint64_t premises = 0;
+  countChains(pf, steps, premises);
+  d_stepsBefore += steps;
+  d_premisesBefore += premises;
+  d_timer.set(millis);
+  if (!compressPass(pf, true))
+  {
+    Trace("proof-compress") << "...could not lower units, retry" << std::endl;
+    compressPass(pf, false);
+  }
+  d_timer.set(0);
+  steps = 0;
+  premises = 0;
+  countChains(pf, steps, premises);
+  d_stepsAfter += steps;
+  d_premisesAfter += premises;
+  Trace("proof-compress") << "...chain premises " << d_premisesBefore.get()
+                          << " -> " << d_premisesAfter.get() << std::endl;
+}
+
+bool ProofCompressor::compressPass(std::shared_ptr<ProofNode> pf,
+                                   bool lowerUnits)
+{
+  collect(pf);
+  std::vector<Link> unitLinks;
+  if (lowerUnits)
+  {
+    unitLinks = computeLoweredUnits();
+  }
+  bool rootDone = false;
+  bool timeout = false;
+  for (const std::shared_ptr<ProofNode>& pn : d_postOrder)
+  {
+    if (d_timer.expired())
+    {
+      Trace("proof-compress") << "...time budget exhausted" << std::endl;
+      timeout = true;
+      break;
+    }
+    if (!d_info[pn.get()].d_isChain)
+    {
+      continue;
+    }
+    bool isRoot = pn == pf;
+    std::shared_ptr<ProofNode> npn =
+        rebuild(pn, isRoot ? unitLinks : std::vector<Link>());
+    if (npn == nullptr)
+    {
+      continue;
+    }
+    rootDone = rootDone || isRoot;
+    if (npn->getResult() == pn->getResult())
+    {
+      // Only leaves are interned by the proof node manager (--proof-intern),
+      // hence pn is not shared with other proofs and may be updated in place.
+      Assert(!pn->getChildren().empty());
+      d_env.getProofNodeManager()->updateNode(pn.get(), npn.get());
+    }
+    else
+    {
+      d_compressed[pn.get()] = npn;
+    }
+  }
+  // If the root was not rebuilt, the lowered units were not resolved against
+  // the final clause. The root still has its original proof then, which is
+  // valid, but the pass did not compress it.
+  bool success = d_lowered.empty() || rootDone || timeout;
+  if (rootDone)
+  {
+    d_numLoweredUnits += d_lowered.size();
+  }
+  d_info.clear();
+  d_postOrder.clear();
+  d_compressed.clear();
+  d_lowered.clear();
+  return success;
+}
+
+void ProofCompressor::collect(std::shared_ptr<ProofNode> pf)
+{
+  std::unordered_set<ProofNode*> visited;
+  std::vector<std::pair<std::shared_ptr<ProofNode>, bool>> visit;
+  visit.emplace_back(pf, false);
+  while (!visit.empty())
+  {
+    auto [cur, post] = visit.back();
+    visit.pop_back();
+    if (post)
+    {
+      StepInfo& info = d_info[cur.get()];
+      info.d_isChain = isChain(cur.get());
+      info.d_order = d_postOrder.size();
+      d_postOrder.push_back(cur);
+      continue;
+    }
+    if (!visited.insert(cur.get()).second)
+    {
+      continue;
+    }
+    visit.emplace_back(cur, true);
+    for (const std::shared_ptr<ProofNode>& c : cur->getChildren())
+    {
+      d_info[c.get()].d_parents.push_back(cur.get());
+      visit.emplace_back(c, false);
+    }
+  }
+  // Parents come after their children in post-order, hence flexibility is
+  // computed top-down in reverse post-order.
+  for (size_t i = d_postOrder.size(); i > 0; i--)
+  {
+    ProofNode* pn = d_postOrder[i - 1].get();
+    StepInfo& info = d_info[pn];
+    if (!info.d_isChain)
+    {
+      continue;
+    }
+    if (pn == pf.get())
+    {
+      info.d_flexible = pn->getResult() == d_false;
+      continue;
+    }
+    info.d_flexible =
+        !info.d_parents.empty()
+        && std::all_of(info.d_parents.begin(),
+                       info.d_parents.end(),
+                       [this](ProofNode* p) { return d_info[p].d_flexible; });
+  }
+}
+
+std::vector<ProofCompressor::Link> ProofCompressor::computeLoweredUnits()
+{
+  std::unordered_map<ProofNode*, size_t> count;
+  std::unordered_map<ProofNode*, Link> link;
+  for (const std::shared_ptr<ProofNode>& pn : d_postOrder)
+  {
+    if (!d_info[pn.get()].d_flexible)
+    {
+      continue;
+    }
+    const std::vector<std::shared_ptr<ProofNode>>& children =
+        pn->getChildren();
+    const std::vector<Node>& args = pn->getArguments();
+    for (size_t i = 1, nchild = children.size(); i < nchild; i++)
+    {
+      const Node& pol = args[1][i - 1];
+      const Node& lit = args[2][i - 1];
+      Node rhsElim = pol == d_true ? lit.notNode() : lit;
+      const Node& res = children[i]->getResult();
+      if (res != rhsElim || res.getKind() == Kind::OR || res == d_false)
+      {
+        continue;
+      }
+      ProofNode* c = children[i].get();
+      if (++count[c] == 1)
+      {
+        link[c] = {children[i], pol, lit};
+      }
+    }
+  }
+  std::vector<Link> units;
+  for (const std::pair<ProofNode* const, size_t>& c : count)
+  {
+    if (c.second >= 2)
+    {
+      d_lowered[c.first] = c.first->getResult();
+      units.push_back(link[c.first]);
+    }
+  }
+  // Units deriving other units are resolved first, since their compressed
+  // proofs may contain the negation of the units they depend on.
+  std::sort(units.begin(), units.end(), [this](const Link& a, const Link& b) {
+    return d_info[a.d_premise.get()].d_order
+           > d_info[b.d_premise.get()].d_order;
+  });
+  Trace("proof-compress") << "...lower " << units.size() << " units"
+                          << std::endl;
+  return units;
+}
+
+std::shared_ptr<ProofNode> ProofCompressor::rebuild(
+    std::shared_ptr<ProofNode> pn, const std::vector<Link>& extra)
+{
+  const StepInfo& info = d_info[pn.get()];
+  bool flexible = info.d_flexible;
+  const std::vector<std::shared_ptr<ProofNode>>& children = pn->getChildren();
+  const std::vector<Node>& args = pn->getArguments();
+  auto compressed = [this](const std::shared_ptr<ProofNode>& p) {
+    auto it = d_compressed.find(p.get());
+    return it == d_compressed.end() ? p : it->second;
+  };
+  // the links of the step, without the lowered units
+  std::vector<Link> links;
+  for (size_t i = 1, nchild = children.size(); i < nchild; i++)
+  {
+    const Node& pol = args[1][i - 1];
+    const Node& lit = args[2][i - 1];
+    auto it = d_lowered.find(children[i].get());
+    if (flexible && it != d_lowered.end()
+        && it->second == (pol == d_true ? lit.notNode() : lit))
+    {
+      continue;
+    }
+    links.push_back({children[i], pol, lit});
+  }
+  links.insert(links.end(), extra.begin(), extra.end());
+
+  // Resolve the links as the checker of CHAIN_M_RESOLUTION does, keeping
+  // the clause derived after each kept link.
+  std::shared_ptr<ProofNode> first = compressed(children[0]);
+  Node firstElim = args[1][0] == d_true ? args[2][0] : args[2][0].notNode();
+  std::vector<Node> clause;
+  getClause(first->getResult(), firstElim, clause);
+  std::vector<std::vector<Node>> prefixes{clause};
+  std::vector<Link> kept;
+  for (const Link& l : links)
+  {
+    Node lhsElim = l.d_pol == d_true ? l.d_lit : l.d_lit.notNode();
+    Node rhsElim = l.d_pol == d_true ? l.d_lit.notNode() : l.d_lit;
+    std::shared_ptr<ProofNode> premise = compressed(l.d_premise);
+    std::vector<Node> rhs;
+    getClause(premise->getResult(), rhsElim, rhs);
+    if (std::find(clause.begin(), clause.end(), lhsElim) == clause.end())
+    {
+      // The pivot was already eliminated. If the conclusion may change, the
+      // link is redundant. Otherwise, only drop it if it adds nothing.
+      if (flexible
+          || std::all_of(rhs.begin(), rhs.end(), [&](const Node& r) {
+               return r == rhsElim
+                      || std::find(clause.begin(), clause.end(), r)
+                             != clause.end();
+             }))
+      {
+        continue;
+      }
+    }
+    if (flexible && std::find(rhs.begin(), rhs.end(), rhsElim) == rhs.end())
+    {
+      // The premise was strengthened and no longer contains the pivot, hence
+      // it subsumes the clause derived by this link.
+      first = premise;
+      clause = rhs;
+      prefixes = {clause};
+      kept.clear();
+      continue;
+    }
+    clause.erase(std::remove(clause.begin(), clause.end(), lhsElim),
+                 clause.end());
+    for (const Node& r : rhs)
+    {
+      if (r != rhsElim)
+      {
+        clause.push_back(r);
+      }
+    }
+    kept.push_back({premise, l.d_pol, l.d_lit});
+    prefixes.push_back(clause);
+  }
+
+  // Is the clause cset equal to the conclusion c as a set?
+  auto isConclusion = [this](const std::unordered_set<Node>& cset,
+                             const Node& c) {
+    if (cset.size() <= 1)
+    {
+      return c == (cset.empty() ? d_false : *cset.begin());
+    }
+    return c.getKind() == Kind::OR
+           && cset == std::unordered_set<Node>(c.begin(), c.end());
+  };
+  // Only steps that are used as premises may be strengthened.
+  bool canStrengthen = flexible && !info.d_parents.empty();
+  const Node& concl = pn->getResult();
+  std::unordered_set<Node> target(clause.begin(), clause.end());
+  if (!canStrengthen && !isConclusion(target, concl))
+  {
+    return nullptr;
+  }
+  // Trim the links after the first prefix deriving (a subset of) the clause.
+  size_t k = 0;
+  for (size_t nprefix = prefixes.size(); k < nprefix; k++)
+  {
+    const std::vector<Node>& p = prefixes[k];
+    if (canStrengthen
+            ? std::all_of(p.begin(),
+                          p.end(),
+                          [&target](const Node& l) {
+                            return target.find(l) != target.end();
+                          })
+            : (k > 0 || first->getResult() == concl)
+                  && std::unordered_set<Node>(p.begin(), p.end()) == target)
+    {
+      break;
+    }
+  }
+  Assert(k < prefixes.size());
+  kept.resize(k);
+  clause = prefixes[k];
+  if (kept.empty())
+  {
+    Trace("proof-compress") << "...step subsumed by premise" << std::endl;
+    return first;
+  }
+  bool unchanged = first == children[0] && kept.size() + 1 == children.size();
+  for (size_t i = 0, nkept = kept.size(); unchanged && i < nkept; i++)
+  {
+    unchanged = kept[i].d_premise == children[i + 1];
+  }
+  std::unordered_set<Node> cset(clause.begin(), clause.end());
+  Node nconcl = concl;
+  if (!isConclusion(cset, concl))
+  {
+    Assert(flexible);
+    std::vector<Node> lits;
+    for (const Node& l : clause)
+    {
+      if (std::find(lits.begin(), lits.end(), l) == lits.end())
+      {
+        lits.push_back(l);
+      }
+    }
+    if (lits.empty())
+    {
+      nconcl = d_false;
+    }
+    else if (lits.size() == 1)
+    {
+      // A unit clause whose literal is a disjunction would be read as a
+      // clause with several literals by the steps using it.
+      if (lits[0].getKind() == Kind::OR)
+      {
+        return nullptr;
+      }
+      nconcl = lits[0];
+    }
+    else
+    {
+      nconcl = nodeManager()->mkNode(Kind::OR, lits);
+    }
+  }
+  else if (unchanged)
+  {
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<ProofNode>> nchildren{first};
+  std::vector<Node> cchildren{first->getResult()};
+  std::vector<Node> pols;
+  std::vector<Node> lits;
+  for (const Link& l : kept)
+  {
+    nchildren.push_back(l.d_premise);
+    cchildren.push_back(l.d_premise->getResult());
+    pols.push_back(l.d_pol);
+    lits.push_back(l.d_lit);
+  }
+  std::vector<Node> nargs{nconcl,
+                          nodeManager()->mkNode(Kind::SEXPR, pols),
+                          nodeManager()->mkNode(Kind::SEXPR, lits)};
+  ProofNodeManager* pnm = d_env.getProofNodeManager();
+  // The premises may be disambiguated differently from the original step,
+  // hence we validate the new step.
+  if (pnm->getChecker()
+          ->checkDebug(ProofRule::CHAIN_M_RESOLUTION,
+                       cchildren,
+                       nargs,
+                       nconcl,
+                       "proof-compress")
+          .isNull())
+  {
+    ++d_numRejected;
+    return nullptr;
+  }
+  Trace("proof-compress") << "...rebuilt step with " << kept.size() << "/"
+                          << children.size() - 1 << " links" << std::endl;
+  return pnm->mkNode(ProofRule::CHAIN_M_RESOLUTION, nchildren, nargs, nconcl);
+}
+
+bool ProofCompressor::isChain(const ProofNode* pn)
+{
+  if (pn->getRule() != ProofRule::CHAIN_M_RESOLUTION)
+  {
+    return false;
+  }
+  const std::vector<Node>& args = pn->getArguments();
+  size_t nlinks = pn->getChildren().size();
+  return nlinks > 1 && args.size() == 3
+         && args[1].getNumChildren() == nlinks - 1
+         && args[2].getNumChildren() == nlinks - 1;
+}
+
+void ProofCompressor::getClause(const Node& c,
+                                const Node& elim,
+                                std::vector<Node>& clause)
+{
+  if (c.getKind() != Kind::OR || c == elim)
+  {
+    clause.push_back(c);
+  }
+  else
+  {
+    clause.insert(clause.end(), c.begin(), c.end());
+  }
+}
+
+void ProofCompressor::countChains(std::shared_ptr<ProofNode> pf,
+                                  uint64_t& steps,
+                                  uint64_t& premises)
+{
+  std::unordered_set<ProofNode*> visited;
+  std::vector<ProofNode*> visit{pf.get()};
+  while (!visit.empty())
+  {
+    ProofNode* cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    if (isChain(cur))
+    {
+      steps++;
+      premises += cur->getChildren().size();
+    }
+    for (const std::shared_ptr<ProofNode>& c : cur->getChildren())
+    {
+      visit.push_back(c.get());
+    }
+  }
+}
+
+}  // namespace smt
+}  // namespace cvc5::internal
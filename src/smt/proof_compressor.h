@@ -0,0 +1,163 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Compression of the resolution part of proofs.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__PROOF_COMPRESSOR_H
+#define CVC5__SMT__PROOF_COMPRESSOR_H
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/resource_manager.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class ProofNode;
+
+namespace smt {
+
+/**
+ * Compresses the resolution part of a proof, i.e. the subproofs built from
+ * CHAIN_M_RESOLUTION steps that are produced by the SAT solvers, before the
+ * proof is post-processed and printed.
+ *
+ * Each chain is rebuilt bottom-up on top of the (compressed) proofs of its
+ * premises, while applying the following transformations:
+ *
+ * - Redundant links are dropped. A link is redundant if the literal it is
+ *   meant to eliminate from the current clause was already eliminated by an
+ *   earlier link, as in RecyclePivots. If a premise no longer contains the
+ *   literal it is resolved on, the chain restarts from that premise.
+ * - Chains are trimmed. Links after the first prefix of the chain that
+ *   already derives (a subset of) the conclusion are removed.
+ * - Units are lowered, as in LowerUnits. Unit premises that are resolved in
+ *   several chains are instead resolved once against the final clause.
+ *
+ * Dropping links may yield a stronger conclusion than the original one. This
+ * is only allowed for steps whose uses are all resolution steps that can be
+ * strengthened as well, up to a step that concludes false. Other steps are
+ * rebuilt so that they keep their conclusion.
+ *
+ * Every rebuilt step is validated by the proof checker, and the original step
+ * is kept if validation fails. Hence, compression never makes a valid proof
+ * invalid. Compression stops when the given time budget is exhausted.
+ *
+ * Steps are updated in place. This is compatible with --proof-intern, since
+ * only leaves are interned and a chain step always has premises.
+ */
+class ProofCompressor : protected EnvObj
+{
+ public:
+  ProofCompressor(Env& env);
+  /**
+   * Compress the resolution part of pf in place, spending at most `millis`
+   * milliseconds (0 means no limit).
+   */
+  void compress(std::shared_ptr<ProofNode> pf, uint64_t millis);
+
+ private:
+  /** Information about a step of the proof. */
+  struct StepInfo
+  {
+    /** Is this a resolution step that we can rebuild? */
+    bool d_isChain = false;
+    /** May the conclusion of this step change? */
+    bool d_flexible = false;
+    /** The steps using this one as a premise, with repetitions. */
+    std::vector<ProofNode*> d_parents;
+    /** Index in post-order. */
+    size_t d_order = 0;
+  };
+  /** A link of a chain: the premise, its polarity, and its pivot. */
+  struct Link
+  {
+    std::shared_ptr<ProofNode> d_premise;
+    Node d_pol;
+    Node d_lit;
+  };
+  /**
+   * Run one compression pass on the proof pf.
+   *
+   * @param pf The proof.
+   * @param lowerUnits Whether to lower units.
+   * @return false if the pass lowered units but could not derive the
+   * conclusion of pf from them at the end. In that case, the pass should be
+   * repeated without lowering units.
+   */
+  bool compressPass(std::shared_ptr<ProofNode> pf, bool lowerUnits);
+  /** Collect the steps of pf in d_info and d_postOrder. */
+  void collect(std::shared_ptr<ProofNode> pf);
+  /**
+   * Compute the units to lower, i.e. unit premises of flexible steps that are
+   * resolved more than once. Fills d_lowered and returns the links with which
+   * they are resolved against the final clause, in reverse post-order.
+   */
+  std::vector<Link> computeLoweredUnits();
+  /**
+   * Rebuild the resolution step pn.
+   *
+   * @param pn The step.
+   * @param extra Links to resolve after those of pn.
+   * @return The new proof of the (possibly stronger) conclusion of pn, or
+   * nullptr if pn should be kept unchanged.
+   */
+  std::shared_ptr<ProofNode> rebuild(std::shared_ptr<ProofNode> pn,
+                                     const std::vector<Link>& extra);
+  /** Is the chain resolution step pn well formed? */
+  static bool isChain(const ProofNode* pn);
+  /** Get the clause of the premise `c` when resolving on rhsElim. */
+  static void getClause(const Node& c,
+                        const Node& elim,
+                        std::vector<Node>& clause);
+  /** Get the number of chain steps and their premises reachable from pf. */
+  static void countChains(std::shared_ptr<ProofNode> pf,
+                          uint64_t& steps,
+                          uint64_t& premises);
+  /** Common constants */
+  Node d_true;
+  Node d_false;
+  /** The timer for the time budget */
+  WallClockTimer d_timer;
+  /** Information about each step of the current proof */
+  std::unordered_map<ProofNode*, StepInfo> d_info;
+  /** The steps of the current proof in post-order */
+  std::vector<std::shared_ptr<ProofNode>> d_postOrder;
+  /** The compressed proof of each visited step */
+  std::unordered_map<ProofNode*, std::shared_ptr<ProofNode>> d_compressed;
+  /** The lowered units, mapped to the literal they conclude */
+  std::unordered_map<ProofNode*, Node> d_lowered;
+  /** Number of chain steps before compression */
+  IntStat d_stepsBefore;
+  /** Number of chain steps after compression */
+  IntStat d_stepsAfter;
+  /** Number of chain premises before compression */
+  IntStat d_premisesBefore;
+  /** Number of chain premises after compression */
+  IntStat d_premisesAfter;
+  /** Number of lowered units */
+  IntStat d_numLoweredUnits;
+  /** Number of rebuilt steps rejected by the proof checker */
+  IntStat d_numRejected;
+  /** Time spent compressing */
+  TimerStat d_time;
+};
+
+}  // namespace smt
+}  // namespace cvc5::internal
+
+#endif
@@ -31,6 +31,7 @@
 #include "smt/difficulty_post_processor.h"
 #include "smt/env.h"
 #include "smt/preprocess_proof_generator.h"
+#include "smt/proof_compressor.h"
 #include "smt/proof_logger.h"
 #include "smt/proof_post_processor.h"
 #include "smt/smt_solver.h"
@@ -44,6 +45,7 @@ PfManager::PfManager(Env& env)
       d_rewriteDb(nullptr),
       d_pchecker(nullptr),
       d_pnm(nullptr),
+      d_pfc(nullptr),
       d_pfpp(nullptr),
       d_pppg(nullptr),
       d_finalCb(env),
@@ -96,10 +98,15 @@ PfManager::PfManager(Env& env)
                        options().proof.proofCheck,
                        static_cast<uint32_t>(options().proof.proofPedantic),
                        d_rewriteDb.get()));
-  d_pnm.reset(new ProofNodeManager(env.getNodeManager(),
+  d_pnm.reset(new ProofNodeManager(statisticsRegistry(),
+                                   env.getNodeManager(),
                                    env.getOptions(),
                                    env.getRewriter(),
                                    d_pchecker.get()));
+  if (options().proof.proofCompressRes)
+  {
+    d_pfc = std::make_unique<ProofCompressor>(env);
+  }
   // Now, initialize the proof postprocessor with the environment.
   // By default the post-processor will update all assumptions, which
   // can lead to SCOPE subproofs of the form
@@ -225,6 +232,14 @@ std::shared_ptr<ProofNode> PfManager::connectProofToAssertions(
     Trace("smt-proof") << "=====" << std::endl;
   }
 
+  if (d_pfc != nullptr)
+  {
+    Trace("smt-proof")
+        << "SolverEngine::connectProofToAssertions(): compress...\n";
+    // compress before macro steps are expanded by the post-processor
+    d_pfc->compress(pfn, options().proof.proofCompressResTime);
+  }
+
   Trace("smt-proof")
       << "SolverEngine::connectProofToAssertions(): postprocess...\n";
   Assert(d_pfpp != nullptr);
@@ -48,6 +48,7 @@ namespace smt {
 
 class Assertions;
 class PreprocessProofGenerator;
+class ProofCompressor;
 class ProofPostprocess;
 
 /**
@@ -188,6 +189,8 @@ class PfManager : protected EnvObj
   std::unique_ptr<ProofNodeManager> d_pnm;
   /** A proof logger, if proofLog is enabled */
   std::unique_ptr<ProofLogger> d_plog;
+  /** The resolution proof compressor, if proofCompressRes is enabled */
+  std::unique_ptr<smt::ProofCompressor> d_pfc;
   /** The proof post-processor */
   std::unique_ptr<smt::ProofPostprocess> d_pfpp;
   /** The preprocess proof generator. */
@@ -778,6 +778,32 @@ void SetDefaults::setDefaultsPost(const LogicInfo& logic, Options& opts) const
     SET_AND_NOTIFY_VAL_SYM(smt, repeatSimp, repeatSimp, "logic");
   }
 
+  // Lazy bit-blasting of relevant atoms is done by the BITBLAST_INTERNAL
+  // solver, which requires the relevance manager. It is only sound for
+  // QF_BV, since the relevance manager does not justify the literals of
+  // lemmas, e.g. of instantiations or of splits on shared terms.
+  if (opts.bv.bvBitblastRelevant
+      && (logic.isQuantified() || !logic.isPure(THEORY_BV)))
+  {
+    SET_AND_NOTIFY(bv, bvBitblastRelevant, false, "logic");
+  }
+  if (opts.bv.bvBitblastRelevant)
+  {
+    if (opts.bv.bvSolver != options::BVSolver::BITBLAST_INTERNAL)
+    {
+      if (opts.bv.bvSolverWasSetByUser)
+      {
+        throw FatalOptionException(
+            "bv-bitblast-relevant requires bv-solver=bitblast-internal.");
+      }
+      SET_AND_NOTIFY(bv,
+                     bvSolver,
+                     options::BVSolver::BITBLAST_INTERNAL,
+                     "bv-bitblast-relevant");
+    }
+    SET_AND_NOTIFY(theory, relevanceFilter, true, "bv-bitblast-relevant");
+  }
+
   /* Disable bit-level propagation by default for the BITBLAST solver. */
   if (opts.bv.bvSolver == options::BVSolver::BITBLAST)
   {
@@ -1105,6 +1131,12 @@ bool SetDefaults::incompatibleWithProofs(Options& opts,
     reason << "global-negate";
     return true;
   }
+  if (opts.smt.solveIntAsBVInc)
+  {
+    // replaces the assertions by true without a proof when it finds a model
+    reason << "solveIntAsBVInc";
+    return true;
+  }
   bool isFullPf = (opts.smt.proofMode == options::ProofMode::FULL
                    || opts.smt.proofMode == options::ProofMode::FULL_STRICT);
   if (isSygus(opts))
@@ -1262,6 +1294,11 @@ bool SetDefaults::incompatibleWithIncremental(const LogicInfo& logic,
     reason << "solveIntAsBV";
     return true;
   }
+  if (opts.smt.solveIntAsBVInc)
+  {
+    reason << "solveIntAsBVInc";
+    return true;
+  }
   if (opts.smt.deepRestartMode != options::DeepRestartMode::NONE)
   {
     reason << "deep restarts";
@@ -54,6 +54,7 @@
 #include "smt/model.h"
 #include "smt/model_blocker.h"
 #include "smt/model_core_builder.h"
+#include "smt/optimization_solver.h"
 #include "smt/preprocessor.h"
 #include "smt/proof_manager.h"
 #include "smt/quant_elim_solver.h"
@@ -66,7 +67,9 @@
 #include "smt/sygus_solver.h"
 #include "smt/timeout_core_manager.h"
 #include "smt/unsat_core_manager.h"
+#include "theory/arith/theory_arith.h"
 #include "theory/datatypes/sygus_datatype_utils.h"
+#include "theory/inference_profiler.h"
 #include "theory/quantifiers/candidate_rewrite_database.h"
 #include "theory/quantifiers/instantiation_list.h"
 #include "theory/quantifiers/oracle_engine.h"
@@ -85,6 +88,7 @@
 #include "util/sexpr.h"
 #include "util/statistics_registry.h"
 #include "util/string.h"
+#include "util/trace_events.h"
 
 // required for hacks related to old proofs for unsat cores
 #include "base/configuration.h"
@@ -132,6 +136,8 @@ SolverEngine::SolverEngine(NodeManager* nm, const Options* optr)
   // make the quantifier elimination solver
   d_quantElimSolver.reset(
       new QuantElimSolver(*d_env.get(), *d_smtSolver, d_ctxManager.get()));
+  // make the optimization solver
+  d_optSolver.reset(new OptimizationSolver(*d_env.get()));
 }
 
 bool SolverEngine::isFullyInited() const { return d_state->isFullyInited(); }
@@ -200,6 +206,19 @@ void SolverEngine::finishInit()
   }
   // enable proof support in the environment/rewriter
   d_env->finishInit(d_pfManager.get());
+  // record trace events if requested, internal subsolvers are not traced
+  // since they would overwrite the trace of the main solver
+  if (!d_isInternalSubsolver && !d_env->getOptions().base.traceEvents.empty())
+  {
+    d_env->d_traceEvents.reset(
+        new TraceEventRecorder(d_env->getOptions().base.traceEvents,
+                               d_env->getOptions().base.traceEventsSize));
+  }
+  if (!d_isInternalSubsolver && d_env->getOptions().theory.profileInferences)
+  {
+    d_env->d_infProfiler.reset(
+        new theory::InferenceProfiler(d_env->getStatisticsRegistry()));
+  }
 
   Trace("smt-debug") << "SolverEngine::finishInit" << std::endl;
   d_smtSolver->finishInit();
@@ -274,6 +293,7 @@ SolverEngine::~SolverEngine()
     d_abductSolver.reset(nullptr);
     d_interpolSolver.reset(nullptr);
     d_quantElimSolver.reset(nullptr);
+    d_optSolver.reset(nullptr);
     d_sygusSolver.reset(nullptr);
     d_smtDriver.reset(nullptr);
     d_smtSolver.reset(nullptr);
@@ -660,7 +680,10 @@ void SolverEngine::defineFunctionRec(Node func,
   defineFunctionsRec(funcs, formals_multi, formulas, global);
 }
 
-TheoryModel* SolverEngine::getAvailableModel(const char* c) const
+TheoryModel* SolverEngine::getAvailableModel(
+    const char* c,
+    const std::vector<Node>& terms,
+    const std::vector<TypeNode>& types) const
 {
   if (!d_env->getOptions().theory.assignFunctionValues)
   {
@@ -694,9 +717,23 @@ TheoryModel* SolverEngine::getAvailableModel(const char* c) const
   // resources while building a model, but this ensures that we return a model
   // if a problem was solved within the allocated resources.
   getResourceManager()->setEnabled(false);
-  TheoryModel* m = d_state->getMode() == SmtMode::SAT_UNKNOWN
-                       ? te->getModel()
-                       : te->getBuiltModel();
+  TheoryModel* m = nullptr;
+  if (d_state->getMode() == SmtMode::SAT_UNKNOWN)
+  {
+    m = te->getModel();
+  }
+  else if ((!terms.empty() || !types.empty())
+           && d_env->getOptions().smt.modelCoresMode
+                  == options::ModelCoresMode::NONE)
+  {
+    // we only need the model for the given terms and types, model cores
+    // require the full model
+    m = te->getBuiltModel(terms, types);
+  }
+  else
+  {
+    m = te->getBuiltModel();
+  }
   getResourceManager()->setEnabled(true);
 
   if (m == nullptr)
@@ -816,15 +853,31 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
   // update the state to indicate we are about to run a check-sat
   d_state->notifyCheckSat();
 
-  // Call the SMT solver driver to check for satisfiability. Note that in the
-  // case of options like e.g. deep restarts, this may invokve multiple calls
-  // to check satisfiability in the underlying SMT solver
-  Result r = d_smtDriver->checkSat(assumptions);
+  Result r;
+  if (d_optSolver->hasObjectives())
+  {
+    // Optimize the objectives, which is done by a subsolver that is
+    // responsible for the model of the returned solution.
+    std::vector<Node> asserts = getAssertionsInternal();
+    std::unordered_set<Node> adefs =
+        d_smtSolver->getAssertions().getCurrentAssertionListDefitions();
+    r = d_optSolver->checkOpt(asserts, adefs, assumptions);
+    Trace("smt") << "SolverEngine::checkSat(" << assumptions << ") => " << r
+                 << endl;
+    d_state->notifyCheckSatResult(r, d_optSolver->getSubSolver());
+  }
+  else
+  {
+    // Call the SMT solver driver to check for satisfiability. Note that in the
+    // case of options like e.g. deep restarts, this may invokve multiple
+    // calls to check satisfiability in the underlying SMT solver
+    r = d_smtDriver->checkSat(assumptions);
 
-  Trace("smt") << "SolverEngine::checkSat(" << assumptions << ") => " << r
-               << endl;
-  // notify our state of the check-sat result
-  d_state->notifyCheckSatResult(r);
+    Trace("smt") << "SolverEngine::checkSat(" << assumptions << ") => " << r
+                 << endl;
+    // notify our state of the check-sat result
+    d_state->notifyCheckSatResult(r);
+  }
 
   // Check that SAT results generate a model correctly.
   if (d_env->getOptions().smt.checkModels)
@@ -856,7 +909,6 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
   {
     printStatisticsDiff();
   }
-
   // set the filename on the result
   const std::string& filename = d_env->getOptions().driver.filename;
   return Result(r, filename);
@@ -911,6 +963,44 @@ std::pair<Result, std::vector<Node>> SolverEngine::getTimeoutCore(
   return std::pair<Result, std::vector<Node>>(ret.first, core);
 }
 
+void SolverEngine::addObjective(const Node& t, bool minimize)
+{
+  Trace("smt") << "SMT addObjective(" << t << ", " << minimize << ")" << endl;
+  beginCall();
+  ensureWellFormedTerm(t, "add objective");
+  TypeNode tn = t.getType();
+  if (!tn.isRealOrInt() && !tn.isBitVector())
+  {
+    std::stringstream ss;
+    ss << "Cannot optimize term " << t << " of type " << tn
+       << ", expected a term of type Int, Real or bit-vector.";
+    throw ModalException(ss.str().c_str());
+  }
+  d_optSolver->addObjective(t, minimize);
+}
+
+std::vector<std::tuple<Node, Node, OmtResult>> SolverEngine::getObjectives()
+{
+  Trace("smt") << "SMT getObjectives()" << endl;
+  if (!isSmtModeSat() || d_state->getStatusSolver() == nullptr
+      || d_state->getStatusSolver() != d_optSolver->getSubSolver())
+  {
+    throw RecoverableModalException(
+        "Cannot get objectives unless immediately preceded by a SAT or "
+        "UNKNOWN response to a query with objectives.");
+  }
+  std::vector<smt::OptimizationObjective> objs = d_optSolver->getObjectives();
+  const std::vector<smt::OptimizationResult>& results =
+      d_optSolver->getResults();
+  Assert(objs.size() == results.size());
+  std::vector<std::tuple<Node, Node, OmtResult>> res;
+  for (size_t i = 0, nobjs = objs.size(); i < nobjs; i++)
+  {
+    res.emplace_back(objs[i].d_target, results[i].d_value, results[i].d_result);
+  }
+  return res;
+}
+
 std::vector<Node> SolverEngine::getUnsatAssumptions(void)
 {
   // see if another solver engine was responsible for the last status
@@ -1233,34 +1323,10 @@ Node SolverEngine::getValue(const Node& t, bool fromUser)
   Trace("smt") << "SMT getValue(" << t << ")" << endl;
   TypeNode expectedType = t.getType();
 
-  // We must expand definitions here, which replaces certain subterms of t
-  // by the form that is used internally. This is necessary for some corner
-  // cases of get-value to be accurate, e.g., when getting the value of
-  // a division-by-zero term, we require getting the appropriate skolem
-  // function corresponding to division-by-zero which may have been used during
-  // the previous satisfiability check.
-  std::unordered_map<Node, Node> cache;
-  ExpandDefs expDef(*d_env.get());
-  // Must apply substitutions first to ensure we expand definitions in the
-  // solved form of t as well.
-  Node n = d_smtSolver->getPreprocessor()->applySubstitutions(t);
-  n = expDef.expandDefinitions(n, cache);
-
-  Trace("smt") << "--- getting value of " << n << endl;
-  // There are two ways model values for terms are computed (for historical
-  // reasons).  One way is that used in check-model; the other is that
-  // used by the Model classes.  It's not clear to me exactly how these
-  // two are different, but they need to be unified.  This ugly hack here
-  // is to fix bug 554 until we can revamp boolean-terms and models [MGD]
-
-  // AJR : necessary?
-  if (!n.getType().isFunction())
-  {
-    n = d_env->getRewriter()->rewrite(n);
-  }
+  Node n = getValueTerm(t);
 
   Trace("smt") << "--- getting value of " << n << endl;
-  TheoryModel* m = getAvailableModel("get-value");
+  TheoryModel* m = getAvailableModel("get-value", {n});
   Assert(m != nullptr);
   Node resultNode = m->getValue(n);
   Trace("smt") << "--- got value " << n << " = " << resultNode << endl;
@@ -1350,9 +1416,52 @@ Node SolverEngine::getValue(const Node& t, bool fromUser)
   return resultNode;
 }
 
+Node SolverEngine::getValueTerm(const Node& t) const
+{
+  // We must expand definitions here, which replaces certain subterms of t
+  // by the form that is used internally. This is necessary for some corner
+  // cases of get-value to be accurate, e.g., when getting the value of
+  // a division-by-zero term, we require getting the appropriate skolem
+  // function corresponding to division-by-zero which may have been used during
+  // the previous satisfiability check.
+  std::unordered_map<Node, Node> cache;
+  ExpandDefs expDef(*d_env.get());
+  // Must apply substitutions first to ensure we expand definitions in the
+  // solved form of t as well.
+  Node n = d_smtSolver->getPreprocessor()->applySubstitutions(t);
+  n = expDef.expandDefinitions(n, cache);
+
+  Trace("smt") << "--- getting value of " << n << endl;
+  // There are two ways model values for terms are computed (for historical
+  // reasons).  One way is that used in check-model; the other is that
+  // used by the Model classes.  It's not clear to me exactly how these
+  // two are different, but they need to be unified.  This ugly hack here
+  // is to fix bug 554 until we can revamp boolean-terms and models [MGD]
+
+  // AJR : necessary?
+  if (!n.getType().isFunction())
+  {
+    n = d_env->getRewriter()->rewrite(n);
+  }
+  return n;
+}
+
 std::vector<Node> SolverEngine::getValues(const std::vector<Node>& exprs,
                                           bool fromUser)
 {
+  if (exprs.size() > 1 && d_env->getOptions().smt.lazyModelBuild
+      && d_state->getStatusSolver() == nullptr)
+  {
+    // build the model for all terms at once, instead of extending it in
+    // each call to getValue below
+    std::vector<Node> terms;
+    for (const Node& e : exprs)
+    {
+      ensureWellFormedTerm(e, "get value");
+      terms.push_back(getValueTerm(e));
+    }
+    getAvailableModel("get-value", terms);
+  }
   std::vector<Node> result;
   for (const Node& e : exprs)
   {
@@ -1361,10 +1470,40 @@ std::vector<Node> SolverEngine::getValues(const std::vector<Node>& exprs,
   return result;
 }
 
+std::pair<Node, Node> SolverEngine::getInfinitesimalValue(const Node& t)
+{
+  SolverEngine* ssolver = d_state->getStatusSolver();
+  if (ssolver != nullptr)
+  {
+    return ssolver->getInfinitesimalValue(t);
+  }
+  Assert(t.getType().isRealOrInt());
+  std::pair<Node, Node> res;
+  if (!isSmtModeSat())
+  {
+    return res;
+  }
+  Node n = getValueTerm(t);
+  TheoryEngine* te = d_smtSolver->getTheoryEngine();
+  Assert(te != nullptr);
+  theory::arith::TheoryArith* ta =
+      static_cast<theory::arith::TheoryArith*>(te->theoryOf(THEORY_ARITH));
+  Rational c, k;
+  if (ta != nullptr && ta->getInfinitesimalValue(n, c, k))
+  {
+    NodeManager* nm = d_env->getNodeManager();
+    res.first = nm->mkConstReal(c);
+    res.second = nm->mkConstReal(k);
+  }
+  Trace("smt") << "SMT getInfinitesimalValue(" << t << ") = " << res.first
+               << " + " << res.second << " * d" << endl;
+  return res;
+}
+
 std::vector<Node> SolverEngine::getModelDomainElements(TypeNode tn) const
 {
   Assert(tn.isUninterpretedSort());
-  TheoryModel* m = getAvailableModel("getModelDomainElements");
+  TheoryModel* m = getAvailableModel("getModelDomainElements", {}, {tn});
   return m->getDomainElements(tn);
 }
 
@@ -1467,6 +1606,47 @@ void SolverEngine::blockModelValues(const std::vector<Node>& exprs)
   assertFormulaInternal(eblocker);
 }
 
+Result SolverEngine::enumerateModels(
+    const std::vector<Node>& terms,
+    std::function<bool(const std::vector<Node>&)> callback,
+    uint64_t limit)
+{
+  Trace("smt") << "SMT enumerateModels()" << endl;
+  ensureWellFormedTerms(terms, "enumerate models");
+  ModelBlocker mb(*d_env.get());
+  Result r;
+  for (uint64_t i = 0; limit == 0 || i < limit; i++)
+  {
+    r = checkSat();
+    if (r.getStatus() != Result::SAT)
+    {
+      break;
+    }
+    Trace("smt") << "--- enumerated model #" << i << endl;
+    // Build the model once, for the terms only. With lazy model building,
+    // this only assigns values to the part of the model these terms depend
+    // on. The values and the blocker below are both taken from this model.
+    std::vector<Node> valueTerms;
+    for (const Node& t : terms)
+    {
+      valueTerms.push_back(getValueTerm(t));
+    }
+    TheoryModel* m = getAvailableModel("enumerate models", valueTerms);
+    bool cont = callback(getValues(terms, true));
+    // The blocker only depends on the values of terms, hence we do not need
+    // the substituted assertions here.
+    Node blocker =
+        mb.getModelBlocker({}, m, modes::BlockModelsMode::VALUES, valueTerms);
+    beginCall();
+    assertFormulaInternal(blocker);
+    if (!cont)
+    {
+      break;
+    }
+  }
+  return r;
+}
+
 std::pair<Node, Node> SolverEngine::getSepHeapAndNilExpr(void)
 {
   if (!getLogicInfo().isTheoryEnabled(THEORY_SEP))
@@ -2314,6 +2494,38 @@ void SolverEngine::printStatisticsDiff() const
   d_env->getStatisticsRegistry().storeSnapshot();
 }
 
+void SolverEngine::printInferenceProfile(std::ostream& out) const
+{
+  if (d_env->getInferenceProfiler() != nullptr)
+  {
+    d_env->getInferenceProfiler()->print(out);
+  }
+}
+
+void SolverEngine::printInferenceProfileSafe(int fd) const
+{
+  if (d_env->getInferenceProfiler() != nullptr)
+  {
+    d_env->getInferenceProfiler()->printSafe(fd);
+  }
+}
+
+void SolverEngine::flushTraceEvents() const
+{
+  if (d_env->getTraceEvents() != nullptr)
+  {
+    d_env->getTraceEvents()->flush();
+  }
+}
+
+void SolverEngine::flushTraceEventsSafe() const
+{
+  if (d_env->getTraceEvents() != nullptr)
+  {
+    d_env->getTraceEvents()->flushSafe();
+  }
+}
+
 void SolverEngine::setOption(const std::string& key,
                              const std::string& value,
                              bool fromUser)
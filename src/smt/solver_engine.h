@@ -17,9 +17,11 @@
 
 #include <cvc5/cvc5_export.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -27,6 +29,7 @@
 #include "options/options.h"
 #include "smt/smt_mode.h"
 #include "theory/logic_info.h"
+#include "util/omt_result.h"
 #include "util/result.h"
 #include "util/synth_result.h"
 
@@ -68,6 +71,7 @@ class AbductionSolver;
 class InterpolationSolver;
 class QuantElimSolver;
 class FindSynthSolver;
+class OptimizationSolver;
 
 struct SolverEngineStatistics;
 class PfManager;
@@ -226,6 +230,30 @@ class CVC5_EXPORT SolverEngine
    */
   void blockModelValues(const std::vector<Node>& exprs);
 
+  /**
+   * Enumerate the models of the current assertions, projected onto terms.
+   * Only permitted if produce-models and incremental solving are on.
+   *
+   * This repeatedly checks satisfiability, passes the model values of terms
+   * to callback, and blocks these values as in blockModelValues. It stops
+   * when the assertions become unsatisfiable, when limit models have been
+   * enumerated (if limit is non-zero), or when callback returns false. Each
+   * enumerated model is blocked, so that a later call resumes enumeration.
+   *
+   * Compared to calling checkSat, getValue and blockModelValues in a loop,
+   * the model of each check is built once, for the projection terms only
+   * (see ModelManager::buildPartialModel), and the blocking constraint is
+   * computed from the values of the projection terms in this model, without
+   * substituting the assertions.
+   *
+   * @return The result of the last satisfiability check, which is unsat if
+   * all projected models were enumerated.
+   */
+  Result enumerateModels(
+      const std::vector<Node>& terms,
+      std::function<bool(const std::vector<Node>&)> callback,
+      uint64_t limit);
+
   /**
    * Declare heap. For smt2 inputs, this is called when the command
    * (declare-heap (locT datat)) is invoked by the user. This sets locT as the
@@ -362,6 +390,22 @@ class CVC5_EXPORT SolverEngine
    */
   std::vector<Node> getUnsatAssumptions(void);
 
+  /**
+   * Add an objective that minimizes (or maximizes) term t, which is of type
+   * Int, Real or bit-vector. The objective is valid in the current user
+   * context. If there are objectives, checkSat returns a solution that is
+   * optimal for them, where multiple objectives are combined according to the
+   * option opt-combination.
+   */
+  void addObjective(const Node& t, bool minimize);
+  /**
+   * Get the values of the objectives in the solution of the last checkSat,
+   * which must have had a SAT or UNKNOWN response. Returns a list of tuples
+   * of an objective, its value and the result of optimizing it, which
+   * states whether the value is its optimum.
+   */
+  std::vector<std::tuple<Node, Node, OmtResult>> getObjectives();
+
   /*---------------------------- sygus commands  ---------------------------*/
 
   /**
@@ -524,6 +568,19 @@ class CVC5_EXPORT SolverEngine
   std::vector<Node> getValues(const std::vector<Node>& exprs,
                               bool fromUser = false);
 
+  /**
+   * Get the value of the arithmetic term t in the last model as c + k * d,
+   * where d is the infinitesimal that the linear arithmetic solver uses for
+   * strict bounds. The value of t in the model is c + k * d for the value
+   * of d chosen by the model, and any smaller positive value of d gives
+   * another model of the linear arithmetic constraints.
+   *
+   * @param t The term, of type Int or Real.
+   * @return The pair (c, k) of real constants, or a pair of null nodes if
+   * the linear arithmetic solver has no such value for t.
+   */
+  std::pair<Node, Node> getInfinitesimalValue(const Node& t);
+
   /**
    * @return the domain elements for uninterpreted sort tn.
    */
@@ -840,6 +897,20 @@ class CVC5_EXPORT SolverEngine
    */
   void printStatisticsDiff() const;
 
+  /** Print the inference profile to out, if --profile-inferences is set. */
+  void printInferenceProfile(std::ostream& out) const;
+  /** Same as printInferenceProfile(), but safe to use in a signal handler. */
+  void printInferenceProfileSafe(int fd) const;
+
+  /**
+   * Write the trace events to the file given by --trace-events, if enabled.
+   * The events are also written when this SolverEngine is destroyed. Since
+   * each call rewrites the whole file, this should only be called on exit.
+   */
+  void flushTraceEvents() const;
+  /** Same as flushTraceEvents(), but safe to use in a signal handler. */
+  void flushTraceEventsSafe() const;
+
   /** Get the options object (const and non-const versions) */
   Options& getOptions();
   const Options& getOptions() const;
@@ -965,10 +1036,26 @@ class CVC5_EXPORT SolverEngine
    * by this class is currently available, which means that cvc5 is producing
    * models, and is in "SAT mode", otherwise a recoverable exception is thrown.
    *
+   * If terms or types are non-empty, the model is only guaranteed to be
+   * built for the values of the given terms and the domain elements of the
+   * given types when lazy model building is enabled (see
+   * TheoryEngine::getBuiltModel).
+   *
    * @param c used for giving an error message to indicate the context
    * this method was called.
+   * @param terms The terms whose values are requested
+   * @param types The types whose domain elements are requested
+   */
+  theory::TheoryModel* getAvailableModel(
+      const char* c,
+      const std::vector<Node>& terms = {},
+      const std::vector<TypeNode>& types = {}) const;
+  /**
+   * Get the internal form of term t whose value is requested in getValue,
+   * i.e., t after applying top-level substitutions, expanding definitions
+   * and rewriting.
    */
-  theory::TheoryModel* getAvailableModel(const char* c) const;
+  Node getValueTerm(const Node& t) const;
   /**
    * Get the available proof, which is that of the prop engine if SAT
    * proof producing, or else a dummy proof SAT_REFUTATION whose assumptions
@@ -1119,6 +1206,8 @@ class CVC5_EXPORT SolverEngine
   std::unique_ptr<smt::InterpolationSolver> d_interpolSolver;
   /** The solver for quantifier elimination queries */
   std::unique_ptr<smt::QuantElimSolver> d_quantElimSolver;
+  /** The solver for optimization queries */
+  std::unique_ptr<smt::OptimizationSolver> d_optSolver;
 
   /**
    * The logic set by the user. The actual logic, which may extend the user's
@@ -24,9 +24,8 @@
 #include "smt/assertions.h"
 #include "smt/env.h"
 #include "smt/print_benchmark.h"
-#include "smt/set_defaults.h"
+#include "smt/unsat_core_minimizer.h"
 #include "theory/quantifiers/skolemize.h"
-#include "theory/smt_engine_subsolver.h"
 
 namespace cvc5::internal {
 namespace smt {
@@ -34,8 +33,14 @@ namespace smt {
 UnsatCoreManager::UnsatCoreManager(Env& env, SmtSolver& slv, PfManager& pfm)
     : EnvObj(env), d_slv(slv), d_pfm(pfm)
 {
+  if (options().smt.minimalUnsatCores)
+  {
+    d_ucMin.reset(new UnsatCoreMinimizer(env));
+  }
 }
 
+UnsatCoreManager::~UnsatCoreManager() {}
+
 std::vector<Node> UnsatCoreManager::getUnsatCore(bool isInternal)
 {
   prop::PropEngine* pe = d_slv.getPropEngine();
@@ -226,58 +231,12 @@ std::vector<Node> UnsatCoreManager::reduceUnsatCore(
 {
   Assert(options().smt.produceUnsatCores)
       << "cannot reduce unsat core if unsat cores are turned off";
+  Assert(d_ucMin != nullptr);
 
   d_env.verbose(1) << "SolverEngine::reduceUnsatCore(): reducing unsat core"
                    << std::endl;
-  std::unordered_set<Node> removed;
   std::unordered_set<Node> adefs = as.getCurrentAssertionListDefitions();
-  for (const Node& skip : core)
-  {
-    std::unique_ptr<SolverEngine> coreChecker;
-    theory::initializeSubsolver(coreChecker, d_env);
-    coreChecker->setLogic(logicInfo());
-    // disable all proof options
-    SetDefaults::disableChecking(coreChecker->getOptions());
-    // add to removed set?
-    removed.insert(skip);
-    // assert everything to the subsolver
-    theory::assertToSubsolver(*coreChecker.get(), core, adefs, removed);
-    Result r;
-    try
-    {
-      r = coreChecker->checkSat();
-    }
-    catch (...)
-    {
-      throw;
-    }
-
-    if (r.getStatus() != Result::UNSAT)
-    {
-      removed.erase(skip);
-      if (r.isUnknown())
-      {
-        d_env.warning()
-            << "SolverEngine::reduceUnsatCore(): could not reduce unsat core "
-               "due to "
-               "unknown result.";
-      }
-    }
-  }
-
-  if (removed.empty())
-  {
-    return core;
-  }
-  std::vector<Node> newUcAssertions;
-  for (const Node& n : core)
-  {
-    if (removed.find(n) == removed.end())
-    {
-      newUcAssertions.push_back(n);
-    }
-  }
-  return newUcAssertions;
+  return d_ucMin->minimize(core, adefs);
 }
 
 void UnsatCoreManager::partitionUnsatCore(const std::vector<Node>& core,
@@ -28,6 +28,7 @@ namespace cvc5::internal {
 namespace smt {
 
 class Assertions;
+class UnsatCoreMinimizer;
 
 /**
  * This class is responsible for managing the proof output of SolverEngine, as
@@ -37,7 +38,7 @@ class UnsatCoreManager : protected EnvObj
 {
  public:
   UnsatCoreManager(Env& env, SmtSolver& slv, PfManager& pfm);
-  ~UnsatCoreManager() {};
+  ~UnsatCoreManager();
   /**
    * Convert preprocessed assertions to the input formulas that imply them. In
    * detail, this converts a set of preprocessed assertions to a set of input
@@ -106,7 +107,7 @@ class UnsatCoreManager : protected EnvObj
                             std::vector<Node>& core,
                             bool isInternal);
   /**
-   * Reduce an unsatisfiable core to make it minimal.
+   * Reduce an unsatisfiable core to make it minimal, see UnsatCoreMinimizer.
    */
   std::vector<Node> reduceUnsatCore(const Assertions& as,
                                     const std::vector<Node>& core);
@@ -121,6 +122,8 @@ class UnsatCoreManager : protected EnvObj
   SmtSolver& d_slv;
   /** Reference to the proof manager */
   PfManager& d_pfm;
+  /** The unsat core minimizer, if minimal unsat cores are enabled */
+  std::unique_ptr<UnsatCoreMinimizer> d_ucMin;
 };
 
 }  // namespace smt
@@ -0,0 +1,300 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Reduction of unsat cores to minimal unsat cores.
+ */
+
+#include "smt/unsat_core_minimizer.h"
+
+#include "expr/node_algorithm.h"
+#include "expr/skolem_manager.h"
+#include "options/smt_options.h"
+#include "smt/env.h"
+#include "smt/set_defaults.h"
+#include "smt/solver_engine.h"
+#include "theory/smt_engine_subsolver.h"
+
+namespace cvc5::internal {
+namespace smt {
+
+UnsatCoreMinimizer::UnsatCoreMinimizer(Env& env)
+    : EnvObj(env),
+      d_incomplete(false),
+      d_numChecks(statisticsRegistry().registerInt("unsatCoreMin::checks")),
+      d_numShrunk(statisticsRegistry().registerInt("unsatCoreMin::shrunk")),
+      d_time(statisticsRegistry().registerTimer("unsatCoreMin::time"))
+{
+}
+
+UnsatCoreMinimizer::~UnsatCoreMinimizer() {}
+
+std::vector<Node> UnsatCoreMinimizer::minimize(
+    const std::vector<Node>& core, const std::unordered_set<Node>& defs)
+{
+  CodeTimer codeTimer(d_time);
+  d_incomplete = false;
+  d_timer.set(options().smt.minimalUnsatCoresTime);
+  options::MinimalUnsatCoresMode mode = options().smt.minimalUnsatCoresMode;
+  Trace("uc-min") << "Minimize unsat core of size " << core.size()
+                  << " with mode " << mode << std::endl;
+  std::vector<Node> result;
+  if (mode == options::MinimalUnsatCoresMode::FRESH)
+  {
+    result = minimizeFresh(core, defs);
+  }
+  else
+  {
+    NodeManager* nm = nodeManager();
+    SkolemManager* sm = nm->getSkolemManager();
+    theory::initializeSubsolver(d_subSolver, d_env);
+    // disable all proof options
+    SetDefaults::disableChecking(d_subSolver->getOptions());
+    d_subSolver->setOption("incremental", "true");
+    d_subSolver->setOption("produce-unsat-assumptions", "true");
+    d_subSolver->setOption("minimal-unsat-cores", "false");
+    std::vector<Node> sels;
+    std::vector<Node> coreDefs;
+    for (const Node& a : core)
+    {
+      if (defs.find(a) != defs.end() && a.getKind() == Kind::EQUAL
+          && a[0].isVar())
+      {
+        d_subSolver->defineFunction(a[0], a[1]);
+        coreDefs.push_back(a);
+        continue;
+      }
+      Node s = sm->mkDummySkolem("uc_sel", nm->booleanType());
+      d_selToAssert[s] = a;
+      d_subSolver->assertFormula(nm->mkNode(Kind::IMPLIES, s, a));
+      sels.push_back(s);
+    }
+    std::vector<Node> cands;
+    if (!isUnsat(sels, cands))
+    {
+      // keep the core if we cannot even show it to be unsat
+      result = core;
+    }
+    else
+    {
+      Trace("uc-min") << "...initial core of core has size " << cands.size()
+                      << std::endl;
+      if (!cands.empty())
+      {
+        cands = mode == options::MinimalUnsatCoresMode::QUICKXPLAIN
+                    ? quickXplain({}, false, cands)
+                    : deletion(cands);
+      }
+      std::unordered_set<Node> keep;
+      std::unordered_set<Node> syms;
+      for (const Node& s : cands)
+      {
+        keep.insert(d_selToAssert[s]);
+        expr::getSymbols(d_selToAssert[s], syms);
+      }
+      // keep the definitions of the functions that are still used
+      bool changed = true;
+      while (changed)
+      {
+        changed = false;
+        for (const Node& d : coreDefs)
+        {
+          if (keep.find(d) == keep.end() && syms.find(d[0]) != syms.end())
+          {
+            keep.insert(d);
+            expr::getSymbols(d[1], syms);
+            changed = true;
+          }
+        }
+      }
+      for (const Node& a : core)
+      {
+        if (keep.find(a) != keep.end())
+        {
+          result.push_back(a);
+        }
+      }
+    }
+    d_subSolver.reset(nullptr);
+    d_selToAssert.clear();
+  }
+  d_timer.set(0);
+  if (d_incomplete)
+  {
+    warning() << "SolverEngine::reduceUnsatCore(): unsat core may not be "
+                 "minimal due to an unknown result or the time budget."
+              << std::endl;
+  }
+  Trace("uc-min") << "...minimized unsat core has size " << result.size()
+                  << std::endl;
+  return result;
+}
+
+std::vector<Node> UnsatCoreMinimizer::minimizeFresh(
+    const std::vector<Node>& core, const std::unordered_set<Node>& defs)
+{
+  std::unordered_set<Node> removed;
+  for (const Node& skip : core)
+  {
+    std::unique_ptr<SolverEngine> coreChecker;
+    theory::initializeSubsolver(coreChecker, d_env);
+    coreChecker->setLogic(logicInfo());
+    // disable all proof options
+    SetDefaults::disableChecking(coreChecker->getOptions());
+    if (!setCheckTimeLimit(*coreChecker))
+    {
+      d_incomplete = true;
+      break;
+    }
+    // add to removed set?
+    removed.insert(skip);
+    // assert everything to the subsolver
+    theory::assertToSubsolver(*coreChecker.get(), core, defs, removed);
+    ++d_numChecks;
+    Result r = coreChecker->checkSat();
+    if (r.getStatus() != Result::UNSAT)
+    {
+      removed.erase(skip);
+      if (r.isUnknown())
+      {
+        d_incomplete = true;
+      }
+    }
+  }
+  std::vector<Node> result;
+  for (const Node& n : core)
+  {
+    if (removed.find(n) == removed.end())
+    {
+      result.push_back(n);
+    }
+  }
+  return result;
+}
+
+std::vector<Node> UnsatCoreMinimizer::quickXplain(
+    const std::vector<Node>& bg, bool checkBg, const std::vector<Node>& cands)
+{
+  Assert(!cands.empty());
+  if (checkBg && isUnsat(bg))
+  {
+    return {};
+  }
+  if (cands.size() == 1)
+  {
+    return cands;
+  }
+  size_t half = cands.size() / 2;
+  std::vector<Node> cands1(cands.begin(), cands.begin() + half);
+  std::vector<Node> cands2(cands.begin() + half, cands.end());
+  // minimize the second half, assuming the first one
+  std::vector<Node> bg1(bg);
+  bg1.insert(bg1.end(), cands1.begin(), cands1.end());
+  std::vector<Node> res2 = quickXplain(bg1, true, cands2);
+  // minimize the first half, assuming what remains of the second one
+  std::vector<Node> bg2(bg);
+  bg2.insert(bg2.end(), res2.begin(), res2.end());
+  std::vector<Node> res = quickXplain(bg2, !res2.empty(), cands1);
+  res.insert(res.end(), res2.begin(), res2.end());
+  return res;
+}
+
+std::vector<Node> UnsatCoreMinimizer::deletion(std::vector<Node> cands)
+{
+  // The candidates before index i are kept. Since cores are returned in the
+  // order of the candidates, the kept ones always come first.
+  std::unordered_set<Node> kept;
+  size_t i = 0;
+  while (i < cands.size())
+  {
+    std::vector<Node> rest;
+    rest.reserve(cands.size() - 1);
+    for (size_t j = 0, n = cands.size(); j < n; ++j)
+    {
+      if (j != i)
+      {
+        rest.push_back(cands[j]);
+      }
+    }
+    std::vector<Node> core;
+    if (isUnsat(rest, core))
+    {
+      cands = core;
+      // kept candidates may be dropped from a core of core
+      i = 0;
+      while (i < cands.size() && kept.find(cands[i]) != kept.end())
+      {
+        ++i;
+      }
+    }
+    else
+    {
+      kept.insert(cands[i]);
+      ++i;
+    }
+  }
+  return cands;
+}
+
+bool UnsatCoreMinimizer::isUnsat(const std::vector<Node>& sels,
+                                 std::vector<Node>& core)
+{
+  if (!setCheckTimeLimit(*d_subSolver))
+  {
+    d_incomplete = true;
+    return false;
+  }
+  ++d_numChecks;
+  Result r = d_subSolver->checkSat(sels);
+  Trace("uc-min-debug") << "check " << sels.size() << " assertions: " << r
+                        << std::endl;
+  if (r.getStatus() != Result::UNSAT)
+  {
+    if (r.isUnknown())
+    {
+      d_incomplete = true;
+    }
+    return false;
+  }
+  std::vector<Node> uassumps = d_subSolver->getUnsatAssumptions();
+  std::unordered_set<Node> uaset(uassumps.begin(), uassumps.end());
+  for (const Node& s : sels)
+  {
+    if (uaset.find(s) != uaset.end())
+    {
+      core.push_back(s);
+    }
+  }
+  d_numShrunk += sels.size() - core.size();
+  return true;
+}
+
+bool UnsatCoreMinimizer::isUnsat(const std::vector<Node>& sels)
+{
+  std::vector<Node> core;
+  return isUnsat(sels, core);
+}
+
+bool UnsatCoreMinimizer::setCheckTimeLimit(SolverEngine& slv)
+{
+  uint64_t budget = options().smt.minimalUnsatCoresTime;
+  if (budget == 0)
+  {
+    return true;
+  }
+  if (d_timer.expired())
+  {
+    return false;
+  }
+  uint64_t elapsed = d_timer.elapsed();
+  slv.setTimeLimit(elapsed < budget ? budget - elapsed : 1);
+  return true;
+}
+
+}  // namespace smt
+}  // namespace cvc5::internal
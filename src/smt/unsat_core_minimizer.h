@@ -0,0 +1,122 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Reduction of unsat cores to minimal unsat cores.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__UNSAT_CORE_MINIMIZER_H
+#define CVC5__SMT__UNSAT_CORE_MINIMIZER_H
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/resource_manager.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class SolverEngine;
+
+namespace smt {
+
+/**
+ * Reduces an unsat core to a minimal one, i.e. one that becomes satisfiable if
+ * any of its assertions is removed.
+ *
+ * Unless the mode is fresh, this uses a single incremental subsolver. Each
+ * assertion a of the core is guarded by a fresh Boolean selector s, i.e. the
+ * subsolver is given (=> s a), and subsets of the core are checked with
+ * checkSat under the selectors of the subset. Hence, the core is preprocessed
+ * only once. Each unsat answer is used to shrink the core further, to the
+ * assertions whose selectors are in the unsat assumptions (core of core).
+ *
+ * Function definitions are given to the subsolver as definitions, not as
+ * guarded assertions. They are removed from the core if the functions they
+ * define no longer occur in it.
+ *
+ * If the time budget is exhausted or a check is inconclusive, the assertions
+ * under consideration are kept. The result is then still an unsat core, but
+ * it may not be minimal.
+ */
+class UnsatCoreMinimizer : protected EnvObj
+{
+ public:
+  UnsatCoreMinimizer(Env& env);
+  ~UnsatCoreMinimizer();
+  /**
+   * Reduce the unsat core `core`.
+   *
+   * @param core The unsat core.
+   * @param defs The function definitions among the current assertions.
+   * @return The reduced core, whose assertions are in the order of `core`.
+   */
+  std::vector<Node> minimize(const std::vector<Node>& core,
+                             const std::unordered_set<Node>& defs);
+
+ private:
+  /** Minimize with a fresh subsolver per candidate removal. */
+  std::vector<Node> minimizeFresh(const std::vector<Node>& core,
+                                  const std::unordered_set<Node>& defs);
+  /**
+   * Minimize the selectors `cands`, whose assertions are unsatisfiable, by
+   * divide and conquer (QuickXplain).
+   *
+   * @param bg The background selectors.
+   * @param checkBg Whether to check the background alone first.
+   * @param cands The candidate selectors, such that bg and cands together are
+   * unsatisfiable.
+   * @return A minimal subset of cands that is unsatisfiable together with bg.
+   */
+  std::vector<Node> quickXplain(const std::vector<Node>& bg,
+                                bool checkBg,
+                                const std::vector<Node>& cands);
+  /**
+   * Minimize the selectors `cands`, whose assertions are unsatisfiable, by
+   * removing them one at a time.
+   */
+  std::vector<Node> deletion(std::vector<Node> cands);
+  /**
+   * Check whether the assertions of the selectors `sels` are unsatisfiable.
+   *
+   * @param sels The selectors.
+   * @param core If the result is true, the subset of sels in the unsat
+   * assumptions of the subsolver, in the order of sels.
+   * @return true if the subsolver answered unsat.
+   */
+  bool isUnsat(const std::vector<Node>& sels, std::vector<Node>& core);
+  /** Same as above, without the core. */
+  bool isUnsat(const std::vector<Node>& sels);
+  /** Set the time limit for the next check, return false if none is left. */
+  bool setCheckTimeLimit(SolverEngine& slv);
+  /** The incremental subsolver */
+  std::unique_ptr<SolverEngine> d_subSolver;
+  /** The assertion of each selector */
+  std::unordered_map<Node, Node> d_selToAssert;
+  /** The timer for the time budget */
+  WallClockTimer d_timer;
+  /** Whether a check was skipped or inconclusive */
+  bool d_incomplete;
+  /** Number of satisfiability checks */
+  IntStat d_numChecks;
+  /** Number of assertions removed by shrinking to the unsat assumptions */
+  IntStat d_numShrunk;
+  /** Time spent minimizing */
+  TimerStat d_time;
+};
+
+}  // namespace smt
+}  // namespace cvc5::internal
+
+#endif /* CVC5__SMT__UNSAT_CORE_MINIMIZER_H */
@@ -0,0 +1,592 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A graph-based solver for difference logic.
+ */
+
+#include "theory/arith/difference_logic_solver.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "theory/arith/arith_msum.h"
+#include "theory/arith/inference_manager.h"
+#include "util/statistics_registry.h"
+
+using namespace cvc5::internal::kind;
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith {
+
+/** The predecessor of the start node of a search */
+static const uint32_t s_noEdge = std::numeric_limits<uint32_t>::max();
+
+/** A min-queue of nodes by distance */
+using NodeQueue =
+    std::priority_queue<std::pair<DeltaRational, uint32_t>,
+                        std::vector<std::pair<DeltaRational, uint32_t>>,
+                        std::greater<std::pair<DeltaRational, uint32_t>>>;
+
+void DifferenceLogicSolver::Search::reset(size_t n)
+{
+  d_dist.resize(n);
+  d_pred.resize(n, s_noEdge);
+  d_seen.resize(n, 0);
+  d_done.resize(n, 0);
+  d_settled.clear();
+  ++d_epoch;
+}
+
+void DifferenceLogicSolver::Search::set(uint32_t x,
+                                        const DeltaRational& d,
+                                        uint32_t pred)
+{
+  d_dist[x] = d;
+  d_pred[x] = pred;
+  d_seen[x] = d_epoch;
+}
+
+DifferenceLogicSolver::DifferenceLogicSolver(Env& env,
+                                             TheoryState& astate,
+                                             InferenceManager& im)
+    : EnvObj(env),
+      d_astate(astate),
+      d_im(im),
+      d_active(true),
+      d_numEdges(context(), 0),
+      d_numFacts(context(), 0),
+      d_disequalities(context()),
+      d_propExp(context()),
+      d_statEdges(
+          statisticsRegistry().registerInt("theory::arith::dl::edges")),
+      d_statConflicts(
+          statisticsRegistry().registerInt("theory::arith::dl::conflicts")),
+      d_statPropagations(statisticsRegistry().registerInt(
+          "theory::arith::dl::propagations")),
+      d_statSplits(
+          statisticsRegistry().registerInt("theory::arith::dl::splits")),
+      d_statDeactivated(
+          statisticsRegistry().registerInt("theory::arith::dl::deactivated"))
+{
+  // the zero node
+  d_nodes.push_back(Node::null());
+  d_pi.emplace_back();
+  d_out.emplace_back();
+  d_in.emplace_back();
+  d_implications.emplace_back();
+}
+
+void DifferenceLogicSolver::deactivate()
+{
+  if (d_active)
+  {
+    Trace("arith-dl") << "DifferenceLogicSolver: deactivated" << std::endl;
+    d_active = false;
+    ++d_statDeactivated;
+  }
+}
+
+void DifferenceLogicSolver::preRegisterTerm(TNode n)
+{
+  if (d_active && n.getType().isBoolean() && !registerAtom(n))
+  {
+    Trace("arith-dl") << "DifferenceLogicSolver: not a difference constraint: "
+                      << n << std::endl;
+    deactivate();
+  }
+}
+
+uint32_t DifferenceLogicSolver::getNodeId(TNode n)
+{
+  std::unordered_map<Node, uint32_t>::const_iterator it = d_nodeIds.find(n);
+  if (it != d_nodeIds.end())
+  {
+    return it->second;
+  }
+  uint32_t id = d_nodes.size();
+  d_nodeIds[n] = id;
+  d_nodes.push_back(n);
+  d_pi.emplace_back();
+  d_out.emplace_back();
+  d_in.emplace_back();
+  d_implications.emplace_back();
+  return id;
+}
+
+bool DifferenceLogicSolver::registerAtom(TNode atom)
+{
+  if (d_atomIds.find(atom) != d_atomIds.end())
+  {
+    return true;
+  }
+  Kind k = atom.getKind();
+  if (k != Kind::GEQ && k != Kind::EQUAL)
+  {
+    return false;
+  }
+  std::map<Node, Node> msum;
+  if (!ArithMSum::getMonomialSumLit(atom, msum))
+  {
+    return false;
+  }
+  // the atom is sum_i c_i x_i + k0 >= 0 (= 0 for equalities)
+  Rational k0;
+  std::vector<std::pair<Node, Rational>> vars;
+  for (const std::pair<const Node, Node>& m : msum)
+  {
+    Rational c = m.second.isNull() ? Rational(1) : m.second.getConst<Rational>();
+    if (m.first.isNull())
+    {
+      k0 = c;
+    }
+    else if (!m.first.isVar()
+             || (!d_type.isNull() && m.first.getType() != d_type))
+    {
+      return false;
+    }
+    else
+    {
+      vars.emplace_back(m.first, c);
+    }
+  }
+  // write it as a * (p - q) + k0 with a > 0
+  Node p, q;
+  Rational a;
+  if (vars.size() == 1)
+  {
+    a = vars[0].second;
+    (a.sgn() > 0 ? p : q) = vars[0].first;
+  }
+  else if (vars.size() == 2 && vars[0].second == -vars[1].second
+           && vars[0].first.getType() == vars[1].first.getType())
+  {
+    size_t i = vars[0].second.sgn() > 0 ? 0 : 1;
+    p = vars[i].first;
+    q = vars[1 - i].first;
+    a = vars[i].second;
+  }
+  else
+  {
+    return false;
+  }
+  a = a.abs();
+  if (d_type.isNull())
+  {
+    d_type = vars[0].first.getType();
+  }
+  bool isInt = d_type.isInteger();
+  // the atom is p - q >= b (= b for equalities)
+  Rational b = -k0 / a;
+  Atom at;
+  at.d_node = atom;
+  at.d_p = p.isNull() ? 0 : getNodeId(p);
+  at.d_q = q.isNull() ? 0 : getNodeId(q);
+  at.d_isEq = (k == Kind::EQUAL);
+  at.d_feasible = true;
+  uint32_t id = d_atoms.size();
+  Node natom = atom.notNode();
+  if (at.d_isEq)
+  {
+    at.d_feasible = !isInt || b.isIntegral();
+    at.d_posWeight = DeltaRational(-b);
+    at.d_negWeight = DeltaRational(b);
+    if (at.d_feasible)
+    {
+      // a path q - p < -b or p - q < b implies the disequality
+      d_implications[at.d_p].push_back({at.d_q, at.d_posWeight, true, natom});
+      d_implications[at.d_q].push_back({at.d_p, at.d_negWeight, true, natom});
+    }
+  }
+  else
+  {
+    if (isInt)
+    {
+      // p - q >= ceil(b), and its negation p - q <= ceil(b) - 1
+      Rational cb(b.ceiling());
+      at.d_posWeight = DeltaRational(-cb);
+      at.d_negWeight = DeltaRational(cb - Rational(1));
+    }
+    else
+    {
+      // p - q >= b, and its negation p - q <= b - delta
+      at.d_posWeight = DeltaRational(-b);
+      at.d_negWeight = DeltaRational(b, Rational(-1));
+    }
+    d_implications[at.d_p].push_back({at.d_q, at.d_posWeight, false, atom});
+    d_implications[at.d_q].push_back({at.d_p, at.d_negWeight, false, natom});
+  }
+  d_atoms.push_back(at);
+  d_atomIds[atom] = id;
+  Trace("arith-dl") << "DifferenceLogicSolver: register " << atom << " as "
+                    << d_nodes[at.d_p] << " - " << d_nodes[at.d_q]
+                    << (at.d_isEq ? " = " : " >= ") << b << std::endl;
+  return true;
+}
+
+void DifferenceLogicSolver::sync()
+{
+  size_t n = d_numEdges.get();
+  // the edges are popped in the reverse order in which they were added, hence
+  // they are the last edges of their lists
+  while (d_edges.size() > n)
+  {
+    const Edge& e = d_edges.back();
+    Assert(d_out[e.d_source].back() == d_edges.size() - 1);
+    Assert(d_in[e.d_target].back() == d_edges.size() - 1);
+    d_out[e.d_source].pop_back();
+    d_in[e.d_target].pop_back();
+    d_edges.pop_back();
+  }
+}
+
+void DifferenceLogicSolver::assertFact(TNode fact)
+{
+  Assert(d_active);
+  sync();
+  bool pol = fact.getKind() != Kind::NOT;
+  TNode atom = pol ? fact : fact[0];
+  std::unordered_map<Node, uint32_t>::const_iterator it = d_atomIds.find(atom);
+  if (it == d_atomIds.end())
+  {
+    if (!registerAtom(atom))
+    {
+      deactivate();
+      return;
+    }
+    it = d_atomIds.find(atom);
+  }
+  d_numFacts = d_numFacts.get() + 1;
+  Trace("arith-dl") << "DifferenceLogicSolver: assert " << fact << std::endl;
+  Atom at = d_atoms[it->second];
+  if (!at.d_isEq)
+  {
+    if (pol)
+    {
+      addEdge(at.d_p, at.d_q, at.d_posWeight, fact);
+    }
+    else
+    {
+      addEdge(at.d_q, at.d_p, at.d_negWeight, fact);
+    }
+  }
+  else if (!pol)
+  {
+    // disequalities are split lazily, see checkDisequalities
+    d_disequalities.push_back(it->second);
+  }
+  else if (!at.d_feasible)
+  {
+    ++d_statConflicts;
+    d_im.conflict(atom, InferenceId::ARITH_DL_CONFLICT);
+  }
+  else if (addEdge(at.d_p, at.d_q, at.d_posWeight, fact))
+  {
+    addEdge(at.d_q, at.d_p, at.d_negWeight, fact);
+  }
+}
+
+bool DifferenceLogicSolver::addEdge(uint32_t u,
+                                    uint32_t v,
+                                    const DeltaRational& w,
+                                    TNode lit)
+{
+  ++d_statEdges;
+  if (d_pi[v] - d_pi[u] > w && !updatePotentials(u, v, w, lit))
+  {
+    return false;
+  }
+  uint32_t e = d_edges.size();
+  d_edges.push_back({u, v, w, lit});
+  d_out[u].push_back(e);
+  d_in[v].push_back(e);
+  d_numEdges = d_edges.size();
+  propagate(e);
+  return true;
+}
+
+bool DifferenceLogicSolver::updatePotentials(uint32_t u,
+                                             uint32_t v,
+                                             const DeltaRational& w,
+                                             TNode lit)
+{
+  // Dijkstra over the amounts gamma(x) < 0 by which the potentials must
+  // decrease, starting with v. If the potential of u must decrease, the path
+  // from v to u and the new edge form a negative cycle.
+  Search& s = d_forward;
+  s.reset(d_nodes.size());
+  NodeQueue queue;
+  DeltaRational gv = d_pi[u] + w - d_pi[v];
+  s.set(v, gv, s_noEdge);
+  queue.emplace(gv, v);
+  while (!queue.empty())
+  {
+    uint32_t x = queue.top().second;
+    queue.pop();
+    if (s.isDone(x))
+    {
+      continue;
+    }
+    s.d_done[x] = s.d_epoch;
+    s.d_settled.push_back(x);
+    DeltaRational px = d_pi[x] + s.d_dist[x];
+    for (uint32_t ei : d_out[x])
+    {
+      const Edge& e = d_edges[ei];
+      uint32_t y = e.d_target;
+      if (s.isDone(y))
+      {
+        continue;
+      }
+      DeltaRational gy = px + e.d_weight - d_pi[y];
+      if (gy.sgn() >= 0 || (s.isSeen(y) && gy >= s.d_dist[y]))
+      {
+        continue;
+      }
+      s.set(y, gy, ei);
+      if (y == u)
+      {
+        std::vector<Node> lits{lit};
+        for (uint32_t z = u; z != v;)
+        {
+          const Edge& pe = d_edges[s.d_pred[z]];
+          lits.push_back(pe.d_lit);
+          z = pe.d_source;
+        }
+        std::sort(lits.begin(), lits.end());
+        lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+        Node conf = nodeManager()->mkAnd(lits);
+        Trace("arith-dl") << "DifferenceLogicSolver: conflict " << conf
+                          << std::endl;
+        ++d_statConflicts;
+        d_im.conflict(conf, InferenceId::ARITH_DL_CONFLICT);
+        return false;
+      }
+      queue.emplace(gy, y);
+    }
+  }
+  for (uint32_t x : s.d_settled)
+  {
+    d_pi[x] += s.d_dist[x];
+  }
+  return true;
+}
+
+void DifferenceLogicSolver::search(uint32_t start,
+                                   bool forward,
+                                   uint64_t limit,
+                                   Search& s)
+{
+  s.reset(d_nodes.size());
+  NodeQueue queue;
+  s.set(start, DeltaRational(), s_noEdge);
+  queue.emplace(DeltaRational(), start);
+  while (!queue.empty() && s.d_settled.size() < limit)
+  {
+    uint32_t x = queue.top().second;
+    queue.pop();
+    if (s.isDone(x))
+    {
+      continue;
+    }
+    s.d_done[x] = s.d_epoch;
+    s.d_settled.push_back(x);
+    for (uint32_t ei : (forward ? d_out[x] : d_in[x]))
+    {
+      const Edge& e = d_edges[ei];
+      uint32_t y = forward ? e.d_target : e.d_source;
+      if (s.isDone(y))
+      {
+        continue;
+      }
+      DeltaRational dy =
+          s.d_dist[x] + e.d_weight + d_pi[e.d_source] - d_pi[e.d_target];
+      if (s.isSeen(y) && dy >= s.d_dist[y])
+      {
+        continue;
+      }
+      s.set(y, dy, ei);
+      queue.emplace(dy, y);
+    }
+  }
+}
+
+void DifferenceLogicSolver::propagate(uint32_t e)
+{
+  uint64_t limit = options().arith.arithDlPropLimit;
+  if (limit == 0)
+  {
+    return;
+  }
+  uint32_t u = d_edges[e].d_source;
+  uint32_t v = d_edges[e].d_target;
+  DeltaRational w = d_edges[e].d_weight;
+  search(u, false, limit, d_backward);
+  search(v, true, limit, d_forward);
+  for (uint32_t s : d_backward.d_settled)
+  {
+    // the shortest path s -> u, by the reduced costs
+    DeltaRational ds = d_backward.d_dist[s] - d_pi[s] + d_pi[u];
+    for (const Implication& im : d_implications[s])
+    {
+      uint32_t t = im.d_target;
+      if (!d_forward.isDone(t))
+      {
+        continue;
+      }
+      DeltaRational d = ds + w + d_forward.d_dist[t] - d_pi[v] + d_pi[t];
+      if (im.d_strict ? !(d < im.d_weight) : !(d <= im.d_weight))
+      {
+        continue;
+      }
+      bool value;
+      if (d_propExp.find(im.d_lit) != d_propExp.end()
+          || d_astate.hasSatValue(im.d_lit, value))
+      {
+        continue;
+      }
+      // the path s -> u -> v -> t
+      std::vector<Node> lits{d_edges[e].d_lit};
+      for (uint32_t z = s; z != u;)
+      {
+        const Edge& pe = d_edges[d_backward.d_pred[z]];
+        lits.push_back(pe.d_lit);
+        z = pe.d_target;
+      }
+      for (uint32_t z = t; z != v;)
+      {
+        const Edge& pe = d_edges[d_forward.d_pred[z]];
+        lits.push_back(pe.d_lit);
+        z = pe.d_source;
+      }
+      std::sort(lits.begin(), lits.end());
+      lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+      Node exp = nodeManager()->mkAnd(lits);
+      Trace("arith-dl") << "DifferenceLogicSolver: propagate " << im.d_lit
+                        << " by " << exp << std::endl;
+      d_propExp.insert(im.d_lit, exp);
+      ++d_statPropagations;
+      if (!d_im.propagateLit(im.d_lit))
+      {
+        return;
+      }
+    }
+  }
+}
+
+TrustNode DifferenceLogicSolver::explain(TNode lit)
+{
+  context::CDHashMap<Node, Node>::const_iterator it = d_propExp.find(lit);
+  if (it == d_propExp.end())
+  {
+    return TrustNode::null();
+  }
+  return TrustNode::mkTrustPropExp(lit, it->second, nullptr);
+}
+
+DeltaRational DifferenceLogicSolver::getValue(uint32_t x) const
+{
+  return d_pi[x] - d_pi[0];
+}
+
+Rational DifferenceLogicSolver::computeDelta() const
+{
+  Rational delta(1);
+  for (const Edge& e : d_edges)
+  {
+    // need slack.c + delta * slack.k >= 0, where slack >= 0
+    DeltaRational slack = e.d_weight - (d_pi[e.d_target] - d_pi[e.d_source]);
+    const Rational& k = slack.getInfinitesimalPart();
+    if (k.sgn() < 0)
+    {
+      Rational bound = slack.getNoninfinitesimalPart() / -k;
+      if (bound < delta)
+      {
+        delta = bound;
+      }
+    }
+  }
+  for (uint32_t id : d_disequalities)
+  {
+    // need diff.c + delta * diff.k != b
+    const Atom& at = d_atoms[id];
+    DeltaRational diff = getValue(at.d_p) - getValue(at.d_q);
+    const Rational& b = at.d_negWeight.getNoninfinitesimalPart();
+    const Rational& k = diff.getInfinitesimalPart();
+    if (!k.isZero())
+    {
+      Rational bad = (b - diff.getNoninfinitesimalPart()) / k;
+      if (bad.sgn() > 0 && bad <= delta)
+      {
+        delta = bad / Rational(2);
+      }
+    }
+  }
+  Assert(delta.sgn() > 0);
+  return delta;
+}
+
+bool DifferenceLogicSolver::checkDisequalities()
+{
+  sync();
+  NodeManager* nm = nodeManager();
+  bool sent = false;
+  for (uint32_t id : d_disequalities)
+  {
+    const Atom& at = d_atoms[id];
+    if (getValue(at.d_p) - getValue(at.d_q) != at.d_negWeight)
+    {
+      continue;
+    }
+    TNode atom = at.d_node;
+    Node lem = nm->mkNode(Kind::OR,
+                          atom,
+                          nm->mkNode(Kind::LT, atom[0], atom[1]),
+                          nm->mkNode(Kind::GT, atom[0], atom[1]));
+    Trace("arith-dl") << "DifferenceLogicSolver: split " << lem << std::endl;
+    if (d_im.lemma(lem, InferenceId::ARITH_SPLIT_DEQ))
+    {
+      ++d_statSplits;
+      sent = true;
+    }
+  }
+  return sent;
+}
+
+void DifferenceLogicSolver::collectModelValues(const std::set<Node>& termSet,
+                                               std::map<Node, Node>& arithModel)
+{
+  sync();
+  NodeManager* nm = nodeManager();
+  Rational delta = computeDelta();
+  for (const Node& n : termSet)
+  {
+    if (!n.isVar() || !n.getType().isRealOrInt())
+    {
+      continue;
+    }
+    Rational value;
+    std::unordered_map<Node, uint32_t>::const_iterator it = d_nodeIds.find(n);
+    if (it != d_nodeIds.end())
+    {
+      DeltaRational dv = getValue(it->second);
+      value = dv.getNoninfinitesimalPart() + dv.getInfinitesimalPart() * delta;
+    }
+    arithModel[n] = n.getType().isInteger() ? nm->mkConstInt(value)
+                                            : nm->mkConstReal(value);
+  }
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
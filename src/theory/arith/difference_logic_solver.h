@@ -0,0 +1,236 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A graph-based solver for difference logic.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__DIFFERENCE_LOGIC_SOLVER_H
+#define CVC5__THEORY__ARITH__DIFFERENCE_LOGIC_SOLVER_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "context/cdlist.h"
+#include "context/cdo.h"
+#include "expr/node.h"
+#include "proof/trust_node.h"
+#include "smt/env_obj.h"
+#include "theory/arith/delta_rational.h"
+#include "theory/theory_state.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith {
+
+class InferenceManager;
+
+/**
+ * A solver for conjunctions of difference constraints x - y <= c, where x and
+ * y are variables or zero, which is used instead of the simplex when all
+ * arithmetic atoms are of this form.
+ *
+ * The asserted literals are the edges of a constraint graph, where an edge
+ * u -> v with weight w stands for x_v - x_u <= w. Strict constraints over the
+ * reals are represented by weights with an infinitesimal part, and strict
+ * constraints over the integers are tightened. The constraints are
+ * satisfiable iff the graph has no cycle of negative weight. This class keeps
+ * a potential function pi with pi(v) - pi(u) <= w for all edges, which is a
+ * model, and updates it incrementally for each new edge with the algorithm of
+ * Cotton and Maler, "Fast and Flexible Difference Constraint Propagation for
+ * DPLL(T)", SAT 2006. If the update fails, the negative cycle is the conflict.
+ * Otherwise, the atoms that are implied by the paths through the new edge are
+ * propagated, which are found by Dijkstra searches from the endpoints of the
+ * edge over the reduced costs w + pi(u) - pi(v) >= 0, bounded by
+ * arithDlPropLimit nodes.
+ *
+ * The solver deactivates itself when an atom that is not a difference
+ * constraint is preregistered, after which the linear solver is used. It
+ * counts the facts asserted to it in the current context, so that the caller
+ * can replay them to the linear solver in that case.
+ */
+class DifferenceLogicSolver : protected EnvObj
+{
+ public:
+  DifferenceLogicSolver(Env& env, TheoryState& astate, InferenceManager& im);
+  /** Are all atoms preregistered so far difference constraints? */
+  bool isActive() const { return d_active; }
+  /** Permanently stop using this solver */
+  void deactivate();
+  /**
+   * Preregister term n, which deactivates this solver if n is an atom that is
+   * not a difference constraint.
+   */
+  void preRegisterTerm(TNode n);
+  /**
+   * Assert fact, which may send a conflict or propagate literals. This
+   * deactivates this solver if the atom of fact is not a difference
+   * constraint, in which case fact is not counted as asserted.
+   */
+  void assertFact(TNode fact);
+  /** The number of facts asserted to this solver in the current context */
+  size_t getNumFacts() const { return d_numFacts.get(); }
+  /**
+   * Check that the asserted disequalities hold in the current model, and send
+   * a splitting lemma for each one that does not. Returns true if a lemma was
+   * sent.
+   */
+  bool checkDisequalities();
+  /** Explain lit, or return null if lit was not propagated by this class */
+  TrustNode explain(TNode lit);
+  /** Add the values of the arithmetic variables of termSet to arithModel */
+  void collectModelValues(const std::set<Node>& termSet,
+                          std::map<Node, Node>& arithModel);
+
+ private:
+  /** An edge source -> target for x_target - x_source <= weight */
+  struct Edge
+  {
+    uint32_t d_source;
+    uint32_t d_target;
+    DeltaRational d_weight;
+    /** The asserted literal that this edge stands for */
+    Node d_lit;
+  };
+  /**
+   * A difference constraint p - q >= b, or p - q = b if d_isEq, where p or q
+   * may be the zero node. The positive literal is the edge p -> q with weight
+   * d_posWeight. The negative literal of an inequality is the edge q -> p with
+   * weight d_negWeight. The positive literal of an equality is in addition
+   * the edge q -> p with weight d_negWeight = b.
+   */
+  struct Atom
+  {
+    Node d_node;
+    uint32_t d_p;
+    uint32_t d_q;
+    DeltaRational d_posWeight;
+    DeltaRational d_negWeight;
+    bool d_isEq;
+    /** False for integer equalities whose constant b is not integral */
+    bool d_feasible;
+  };
+  /**
+   * A literal lit that is implied by a path from its source to target whose
+   * weight is at most (less than, if d_strict) d_weight.
+   */
+  struct Implication
+  {
+    uint32_t d_target;
+    DeltaRational d_weight;
+    bool d_strict;
+    Node d_lit;
+  };
+  /** Scratch space for the searches over the graph */
+  struct Search
+  {
+    /** Start a new search over n nodes */
+    void reset(size_t n);
+    bool isSeen(uint32_t x) const { return d_seen[x] == d_epoch; }
+    bool isDone(uint32_t x) const { return d_done[x] == d_epoch; }
+    void set(uint32_t x, const DeltaRational& d, uint32_t pred);
+    std::vector<DeltaRational> d_dist;
+    /** The edge through which each node was reached */
+    std::vector<uint32_t> d_pred;
+    std::vector<uint64_t> d_seen;
+    std::vector<uint64_t> d_done;
+    /** The nodes whose distance is final, in order */
+    std::vector<uint32_t> d_settled;
+    uint64_t d_epoch = 0;
+  };
+  /** Get the node identifier of variable n, adding it if necessary */
+  uint32_t getNodeId(TNode n);
+  /** Register atom, return false if it is not a difference constraint */
+  bool registerAtom(TNode atom);
+  /** Remove the edges that were popped by backtracking */
+  void sync();
+  /**
+   * Add the edge u -> v with weight w for literal lit. Returns false if this
+   * caused a conflict.
+   */
+  bool addEdge(uint32_t u, uint32_t v, const DeltaRational& w, TNode lit);
+  /**
+   * Update the potentials for the new edge u -> v. Returns false and sends a
+   * conflict if the edge closes a negative cycle.
+   */
+  bool updatePotentials(uint32_t u,
+                        uint32_t v,
+                        const DeltaRational& w,
+                        TNode lit);
+  /** Propagate the literals implied by paths through the edge with index e */
+  void propagate(uint32_t e);
+  /**
+   * Run a Dijkstra search over the reduced costs from start, on the outgoing
+   * edges if forward and on the incoming edges otherwise, that settles at
+   * most limit nodes.
+   */
+  void search(uint32_t start, bool forward, uint64_t limit, Search& s);
+  /**
+   * Get a positive value for the infinitesimal such that the potentials
+   * satisfy all edges and the asserted disequalities.
+   */
+  Rational computeDelta() const;
+  /** The value of pi(x) - pi(zero) */
+  DeltaRational getValue(uint32_t x) const;
+  /** Reference to the state */
+  TheoryState& d_astate;
+  /** Reference to the inference manager */
+  InferenceManager& d_im;
+  /** Whether this solver is used */
+  bool d_active;
+  /** The type of the variables, null until the first one is registered */
+  TypeNode d_type;
+  /** The variables, where the null node at index 0 stands for zero */
+  std::vector<Node> d_nodes;
+  std::unordered_map<Node, uint32_t> d_nodeIds;
+  /** The potential of each node */
+  std::vector<DeltaRational> d_pi;
+  /** The outgoing and incoming edges of each node */
+  std::vector<std::vector<uint32_t>> d_out;
+  std::vector<std::vector<uint32_t>> d_in;
+  /** The implications whose source is each node */
+  std::vector<std::vector<Implication>> d_implications;
+  /** The registered atoms */
+  std::vector<Atom> d_atoms;
+  std::unordered_map<Node, uint32_t> d_atomIds;
+  /** All edges, of which the first d_numEdges are asserted */
+  std::vector<Edge> d_edges;
+  context::CDO<size_t> d_numEdges;
+  /** The number of facts asserted */
+  context::CDO<size_t> d_numFacts;
+  /** The atoms of the asserted disequalities */
+  context::CDList<uint32_t> d_disequalities;
+  /** The explanations of the propagated literals */
+  context::CDHashMap<Node, Node> d_propExp;
+  /** Scratch space for the searches */
+  Search d_forward;
+  Search d_backward;
+  /** Number of edges added */
+  IntStat d_statEdges;
+  /** Number of conflicts */
+  IntStat d_statConflicts;
+  /** Number of propagations */
+  IntStat d_statPropagations;
+  /** Number of disequality splits */
+  IntStat d_statSplits;
+  /** Whether this solver was deactivated */
+  IntStat d_statDeactivated;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__ARITH__DIFFERENCE_LOGIC_SOLVER_H */
@@ -0,0 +1,405 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A floating-point simplex for warm starting the exact simplex.
+ */
+
+#include "theory/arith/linear/float_simplex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+#include "base/output.h"
+#include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/tableau.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/** The row index of non-basic variables */
+static const uint32_t s_nonBasic = std::numeric_limits<uint32_t>::max();
+/** The relative tolerance for bounds */
+static const double s_feasibilityTolerance = 1e-9;
+/** The smallest absolute value of a coefficient that we pivot on */
+static const double s_pivotTolerance = 1e-9;
+/** Coefficients whose absolute value is below this are dropped */
+static const double s_dropTolerance = 1e-12;
+
+FloatSimplex::FloatSimplex(Env& env,
+                           const ArithVariables& vars,
+                           const Tableau& tableau)
+    : EnvObj(env),
+      d_vars(vars),
+      d_tableau(tableau),
+      d_mark(0),
+      d_statCalls(statisticsRegistry().registerInt(
+          "theory::arith::FloatSimplex::calls")),
+      d_statPivots(statisticsRegistry().registerInt(
+          "theory::arith::FloatSimplex::pivots")),
+      d_statFeasible(statisticsRegistry().registerInt(
+          "theory::arith::FloatSimplex::feasible")),
+      d_statInfeasible(statisticsRegistry().registerInt(
+          "theory::arith::FloatSimplex::infeasible"))
+{
+}
+
+void FloatSimplex::clear()
+{
+  d_rows.clear();
+  d_rowOf.clear();
+  d_colRows.clear();
+  d_lower.clear();
+  d_upper.clear();
+  d_value.clear();
+  d_rowMark.clear();
+  d_tmp.clear();
+}
+
+void FloatSimplex::initialize()
+{
+  clear();
+  ArithVar n = d_vars.getNumberOfVariables();
+  double inf = std::numeric_limits<double>::infinity();
+  d_rowOf.assign(n, s_nonBasic);
+  d_colRows.resize(n);
+  d_lower.assign(n, -inf);
+  d_upper.assign(n, inf);
+  d_value.assign(n, 0.0);
+  // The infinitesimal parts are ignored, the exact simplex repairs the
+  // solution if this makes it violate a strict bound.
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vend = d_vars.var_end();
+       vi != vend;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    if (d_vars.hasLowerBound(v))
+    {
+      d_lower[v] =
+          d_vars.getLowerBound(v).getNoninfinitesimalPart().getDouble();
+    }
+    if (d_vars.hasUpperBound(v))
+    {
+      d_upper[v] =
+          d_vars.getUpperBound(v).getNoninfinitesimalPart().getDouble();
+    }
+    d_value[v] =
+        d_vars.getAssignment(v).getNoninfinitesimalPart().getDouble();
+  }
+  for (Tableau::BasicIterator it = d_tableau.beginBasic(),
+                              end = d_tableau.endBasic();
+       it != end;
+       ++it)
+  {
+    ArithVar b = *it;
+    uint32_t r = d_rows.size();
+    d_rows.emplace_back();
+    Row& row = d_rows.back();
+    row.d_basic = b;
+    for (Tableau::RowIterator ri = d_tableau.basicRowIterator(b); !ri.atEnd();
+         ++ri)
+    {
+      const Tableau::Entry& entry = *ri;
+      ArithVar x = entry.getColVar();
+      if (x != b)
+      {
+        row.d_entries.emplace_back(x, entry.getCoefficient().getDouble());
+      }
+    }
+    std::sort(row.d_entries.begin(), row.d_entries.end());
+    // recompute the value of the basic variable to be consistent with the
+    // rounded coefficients
+    double value = 0.0;
+    for (const Entry& e : row.d_entries)
+    {
+      d_colRows[e.first].push_back(r);
+      value += e.second * d_value[e.first];
+    }
+    d_value[b] = value;
+    d_rowOf[b] = r;
+  }
+  d_rowMark.assign(d_rows.size(), 0);
+  d_mark = 0;
+}
+
+bool FloatSimplex::approxEqual(double value, double bound)
+{
+  return std::fabs(value - bound)
+         <= s_feasibilityTolerance * std::max(1.0, std::fabs(bound));
+}
+
+double FloatSimplex::violation(ArithVar v) const
+{
+  double value = d_value[v];
+  if (value < d_lower[v] && !approxEqual(value, d_lower[v]))
+  {
+    return d_lower[v] - value;
+  }
+  if (value > d_upper[v] && !approxEqual(value, d_upper[v]))
+  {
+    return value - d_upper[v];
+  }
+  return 0.0;
+}
+
+bool FloatSimplex::hasSlack(ArithVar v, bool inc) const
+{
+  double value = d_value[v];
+  if (inc)
+  {
+    return value < d_upper[v] && !approxEqual(value, d_upper[v]);
+  }
+  return value > d_lower[v] && !approxEqual(value, d_lower[v]);
+}
+
+ArithVar FloatSimplex::selectEntering(uint32_t r, bool inc, bool bland) const
+{
+  ArithVar best = ARITHVAR_SENTINEL;
+  double bestCoeff = 0.0;
+  for (const Entry& e : d_rows[r].d_entries)
+  {
+    double a = std::fabs(e.second);
+    if (a < s_pivotTolerance || !hasSlack(e.first, (e.second > 0) == inc))
+    {
+      continue;
+    }
+    if (bland)
+    {
+      // the entries are sorted, hence this is the smallest candidate
+      return e.first;
+    }
+    if (a > bestCoeff)
+    {
+      best = e.first;
+      bestCoeff = a;
+    }
+  }
+  return best;
+}
+
+double FloatSimplex::getCoefficient(uint32_t r, ArithVar v) const
+{
+  const std::vector<Entry>& entries = d_rows[r].d_entries;
+  std::vector<Entry>::const_iterator it = std::lower_bound(
+      entries.begin(),
+      entries.end(),
+      v,
+      [](const Entry& e, ArithVar x) { return e.first < x; });
+  return (it != entries.end() && it->first == v) ? it->second : 0.0;
+}
+
+void FloatSimplex::addScaled(uint32_t k,
+                             ArithVar v,
+                             double c,
+                             const std::vector<Entry>& src)
+{
+  std::vector<Entry>& dst = d_rows[k].d_entries;
+  d_tmp.clear();
+  std::vector<Entry>::const_iterator i = dst.begin(), iend = dst.end();
+  std::vector<Entry>::const_iterator j = src.begin(), jend = src.end();
+  while (i != iend || j != jend)
+  {
+    if (j == jend || (i != iend && i->first < j->first))
+    {
+      if (i->first != v)
+      {
+        d_tmp.push_back(*i);
+      }
+      ++i;
+    }
+    else if (i == iend || j->first < i->first)
+    {
+      double nc = c * j->second;
+      if (std::fabs(nc) >= s_dropTolerance)
+      {
+        d_tmp.emplace_back(j->first, nc);
+        d_colRows[j->first].push_back(k);
+      }
+      ++j;
+    }
+    else
+    {
+      double nc = i->second + c * j->second;
+      if (std::fabs(nc) >= s_dropTolerance)
+      {
+        d_tmp.emplace_back(i->first, nc);
+      }
+      ++i;
+      ++j;
+    }
+  }
+  dst.swap(d_tmp);
+}
+
+void FloatSimplex::pivotAndUpdate(uint32_t r, ArithVar y, double v)
+{
+  Row& row = d_rows[r];
+  ArithVar x = row.d_basic;
+  double a = getCoefficient(r, y);
+  Assert(std::fabs(a) >= s_pivotTolerance);
+  double theta = (v - d_value[x]) / a;
+  d_value[x] = v;
+  d_value[y] += theta;
+
+  // solve the row for y: y = 1/a x - sum_{l != y} a_l/a x_l
+  std::vector<Entry> entries;
+  entries.reserve(row.d_entries.size());
+  for (const Entry& e : row.d_entries)
+  {
+    if (e.first != y)
+    {
+      entries.emplace_back(e.first, -e.second / a);
+    }
+  }
+  Entry ex(x, 1.0 / a);
+  entries.insert(std::lower_bound(entries.begin(), entries.end(), ex), ex);
+  row.d_entries.swap(entries);
+  row.d_basic = y;
+  d_rowOf[y] = r;
+  d_rowOf[x] = s_nonBasic;
+  d_colRows[x].push_back(r);
+
+  // substitute y in the other rows
+  ++d_mark;
+  d_rowMark[r] = d_mark;
+  std::vector<uint32_t> rows;
+  rows.swap(d_colRows[y]);
+  for (uint32_t k : rows)
+  {
+    if (d_rowMark[k] == d_mark)
+    {
+      continue;
+    }
+    d_rowMark[k] = d_mark;
+    double c = getCoefficient(k, y);
+    if (c == 0.0)
+    {
+      continue;
+    }
+    d_value[d_rows[k].d_basic] += c * theta;
+    addScaled(k, y, c, d_rows[r].d_entries);
+  }
+}
+
+LinResult FloatSimplex::solve(uint64_t pivotLimit)
+{
+  ++d_statCalls;
+  initialize();
+  Trace("arith::float") << "FloatSimplex: " << d_rows.size() << " rows"
+                        << std::endl;
+  LinResult res = LinExhausted;
+  for (uint64_t pivots = 0;; ++pivots)
+  {
+    bool bland = pivots >= pivotLimit / 2;
+    uint32_t row = s_nonBasic;
+    double maxViolation = 0.0;
+    for (uint32_t r = 0, nrows = d_rows.size(); r < nrows; ++r)
+    {
+      double vi = violation(d_rows[r].d_basic);
+      if (vi == 0.0)
+      {
+        continue;
+      }
+      if (bland ? (row == s_nonBasic
+                   || d_rows[r].d_basic < d_rows[row].d_basic)
+                : vi > maxViolation)
+      {
+        row = r;
+        maxViolation = vi;
+      }
+    }
+    if (row == s_nonBasic)
+    {
+      res = LinFeasible;
+      break;
+    }
+    if (pivots >= pivotLimit)
+    {
+      break;
+    }
+    ArithVar b = d_rows[row].d_basic;
+    bool inc = d_value[b] < d_lower[b];
+    ArithVar y = selectEntering(row, inc, bland);
+    if (y == ARITHVAR_SENTINEL)
+    {
+      res = LinInfeasible;
+      break;
+    }
+    pivotAndUpdate(row, y, inc ? d_lower[b] : d_upper[b]);
+    ++d_statPivots;
+  }
+  switch (res)
+  {
+    case LinFeasible:
+      Trace("arith::float") << "FloatSimplex: feasible" << std::endl;
+      ++d_statFeasible;
+      break;
+    case LinInfeasible:
+      Trace("arith::float") << "FloatSimplex: infeasible" << std::endl;
+      ++d_statInfeasible;
+      break;
+    default:
+      Trace("arith::float") << "FloatSimplex: exhausted" << std::endl;
+      clear();
+      break;
+  }
+  return res;
+}
+
+DeltaRational FloatSimplex::getExactValue(ArithVar v) const
+{
+  double value = d_value[v];
+  // prefer the exact bounds, so that the exact assignment after pivoting to
+  // the basis is feasible if the floating-point solution is
+  if (d_vars.hasLowerBound(v) && approxEqual(value, d_lower[v]))
+  {
+    return d_vars.getLowerBound(v);
+  }
+  if (d_vars.hasUpperBound(v) && approxEqual(value, d_upper[v]))
+  {
+    return d_vars.getUpperBound(v);
+  }
+  const DeltaRational& current = d_vars.getAssignment(v);
+  if (approxEqual(value, current.getNoninfinitesimalPart().getDouble()))
+  {
+    return current;
+  }
+  std::optional<Rational> q = Rational::fromDouble(value);
+  return q ? DeltaRational(*q) : current;
+}
+
+ApproximateSimplex::Solution FloatSimplex::extractSolution()
+{
+  ApproximateSimplex::Solution sol;
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vend = d_vars.var_end();
+       vi != vend;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    if (d_rowOf[v] != s_nonBasic)
+    {
+      sol.newBasis.add(v);
+    }
+    else
+    {
+      sol.newValues.set(v, getExactValue(v));
+    }
+  }
+  clear();
+  return sol;
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,150 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A floating-point simplex for warm starting the exact simplex.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__LINEAR__FLOAT_SIMPLEX_H
+#define CVC5__THEORY__ARITH__LINEAR__FLOAT_SIMPLEX_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "smt/env_obj.h"
+#include "theory/arith/delta_rational.h"
+#include "theory/arith/linear/approx_simplex.h"
+#include "theory/arith/linear/arithvar.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * Solves the linear relaxation of the current bounds with a simplex over a
+ * double-precision copy of the tableau.
+ *
+ * The result is not trusted: its basis and the bounds at which the non-basic
+ * variables are fixed are extracted as an ApproximateSimplex::Solution, which
+ * is imported into the exact tableau by AttemptSolutionSDP. That module
+ * pivots the exact tableau to the new basis in one batch, and the exact
+ * simplex then verifies the resulting assignment and repairs it if rounding
+ * errors made the floating-point solution infeasible. Since the non-basic
+ * values of the solution are the exact bounds, the exact assignment after the
+ * batch pivot is usually feasible, so that only the cheap floating-point
+ * pivots are spent on the search.
+ *
+ * The search is the simplex of Dutertre and de Moura, as used by the exact
+ * procedures: a basic variable that violates a bound is pivoted with a
+ * non-basic variable of its row that has slack. For the first half of the
+ * pivot limit, the most violated basic variable and the entering variable with
+ * the largest coefficient are selected, afterwards Bland's rule is used to
+ * prevent cycling.
+ */
+class FloatSimplex : protected EnvObj
+{
+ public:
+  FloatSimplex(Env& env, const ArithVariables& vars, const Tableau& tableau);
+  /**
+   * Copy the current tableau, assignment and bounds, and solve the
+   * relaxation with at most pivotLimit pivots. Returns LinFeasible or
+   * LinInfeasible if the floating-point search finished, and LinExhausted if
+   * the pivot limit was reached, in which case the copy is freed.
+   */
+  LinResult solve(uint64_t pivotLimit);
+  /**
+   * Get the solution of the last call to solve, which must have returned
+   * LinFeasible or LinInfeasible, and free the copy of the tableau.
+   */
+  ApproximateSimplex::Solution extractSolution();
+
+ private:
+  /** An entry of a row, sorted by variable */
+  using Entry = std::pair<ArithVar, double>;
+  /** A row basic = sum_j a_j x_j of the tableau */
+  struct Row
+  {
+    ArithVar d_basic;
+    std::vector<Entry> d_entries;
+  };
+  /** Copy the tableau, assignment and bounds */
+  void initialize();
+  /** Free the copy of the tableau */
+  void clear();
+  /** Get the amount by which v violates its bounds, or 0 */
+  double violation(ArithVar v) const;
+  /** Can v be increased (decreased if !inc) without violating its bounds? */
+  bool hasSlack(ArithVar v, bool inc) const;
+  /** Get the exact value of non-basic variable v in the solution */
+  DeltaRational getExactValue(ArithVar v) const;
+  /** Is value within the tolerance of bound? */
+  static bool approxEqual(double value, double bound);
+  /**
+   * Select the entering variable for the row with index r whose basic
+   * variable must be increased (decreased if !inc), or ARITHVAR_SENTINEL if
+   * there is none.
+   */
+  ArithVar selectEntering(uint32_t r, bool inc, bool bland) const;
+  /**
+   * Pivot the basic variable of row r with y, and update the assignment so
+   * that the old basic variable has value v.
+   */
+  void pivotAndUpdate(uint32_t r, ArithVar y, double v);
+  /** Get the coefficient of v in row r, or 0 */
+  double getCoefficient(uint32_t r, ArithVar v) const;
+  /**
+   * Set row k to row k - c * v + c * src, dropping entries that are close to
+   * zero.
+   */
+  void addScaled(uint32_t k,
+                 ArithVar v,
+                 double c,
+                 const std::vector<Entry>& src);
+  /** Reference to the assignment and bounds */
+  const ArithVariables& d_vars;
+  /** Reference to the exact tableau */
+  const Tableau& d_tableau;
+  /** The rows of the copy of the tableau */
+  std::vector<Row> d_rows;
+  /** The row of each basic variable, or s_nonBasic */
+  std::vector<uint32_t> d_rowOf;
+  /**
+   * The rows in which each variable may occur. This may contain rows that no
+   * longer contain the variable, and duplicates, which are removed lazily.
+   */
+  std::vector<std::vector<uint32_t>> d_colRows;
+  /** The bounds and the assignment of the variables */
+  std::vector<double> d_lower;
+  std::vector<double> d_upper;
+  std::vector<double> d_value;
+  /** Marks for removing duplicates from d_colRows */
+  std::vector<uint64_t> d_rowMark;
+  uint64_t d_mark;
+  /** Scratch space for addScaled */
+  std::vector<Entry> d_tmp;
+  /** Number of calls to solve */
+  IntStat d_statCalls;
+  /** Number of floating-point pivots */
+  IntStat d_statPivots;
+  /** Number of calls that found a feasible or an infeasible relaxation */
+  IntStat d_statFeasible;
+  IntStat d_statInfeasible;
+};
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__ARITH__LINEAR__FLOAT_SIMPLEX_H */
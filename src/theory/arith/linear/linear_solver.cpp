@@ -65,6 +65,12 @@ Node LinearSolver::getCandidateModelValue(TNode var)
 {
   return d_internal.getCandidateModelValue(var);
 }
+bool LinearSolver::getInfinitesimalValue(TNode term,
+                                         Rational& c,
+                                         Rational& k) const
+{
+  return d_internal.getInfinitesimalValue(term, c, k);
+}
 std::pair<bool, Node> LinearSolver::entailmentCheck(TNode lit)
 {
   return d_internal.entailmentCheck(lit);
@@ -87,9 +93,11 @@ ArithCongruenceManager* LinearSolver::getCongruenceManager()
   return d_internal.getCongruenceManager();
 }
 
-bool LinearSolver::outputTrustedLemma(TrustNode lemma, InferenceId id)
+bool LinearSolver::outputTrustedLemma(TrustNode lemma,
+                                      InferenceId id,
+                                      LemmaProperty p)
 {
-  return d_im.trustedLemma(lemma, id);
+  return d_im.trustedLemma(lemma, id, p);
 }
 
 void LinearSolver::outputTrustedConflict(TrustNode conf, InferenceId id)
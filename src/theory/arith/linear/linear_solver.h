@@ -80,6 +80,8 @@ class LinearSolver : protected EnvObj
   void notifySharedTerm(TNode n);
   /** Get candidate model value */
   Node getCandidateModelValue(TNode var);
+  /** Get the value of term as c + k * delta, see TheoryArithPrivate */
+  bool getInfinitesimalValue(TNode term, Rational& c, Rational& k) const;
   /** Do entailment check */
   std::pair<bool, Node> entailmentCheck(TNode lit);
   //--------------------------------- standard check
@@ -106,7 +108,9 @@ class LinearSolver : protected EnvObj
   ArithCongruenceManager* getCongruenceManager();
 
   //======================
-  bool outputTrustedLemma(TrustNode lemma, InferenceId id);
+  bool outputTrustedLemma(TrustNode lemma,
+                          InferenceId id,
+                          LemmaProperty p = LemmaProperty::NONE);
   void outputTrustedConflict(TrustNode conf, InferenceId id);
   void outputPropagate(TNode lit);
   void spendResource(Resource r);
@@ -0,0 +1,239 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Generation of Gomory mixed-integer cuts from the rows of the tableau.
+ */
+
+#include "theory/arith/linear/tableau_cuts.h"
+
+#include <algorithm>
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "smt/env.h"
+#include "theory/arith/linear/constraint.h"
+#include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/tableau.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/** The largest multiplier of a row that we try */
+static const uint32_t s_maxRowMultiplier = 4;
+
+TableauCuts::TableauCuts(Env& env,
+                         const ArithVariables& vars,
+                         const Tableau& tableau)
+    : EnvObj(env),
+      d_vars(vars),
+      d_tableau(tableau),
+      d_statRows(statisticsRegistry().registerInt(
+          "theory::arith::TableauCuts::rows")),
+      d_statCuts(statisticsRegistry().registerInt(
+          "theory::arith::TableauCuts::cuts")),
+      d_statRejected(statisticsRegistry().registerInt(
+          "theory::arith::TableauCuts::rejected"))
+{
+}
+
+std::vector<Node> TableauCuts::getCuts()
+{
+  std::vector<Cut> cuts;
+  for (Tableau::BasicIterator it = d_tableau.beginBasic(),
+                              end = d_tableau.endBasic();
+       it != end;
+       ++it)
+  {
+    ArithVar x = *it;
+    if (!d_vars.isInteger(x) || d_vars.getAssignment(x).isIntegral())
+    {
+      continue;
+    }
+    ++d_statRows;
+    Cut best;
+    bool found = false;
+    for (uint32_t k = 1; k <= s_maxRowMultiplier; k++)
+    {
+      Cut cut;
+      if (getRowCut(x, Rational(k), cut)
+          && (!found || cut.d_norm < best.d_norm))
+      {
+        best = cut;
+        found = true;
+      }
+    }
+    if (!found)
+    {
+      continue;
+    }
+    if (!complexityBelow(best))
+    {
+      ++d_statRejected;
+      continue;
+    }
+    cuts.push_back(best);
+  }
+  // select the cuts with the largest distance to the current assignment
+  std::sort(cuts.begin(), cuts.end(), [](const Cut& a, const Cut& b) {
+    return a.d_norm < b.d_norm;
+  });
+  std::vector<Node> lemmas;
+  size_t maxCuts = options().arith.arithCutsPerRound;
+  for (const Cut& cut : cuts)
+  {
+    if (lemmas.size() >= maxCuts)
+    {
+      break;
+    }
+    Node lem = mkLemma(cut);
+    if (!lem.isNull())
+    {
+      Trace("arith::cuts") << "TableauCuts: " << lem << std::endl;
+      ++d_statCuts;
+      lemmas.push_back(lem);
+    }
+  }
+  return lemmas;
+}
+
+bool TableauCuts::getRowCut(ArithVar x, const Rational& k, Cut& cut) const
+{
+  const DeltaRational& xv = d_vars.getAssignment(x);
+  if (!xv.infinitesimalIsZero())
+  {
+    return false;
+  }
+  Rational f0 = (k * xv.getNoninfinitesimalPart()).floor_frac();
+  if (f0.isZero())
+  {
+    return false;
+  }
+  Rational one(1);
+  Rational rhs(1);
+  Rational norm(0);
+  for (Tableau::RowIterator ri = d_tableau.basicRowIterator(x); !ri.atEnd();
+       ++ri)
+  {
+    const Tableau::Entry& entry = *ri;
+    ArithVar y = entry.getColVar();
+    if (y == x)
+    {
+      continue;
+    }
+    Rational a = k * entry.getCoefficient();
+    const DeltaRational& yv = d_vars.getAssignment(y);
+    if (!yv.infinitesimalIsZero())
+    {
+      return false;
+    }
+    const Rational& val = yv.getNoninfinitesimalPart();
+    // whether y - val is integral
+    bool isInt = d_vars.isInteger(y) && val.isIntegral();
+    // We write y = val + s (at a lower bound) or y = val - s (at an upper
+    // bound) for s >= 0.
+    ConstraintP bound = NullConstraint;
+    bool atLower = false;
+    if (d_vars.hasLowerBound(y) && d_vars.cmpAssignmentLowerBound(y) == 0)
+    {
+      bound = d_vars.getLowerBoundConstraint(y);
+      atLower = true;
+    }
+    else if (d_vars.hasUpperBound(y) && d_vars.cmpAssignmentUpperBound(y) == 0)
+    {
+      bound = d_vars.getUpperBoundConstraint(y);
+    }
+    if (isInt && a.isIntegral())
+    {
+      // the term is integral and does not occur in the cut
+      continue;
+    }
+    if (bound == NullConstraint)
+    {
+      return false;
+    }
+    // The row is k*x = k*xv + sum_j as_j * s_j, that is, the coefficients
+    // of the s_j in the standard form k*x - sum_j as_j * s_j = k*xv are -as_j.
+    Rational as = atLower ? a : -a;
+    Rational alpha;
+    if (isInt)
+    {
+      Rational fj = (-as).floor_frac();
+      alpha = fj <= f0 ? fj / f0 : (one - fj) / (one - f0);
+    }
+    else
+    {
+      alpha = as.sgn() > 0 ? as / (one - f0) : -as / f0;
+    }
+    if (alpha.isZero())
+    {
+      continue;
+    }
+    // alpha * s is alpha * y - alpha * val (at a lower bound) or
+    // alpha * val - alpha * y (at an upper bound)
+    Rational c = atLower ? alpha : -alpha;
+    cut.d_lhs.emplace_back(y, c);
+    rhs += c * val;
+    norm += alpha * alpha;
+    cut.d_explanation.push_back(bound);
+  }
+  if (cut.d_lhs.empty())
+  {
+    return false;
+  }
+  cut.d_rhs = rhs;
+  cut.d_norm = norm;
+  return true;
+}
+
+bool TableauCuts::complexityBelow(const Cut& cut) const
+{
+  uint64_t cap = options().arith.arithCutsRejectSize;
+  if (cut.d_rhs.complexity() > cap)
+  {
+    return false;
+  }
+  for (const std::pair<ArithVar, Rational>& c : cut.d_lhs)
+  {
+    if (c.second.complexity() > cap)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+Node TableauCuts::mkLemma(const Cut& cut) const
+{
+  NodeManager* nm = nodeManager();
+  std::vector<Node> sum;
+  for (const std::pair<ArithVar, Rational>& c : cut.d_lhs)
+  {
+    if (!d_vars.hasNode(c.first))
+    {
+      return Node::null();
+    }
+    sum.push_back(nm->mkNode(
+        Kind::MULT, nm->mkConstReal(c.second), d_vars.asNode(c.first)));
+  }
+  Node lhs = sum.size() == 1 ? sum[0] : nm->mkNode(Kind::ADD, sum);
+  Node lit = rewrite(nm->mkNode(Kind::GEQ, lhs, nm->mkConstReal(cut.d_rhs)));
+  if (lit.isConst())
+  {
+    // the cut is trivial, which is not expected since the current
+    // assignment violates it
+    return Node::null();
+  }
+  Node exp = Constraint::externalExplainByAssertions(nm, cut.d_explanation);
+  return exp.impNode(lit);
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
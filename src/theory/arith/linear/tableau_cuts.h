@@ -0,0 +1,114 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Generation of Gomory mixed-integer cuts from the rows of the tableau.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__LINEAR__TABLEAU_CUTS_H
+#define CVC5__THEORY__ARITH__LINEAR__TABLEAU_CUTS_H
+
+#include <utility>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "theory/arith/linear/arithvar.h"
+#include "theory/arith/linear/constraint_forward.h"
+#include "util/rational.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * Derives cuts from the rows of the exact tableau, without an external
+ * MIP solver.
+ *
+ * Consider the row of a basic integer variable x_b whose current value b is
+ * not integral, x_b = sum_j a_j x_j. If each non-basic x_j with a non-zero
+ * coefficient is at a bound, we can write x_j = l_j + s_j (at a lower bound
+ * l_j) or x_j = u_j - s_j (at an upper bound u_j) with s_j >= 0, and obtain
+ *   x_b = b + sum_j a'_j s_j
+ * where s_j = 0 in the current assignment. With f_0 = frac(b) and
+ * f_j = frac(-a'_j), the Gomory mixed-integer cut is
+ *   sum_{j int, f_j <= f_0} f_j / f_0 s_j
+ *   + sum_{j int, f_j > f_0} (1 - f_j) / (1 - f_0) s_j
+ *   + sum_{j real, a'_j > 0} a'_j / (1 - f_0) s_j
+ *   + sum_{j real, a'_j < 0} -a'_j / f_0 s_j >= 1
+ * which is implied by the bounds and the integrality of x_b, and violated
+ * by the current assignment. Here "j int" requires that x_j is an integer
+ * variable at an integral bound. This is the mixed-integer rounding (MIR)
+ * of the row in this form. We additionally try the rows multiplied by small
+ * integers k, which give the k-cuts of Cornuejols, Li and Vandenbussche, and
+ * keep the strongest cut for each row.
+ *
+ * A non-basic integer variable that is not at a bound is allowed if its
+ * coefficient is integral, since its term is then integral.
+ */
+class TableauCuts : protected EnvObj
+{
+ public:
+  TableauCuts(Env& env, const ArithVariables& vars, const Tableau& tableau);
+  /**
+   * Get cuts that are violated by the current assignment. Each cut is a
+   * lemma of the form (=> B C) where B is the conjunction of the bounds used
+   * to derive the cut C. At most arithCutsPerRound cuts are returned,
+   * preferring the cuts with the largest distance to the current assignment.
+   */
+  std::vector<Node> getCuts();
+
+ private:
+  /** A cut sum_i c_i x_i >= d_rhs */
+  struct Cut
+  {
+    /** The variables and their coefficients */
+    std::vector<std::pair<ArithVar, Rational>> d_lhs;
+    /** The right hand side */
+    Rational d_rhs;
+    /** The bounds used to derive the cut */
+    ConstraintCPVec d_explanation;
+    /**
+     * The squared norm of the coefficients of the cut in terms of the s_j.
+     * Since the cut is violated by 1 in these terms, the cut with the
+     * smallest norm has the largest distance to the current assignment.
+     */
+    Rational d_norm;
+  };
+  /**
+   * Compute the cut for the row of basic variable x multiplied by k. Returns
+   * false if no cut can be derived from this row.
+   */
+  bool getRowCut(ArithVar x, const Rational& k, Cut& cut) const;
+  /** Is the complexity of all coefficients of the cut below the limit? */
+  bool complexityBelow(const Cut& cut) const;
+  /** Make the lemma for the cut, or null if it cannot be expressed */
+  Node mkLemma(const Cut& cut) const;
+  /** Reference to the assignment and bounds */
+  const ArithVariables& d_vars;
+  /** Reference to the tableau */
+  const Tableau& d_tableau;
+  /** Number of rows that were considered */
+  IntStat d_statRows;
+  /** Number of cuts that were derived */
+  IntStat d_statCuts;
+  /** Number of cuts that were rejected due to their complexity */
+  IntStat d_statRejected;
+};
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__ARITH__LINEAR__TABLEAU_CUTS_H */
@@ -11,6 +11,7 @@
 
 #include "theory/arith/linear/theory_arith_private.h"
 
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <queue>
@@ -116,6 +117,8 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
                  TableauSizes(&d_tableau),
                  BoundCountingLookup(*this)),
       d_tableau(),
+      d_tableauCuts(env, d_partialModel, d_tableau),
+      d_floatSimplex(env, d_partialModel, d_tableau),
       d_linEq(statisticsRegistry(),
               d_partialModel,
               d_tableau,
@@ -152,6 +155,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
       d_approxCuts(context()),
       d_fullCheckCounter(0),
       d_cutCount(context(), 0),
+      d_cutRounds(context(), 0),
       d_cutInContext(context()),
       d_likelyIntegerInfeasible(context(), false),
       d_guessedCoeffSet(context(), false),
@@ -430,7 +434,12 @@ void TheoryArithPrivate::revertOutOfConflict()
   d_currentPropagationList.clear();
 }
 
-void TheoryArithPrivate::clearUpdates() { d_updatedBounds.purge(); }
+void TheoryArithPrivate::clearUpdates()
+{
+  d_updatedBounds.purge();
+  d_updatedLowerBounds.purge();
+  d_updatedUpperBounds.purge();
+}
 
 void TheoryArithPrivate::zeroDifferenceDetected(ArithVar x)
 {
@@ -630,6 +639,7 @@ bool TheoryArithPrivate::AssertLower(ConstraintP constraint)
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedLowerBounds.softAdd(x_i);
 
   if (TraceIsOn("model"))
   {
@@ -799,6 +809,7 @@ bool TheoryArithPrivate::AssertUpper(ConstraintP constraint)
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedUpperBounds.softAdd(x_i);
 
   if (TraceIsOn("model"))
   {
@@ -910,6 +921,8 @@ bool TheoryArithPrivate::AssertEquality(ConstraintP constraint)
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedLowerBounds.softAdd(x_i);
+  d_updatedUpperBounds.softAdd(x_i);
 
   if (TraceIsOn("model"))
   {
@@ -1094,6 +1107,31 @@ Node TheoryArithPrivate::getCandidateModelValue(TNode term)
   }
 }
 
+bool TheoryArithPrivate::getInfinitesimalValue(TNode term,
+                                               Rational& c,
+                                               Rational& k) const
+{
+  if (d_qflraStatus != Result::SAT)
+  {
+    return false;
+  }
+  try
+  {
+    const DeltaRational drv = getDeltaValue(term);
+    c = drv.getNoninfinitesimalPart();
+    k = drv.getInfinitesimalPart();
+    return true;
+  }
+  catch (DeltaRationalException& dr)
+  {
+    return false;
+  }
+  catch (ModelException& me)
+  {
+    return false;
+  }
+}
+
 bool TheoryArithPrivate::ppAssert(TrustNode tin,
                                   TrustSubstitutionMap& outSubstitutions)
 {
@@ -2047,10 +2085,12 @@ TheoryId TheoryArithPrivate::theoryOf(TNode x) const
   return Theory::theoryOf(x);
 }
 
-bool TheoryArithPrivate::outputTrustedLemma(TrustNode lemma, InferenceId id)
+bool TheoryArithPrivate::outputTrustedLemma(TrustNode lemma,
+                                            InferenceId id,
+                                            LemmaProperty p)
 {
   Trace("arith::channel") << "Arith trusted lemma: " << lemma << std::endl;
-  return d_containing.outputTrustedLemma(lemma, id);
+  return d_containing.outputTrustedLemma(lemma, id, p);
 }
 
 bool TheoryArithPrivate::outputLemma(TNode lem, InferenceId id)
@@ -3399,6 +3439,23 @@ void TheoryArithPrivate::importSolution(
   }
 }
 
+bool TheoryArithPrivate::floatWarmStart()
+{
+  if (d_errorSet.errorEmpty())
+  {
+    return false;
+  }
+  LinResult res =
+      d_floatSimplex.solve(options().arith.arithFloatSimplexPivotLimit);
+  if (res != LinFeasible && res != LinInfeasible)
+  {
+    return false;
+  }
+  importSolution(d_floatSimplex.extractSolution());
+  Trace("arith::float") << "floatWarmStart() " << d_qflraStatus << endl;
+  return d_qflraStatus != Result::UNKNOWN;
+}
+
 bool TheoryArithPrivate::solveRelaxationOrPanic(Theory::Effort effortLevel)
 {
   // if at this point the linear relaxation is still unknown,
@@ -3455,7 +3512,10 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel)
       << safeToCallApprox() << endl;
 
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
-  d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  if (!options().arith.arithFloatSimplex || !floatWarmStart())
+  {
+    d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  }
 
   Trace("TheoryArithPrivate::solveRealRelaxation")
       << "solveRealRelaxation()" << " pass1 " << d_qflraStatus << endl;
@@ -3950,6 +4010,26 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
       }
     }
 
+    // Cuts are derived from the bounds without a proof, hence we only use
+    // them when proofs are disabled. They are sent as removable lemmas, so
+    // that the SAT solver may forget cuts that are no longer useful.
+    if (!emmittedConflictOrSplit && options().arith.arithCuts
+        && !isProofEnabled() && d_cutRounds < options().arith.arithCutsRounds)
+    {
+      d_cutRounds = d_cutRounds + 1;
+      for (const Node& cut : d_tableauCuts.getCuts())
+      {
+        Trace("arith::lemma") << "tableau cut " << cut << endl;
+        if (outputTrustedLemma(TrustNode::mkTrustLemma(cut, nullptr),
+                               InferenceId::ARITH_GOMORY_CUT,
+                               LemmaProperty::REMOVABLE))
+        {
+          emmittedConflictOrSplit = true;
+          d_cutCount = d_cutCount + 1;
+        }
+      }
+    }
+
     if (!emmittedConflictOrSplit)
     {
       bool tryNew;
@@ -4973,7 +5053,7 @@ void TheoryArithPrivate::propagateCandidates()
       }
     }
   }
-  d_updatedBounds.purge();
+  clearUpdates();
 
   while (!d_candidateBasics.empty())
   {
@@ -4988,7 +5068,8 @@ void TheoryArithPrivate::propagateCandidates()
 void TheoryArithPrivate::propagateCandidatesNew()
 {
   /* Four criteria must be met for progagation on a variable to happen using a
-   * row: 0: A new bound has to have been added to the row. 1: The
+   * row: 0: A new bound has to have been added to the row, on the side of
+   * the row bound that is used. 1: The
    * hasBoundsCount for the row must be "full" or be full minus one variable
    *    (This is O(1) to check, but requires book keeping.)
    * 2: The current assignment must be strictly smaller/greater than the current
@@ -5007,21 +5088,41 @@ void TheoryArithPrivate::propagateCandidatesNew()
   {
     return;
   }
+  // the bound counts are needed to select the watched rows
+  UpdateTrackingCallback utcb(&d_linEq);
+  d_partialModel.processBoundsQueue(utcb);
   dumpUpdatedBoundsToRows();
   Assert(d_updatedBounds.empty());
 
-  if (!d_candidateRows.empty())
+  // Visit the shortest rows first. Their implied bounds depend on the fewest
+  // bounds, and are the cheapest to compute and to explain.
+  std::vector<std::pair<uint32_t, RowIndex>> candidates;
+  for (DenseSet::const_iterator i = d_candidateRowsUp.begin(),
+                                iend = d_candidateRowsUp.end();
+       i != iend;
+       ++i)
   {
-    UpdateTrackingCallback utcb(&d_linEq);
-    d_partialModel.processBoundsQueue(utcb);
+    candidates.emplace_back(d_tableau.getRowLength(*i), *i);
   }
-
-  while (!d_candidateRows.empty())
+  for (DenseSet::const_iterator i = d_candidateRowsDown.begin(),
+                                iend = d_candidateRowsDown.end();
+       i != iend;
+       ++i)
+  {
+    if (!d_candidateRowsUp.isMember(*i))
+    {
+      candidates.emplace_back(d_tableau.getRowLength(*i), *i);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  for (const std::pair<uint32_t, RowIndex>& c : candidates)
   {
-    RowIndex candidate = d_candidateRows.back();
-    d_candidateRows.pop_back();
-    propagateCandidateRow(candidate);
+    propagateCandidateRow(c.second,
+                          d_candidateRowsUp.isMember(c.second),
+                          d_candidateRowsDown.isMember(c.second));
   }
+  d_candidateRowsUp.purge();
+  d_candidateRowsDown.purge();
   Trace("arith::prop") << "propagateCandidatesNew end" << endl << endl << endl;
 }
 
@@ -5334,7 +5435,9 @@ bool TheoryArithPrivate::rowImplicationCanBeApplied(RowIndex ridx,
   return false;
 }
 
-bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx)
+bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx,
+                                               bool rowUp,
+                                               bool rowDown)
 {
   BoundCounts hasCount = d_linEq.hasBoundCount(ridx);
   uint32_t rowLength = d_tableau.getRowLength(ridx);
@@ -5351,51 +5454,63 @@ bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx)
     return false;
   }
 
-  if (hasCount.lowerBoundCount() == rowLength)
+  if (rowDown)
   {
-    success |= attemptFull(ridx, false);
-  }
-  else if (hasCount.lowerBoundCount() + 1 == rowLength)
-  {
-    success |= attemptSingleton(ridx, false);
+    if (hasCount.lowerBoundCount() == rowLength)
+    {
+      success |= attemptFull(ridx, false);
+    }
+    else if (hasCount.lowerBoundCount() + 1 == rowLength)
+    {
+      success |= attemptSingleton(ridx, false);
+    }
   }
 
-  if (hasCount.upperBoundCount() == rowLength)
-  {
-    success |= attemptFull(ridx, true);
-  }
-  else if (hasCount.upperBoundCount() + 1 == rowLength)
+  if (rowUp)
   {
-    success |= attemptSingleton(ridx, true);
+    if (hasCount.upperBoundCount() == rowLength)
+    {
+      success |= attemptFull(ridx, true);
+    }
+    else if (hasCount.upperBoundCount() + 1 == rowLength)
+    {
+      success |= attemptSingleton(ridx, true);
+    }
   }
   return success;
 }
 
 void TheoryArithPrivate::dumpUpdatedBoundsToRows()
 {
-  Assert(d_candidateRows.empty());
+  Assert(d_candidateRowsUp.empty() && d_candidateRowsDown.empty());
   DenseSet::const_iterator i = d_updatedBounds.begin();
   DenseSet::const_iterator end = d_updatedBounds.end();
   for (; i != end; ++i)
   {
     ArithVar var = *i;
-    if (d_tableau.isBasic(var))
-    {
-      RowIndex ridx = d_tableau.basicToRowIndex(var);
-      d_candidateRows.softAdd(ridx);
-    }
-    else
-    {
-      Tableau::ColIterator basicIter = d_tableau.colIterator(var);
-      for (; !basicIter.atEnd(); ++basicIter)
+    bool lb = d_updatedLowerBounds.isMember(var);
+    bool ub = d_updatedUpperBounds.isMember(var);
+    Tableau::ColIterator basicIter = d_tableau.colIterator(var);
+    for (; !basicIter.atEnd(); ++basicIter)
+    {
+      const Tableau::Entry& entry = *basicIter;
+      RowIndex ridx = entry.getRowIndex();
+      // The upper bound of the row uses the upper bound of var if its
+      // coefficient is positive, and its lower bound otherwise.
+      bool pos = entry.getCoefficient().sgn() > 0;
+      uint32_t rowLength = d_tableau.getRowLength(ridx);
+      BoundCounts hasCount = d_linEq.hasBoundCount(ridx);
+      if ((pos ? ub : lb) && hasCount.upperBoundCount() + 1 >= rowLength)
       {
-        const Tableau::Entry& entry = *basicIter;
-        RowIndex ridx = entry.getRowIndex();
-        d_candidateRows.softAdd(ridx);
+        d_candidateRowsUp.softAdd(ridx);
+      }
+      if ((pos ? lb : ub) && hasCount.lowerBoundCount() + 1 >= rowLength)
+      {
+        d_candidateRowsDown.softAdd(ridx);
       }
     }
   }
-  d_updatedBounds.purge();
+  clearUpdates();
 }
 
 const BoundsInfo& TheoryArithPrivate::boundsInfo(ArithVar basic) const
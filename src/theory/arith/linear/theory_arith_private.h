@@ -38,12 +38,14 @@
 #include "theory/arith/linear/dual_simplex.h"
 #include "theory/arith/linear/error_set.h"
 #include "theory/arith/linear/fc_simplex.h"
+#include "theory/arith/linear/float_simplex.h"
 #include "theory/arith/linear/infer_bounds.h"
 #include "theory/arith/linear/linear_equality.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
 #include "theory/arith/linear/partial_model.h"
 #include "theory/arith/linear/soi_simplex.h"
+#include "theory/arith/linear/tableau_cuts.h"
 #include "theory/theory.h"
 #include "theory/valuation.h"
 #include "util/dense_map.h"
@@ -306,6 +308,12 @@ class TheoryArithPrivate : protected EnvObj
    */
   Tableau d_tableau;
 
+  /** Derives cuts from the rows of the tableau, if arithCuts is enabled. */
+  TableauCuts d_tableauCuts;
+
+  /** Solves the relaxation in floating point, if arithFloatSimplex is set. */
+  FloatSimplex d_floatSimplex;
+
   /**
    * Maintains the relationship between the PartialModel and the Tableau.
    */
@@ -415,6 +423,12 @@ class TheoryArithPrivate : protected EnvObj
   SimplexDecisionProcedure* d_otherSDP;
   /* Sets d_qflraStatus */
   void importSolution(const ApproximateSimplex::Solution& solution);
+  /**
+   * Solve the relaxation with d_floatSimplex and import its solution. Sets
+   * d_qflraStatus and returns true if the exact simplex verified that the
+   * relaxation is feasible or infeasible.
+   */
+  bool floatWarmStart();
   bool solveRelaxationOrPanic(Theory::Effort effortLevel);
   context::CDO<int> d_lastContextIntegerAttempted;
   bool replayLog(ApproximateSimplex* approx);
@@ -499,6 +513,13 @@ class TheoryArithPrivate : protected EnvObj
 
   Node getCandidateModelValue(TNode var);
 
+  /**
+   * Get the value of term in the current assignment as c + k * delta, where
+   * delta is the infinitesimal used for strict bounds. Returns false if the
+   * assignment is not satisfiable or term has no such value.
+   */
+  bool getInfinitesimalValue(TNode term, Rational& c, Rational& k) const;
+
   std::pair<bool, Node> entailmentCheck(TNode lit);
 
   //--------------------------------- standard check
@@ -620,10 +641,18 @@ class TheoryArithPrivate : protected EnvObj
 
   /** Tracks the bounds that were updated in the current round. */
   DenseSet d_updatedBounds;
+  /** The subsets of d_updatedBounds whose lower/upper bound was updated. */
+  DenseSet d_updatedLowerBounds;
+  DenseSet d_updatedUpperBounds;
 
   /** Tracks the basic variables where propagation might be possible. */
   DenseSet d_candidateBasics;
-  DenseSet d_candidateRows;
+  /**
+   * The rows where propagation might be possible using the upper/lower bound
+   * of the row, see dumpUpdatedBoundsToRows().
+   */
+  DenseSet d_candidateRowsUp;
+  DenseSet d_candidateRowsDown;
 
   bool hasAnyUpdates() { return !d_updatedBounds.empty(); }
   void clearUpdates();
@@ -631,8 +660,19 @@ class TheoryArithPrivate : protected EnvObj
   void revertOutOfConflict();
 
   void propagateCandidatesNew();
+  /**
+   * Adds the rows of the updated bounds to the candidate rows. A row is
+   * watched on the side of its upper (lower) bound only if all but at most one
+   * of its variables have the bound that is needed for computing it, and it
+   * is only added for that side if one of these bounds was updated.
+   * Requires the bound counts to be up to date.
+   */
   void dumpUpdatedBoundsToRows();
-  bool propagateCandidateRow(RowIndex rid);
+  /**
+   * Attempt to propagate using the upper bound of row rid if rowUp and using
+   * its lower bound if rowDown.
+   */
+  bool propagateCandidateRow(RowIndex rid, bool rowUp, bool rowDown);
   bool propagateMightSucceed(ArithVar v, bool ub) const;
   /** Attempt to perform a row propagation where there is at most 1 possible
    * variable.*/
@@ -715,7 +755,9 @@ class TheoryArithPrivate : protected EnvObj
 
   bool isLeaf(TNode x) const;
   TheoryId theoryOf(TNode x) const;
-  bool outputTrustedLemma(TrustNode lem, InferenceId id);
+  bool outputTrustedLemma(TrustNode lem,
+                          InferenceId id,
+                          LemmaProperty p = LemmaProperty::NONE);
   bool outputLemma(TNode lem, InferenceId id);
   void outputTrustedConflict(TrustNode conf, InferenceId id);
   void outputConflict(TNode lit, InferenceId id);
@@ -736,6 +778,8 @@ class TheoryArithPrivate : protected EnvObj
   void branchVector(const std::vector<ArithVar>& lemmas);
 
   context::CDO<unsigned> d_cutCount;
+  /** The number of rounds of tableau cuts in the current context. */
+  context::CDO<uint64_t> d_cutRounds;
   context::CDHashSet<ArithVar, std::hash<ArithVar>> d_cutInContext;
 
   context::CDO<bool> d_likelyIntegerInfeasible;
@@ -16,6 +16,7 @@
 #ifdef CVC5_POLY_IMP
 
 #include "options/arith_options.h"
+#include "smt/env.h"
 #include "theory/arith/nl/coverings/lazard_evaluation.h"
 #include "theory/arith/nl/coverings/projections.h"
 #include "theory/arith/nl/coverings/variable_ordering.h"
@@ -43,10 +44,10 @@ namespace coverings {
 
 CDCAC::CDCAC(Env& env, const std::vector<poly::Variable>& ordering)
     : EnvObj(env),
-      d_assignment(nodeManager()->getPolyContext()),
-      d_constraints(nodeManager()->getPolyContext()),
+      d_assignment(d_env.getPolyContext()),
+      d_constraints(d_env.getPolyContext()),
       d_variableOrdering(ordering),
-      d_varOrder(nodeManager()->getPolyContext())
+      d_varOrder(d_env.getPolyContext())
 {
   if (d_env.isTheoryProofProducing())
   {
@@ -64,7 +65,7 @@ void CDCAC::reset()
 poly::detail::variable_printer CDCAC::get_stream_variable(
     const poly::Variable& v)
 {
-  const poly::Context& ctx = nodeManager()->getPolyContext();
+  const poly::Context& ctx = d_env.getPolyContext();
   return stream_variable(ctx, v);
 }
 
@@ -74,7 +75,7 @@ std::vector<poly::detail::variable_printer> CDCAC::get_stream_variables(
   std::vector<poly::detail::variable_printer> result;
   result.reserve(vars.size());
 
-  const poly::Context& ctx = nodeManager()->getPolyContext();
+  const poly::Context& ctx = d_env.getPolyContext();
 
   for (const poly::Variable& v : vars)
   {
@@ -94,7 +95,7 @@ void CDCAC::computeVariableOrdering()
 
   // Write variable ordering back to libpoly.
   lp_variable_order_t* vo =
-      nodeManager()->getPolyContext().get_variable_order();
+      d_env.getPolyContext().get_variable_order();
   lp_variable_order_clear(vo);
   for (const auto& v : d_variableOrdering)
   {
@@ -131,7 +132,7 @@ const std::vector<poly::Variable>& CDCAC::getVariableOrdering() const
 std::vector<CACInterval> CDCAC::getUnsatIntervals(std::size_t cur_variable)
 {
   std::vector<CACInterval> res;
-  LazardEvaluation le(statisticsRegistry(), nodeManager()->getPolyContext());
+  LazardEvaluation le(statisticsRegistry(), d_env.getPolyContext());
   prepareRootIsolation(le, cur_variable);
   for (const auto& c : d_constraints.getConstraints())
   {
@@ -461,7 +462,7 @@ CACInterval CDCAC::intervalFromCharacterization(
 
   // Collect -oo, all roots, oo
 
-  LazardEvaluation le(statisticsRegistry(), nodeManager()->getPolyContext());
+  LazardEvaluation le(statisticsRegistry(), d_env.getPolyContext());
   prepareRootIsolation(le, cur_variable);
   std::vector<poly::Value> roots;
   roots.emplace_back(poly::Value::minus_infty());
@@ -716,7 +717,7 @@ CACInterval CDCAC::buildIntegralityInterval(std::size_t cur_variable,
   poly::Variable var = d_variableOrdering[cur_variable];
   poly::Integer below = poly::floor(value);
   poly::Integer above = poly::ceil(value);
-  const poly::Context& ctx = nodeManager()->getPolyContext();
+  const poly::Context& ctx = d_env.getPolyContext();
   poly::Polynomial pvar = poly::Polynomial(ctx, var);
   poly::Polynomial pbelow = poly::Polynomial(ctx, below);
   poly::Polynomial pabove = poly::Polynomial(ctx, above);
@@ -17,6 +17,7 @@
 #include "base/check.h"
 #include "base/output.h"
 #include "expr/node_algorithm.h"
+#include "smt/env.h"
 #include "theory/arith/arith_msum.h"
 #include "theory/arith/inference_manager.h"
 #include "theory/arith/linear/normal_form.h"
@@ -66,7 +67,7 @@ inline std::ostream& operator<<(std::ostream& os, const IAWrapper& iaw)
 
 ICPSolver::ICPSolver(Env& env, InferenceManager& im)
     : EnvObj(env),
-      d_mapper(nodeManager()->getPolyContext()),
+      d_mapper(d_env.getPolyContext()),
       d_im(im),
       d_state(env, d_mapper)
 {
@@ -112,7 +113,7 @@ std::vector<Candidate> ICPSolver::constructCandidates(const Node& n)
     Node veq_c;
     Node val;
 
-    const poly::Context& polyCtx = nodeManager()->getPolyContext();
+    const poly::Context& polyCtx = d_env.getPolyContext();
 
     int isolated = ArithMSum::isolate(v, msum, veq_c, val, k);
     if (isolated == 1)
@@ -0,0 +1,406 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Local search for models of non-linear integer arithmetic.
+ */
+
+#include "theory/arith/nl/local_search.h"
+
+#include <algorithm>
+#include <map>
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "theory/arith/arith_msum.h"
+#include "theory/arith/nl/nl_model.h"
+#include "util/random.h"
+#include "util/resource_manager.h"
+#include "util/statistics_registry.h"
+
+using namespace cvc5::internal::kind;
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith {
+namespace nl {
+
+/** The maximal number of violated constraints considered in each step */
+static const size_t s_maxViolatedSample = 16;
+
+LocalSearch::LocalSearch(Env& env, NlModel& model)
+    : EnvObj(env),
+      d_model(model),
+      d_statCalls(statisticsRegistry().registerInt("nl::localSearch::calls")),
+      d_statSteps(statisticsRegistry().registerInt("nl::localSearch::steps")),
+      d_statSuccess(
+          statisticsRegistry().registerInt("nl::localSearch::success"))
+{
+}
+
+void LocalSearch::clear()
+{
+  d_vars.clear();
+  d_varIds.clear();
+  d_values.clear();
+  d_occurs.clear();
+  d_constraints.clear();
+  d_lhs.clear();
+  d_violated.clear();
+  d_violatedPos.clear();
+  d_tabuInc.clear();
+  d_tabuDec.clear();
+}
+
+uint32_t LocalSearch::getVarId(TNode v)
+{
+  std::unordered_map<Node, uint32_t>::const_iterator it = d_varIds.find(v);
+  if (it != d_varIds.end())
+  {
+    return it->second;
+  }
+  uint32_t id = d_vars.size();
+  d_varIds[v] = id;
+  d_vars.push_back(v);
+  d_occurs.emplace_back();
+  return id;
+}
+
+bool LocalSearch::addConstraint(TNode lit)
+{
+  bool pol = lit.getKind() != Kind::NOT;
+  TNode atom = pol ? lit : lit[0];
+  Kind k = atom.getKind();
+  std::map<Node, Node> msum;
+  if ((k != Kind::GEQ && k != Kind::EQUAL)
+      || !ArithMSum::getMonomialSumLit(atom, msum))
+  {
+    return false;
+  }
+  Constraint c;
+  c.d_isEq = (k == Kind::EQUAL);
+  c.d_pol = pol;
+  c.d_weight = 1;
+  std::map<uint32_t, uint32_t> degrees;
+  for (const std::pair<const Node, Node>& m : msum)
+  {
+    Rational coeff =
+        m.second.isNull() ? Rational(1) : m.second.getConst<Rational>();
+    if (m.first.isNull())
+    {
+      c.d_const = coeff;
+      continue;
+    }
+    Monomial mon;
+    mon.d_coeff = coeff;
+    if (m.first.getKind() == Kind::NONLINEAR_MULT)
+    {
+      for (const Node& f : m.first)
+      {
+        if (!f.isVar() || !f.getType().isInteger())
+        {
+          return false;
+        }
+        mon.d_vars.push_back(getVarId(f));
+      }
+    }
+    else if (m.first.isVar() && m.first.getType().isInteger())
+    {
+      mon.d_vars.push_back(getVarId(m.first));
+    }
+    else
+    {
+      return false;
+    }
+    for (uint32_t x : mon.d_vars)
+    {
+      degrees[x]++;
+    }
+    c.d_monomials.push_back(std::move(mon));
+  }
+  uint32_t cid = d_constraints.size();
+  for (const std::pair<const uint32_t, uint32_t>& d : degrees)
+  {
+    c.d_degrees.push_back(d);
+    d_occurs[d.first].push_back(cid);
+  }
+  d_constraints.push_back(std::move(c));
+  return true;
+}
+
+Rational LocalSearch::evaluate(const Constraint& c) const
+{
+  Rational res = c.d_const;
+  for (const Monomial& m : c.d_monomials)
+  {
+    Rational v = m.d_coeff;
+    for (uint32_t x : m.d_vars)
+    {
+      v *= d_values[x];
+    }
+    res += v;
+  }
+  return res;
+}
+
+bool LocalSearch::isSatisfied(const Constraint& c, const Rational& v)
+{
+  if (c.d_isEq)
+  {
+    return v.isZero() == c.d_pol;
+  }
+  return (v.sgn() >= 0) == c.d_pol;
+}
+
+void LocalSearch::setViolated(uint32_t c, bool violated)
+{
+  size_t pos = d_violatedPos[c];
+  bool isViolated = pos < d_violated.size() && d_violated[pos] == c;
+  if (violated == isViolated)
+  {
+    return;
+  }
+  if (violated)
+  {
+    d_violatedPos[c] = d_violated.size();
+    d_violated.push_back(c);
+    return;
+  }
+  uint32_t last = d_violated.back();
+  d_violated[pos] = last;
+  d_violatedPos[last] = pos;
+  d_violated.pop_back();
+  d_violatedPos[c] = d_constraints.size();
+}
+
+void LocalSearch::setValue(uint32_t x, const Rational& value)
+{
+  d_values[x] = value;
+  for (uint32_t c : d_occurs[x])
+  {
+    d_lhs[c] = evaluate(d_constraints[c]);
+    setViolated(c, !isSatisfied(d_constraints[c], d_lhs[c]));
+  }
+}
+
+int64_t LocalSearch::score(uint32_t x, const Rational& value)
+{
+  Rational old = d_values[x];
+  d_values[x] = value;
+  int64_t res = 0;
+  for (uint32_t c : d_occurs[x])
+  {
+    const Constraint& con = d_constraints[c];
+    bool before = isSatisfied(con, d_lhs[c]);
+    bool after = isSatisfied(con, evaluate(con));
+    if (before != after)
+    {
+      int64_t w = static_cast<int64_t>(con.d_weight);
+      res += after ? w : -w;
+    }
+  }
+  d_values[x] = old;
+  return res;
+}
+
+void LocalSearch::getCandidates(uint32_t c,
+                                uint32_t x,
+                                std::vector<Rational>& values)
+{
+  const Constraint& con = d_constraints[c];
+  const Rational& cur = d_values[x];
+  values.push_back(cur + Rational(1));
+  values.push_back(cur - Rational(1));
+  uint32_t degree = 0;
+  for (const std::pair<uint32_t, uint32_t>& d : con.d_degrees)
+  {
+    if (d.first == x)
+    {
+      degree = d.second;
+    }
+  }
+  if (degree != 1)
+  {
+    // the polynomial is not linear in x, try to flip the signs
+    if (!cur.isZero())
+    {
+      values.push_back(Rational(0));
+      values.push_back(-cur);
+    }
+    return;
+  }
+  // the polynomial is a * x + b
+  Rational old = cur;
+  d_values[x] = Rational(0);
+  Rational b = evaluate(con);
+  d_values[x] = Rational(1);
+  Rational a = evaluate(con) - b;
+  d_values[x] = old;
+  if (a.isZero() || (con.d_isEq && !con.d_pol))
+  {
+    // disequalities are fixed by the neighbors of the current value
+    return;
+  }
+  Rational root = -b / a;
+  if (con.d_isEq)
+  {
+    if (root.isIntegral())
+    {
+      values.push_back(root);
+    }
+  }
+  else if ((a.sgn() > 0) == con.d_pol)
+  {
+    // x >= root if a > 0 and p >= 0, x > root if a < 0 and p < 0
+    Rational v(root.ceiling());
+    values.push_back(con.d_pol ? v : (v == root ? v + Rational(1) : v));
+  }
+  else
+  {
+    // x <= root if a < 0 and p >= 0, x < root if a > 0 and p < 0
+    Rational v(root.floor());
+    values.push_back(con.d_pol ? v : (v == root ? v - Rational(1) : v));
+  }
+}
+
+bool LocalSearch::search(const std::vector<Node>& assertions)
+{
+  ++d_statCalls;
+  clear();
+  d_solution.clear();
+  for (const Node& a : assertions)
+  {
+    if (!addConstraint(a))
+    {
+      Trace("nl-ls") << "LocalSearch: unsupported assertion " << a
+                     << std::endl;
+      return false;
+    }
+  }
+  // start from the values of the current model
+  for (const Node& v : d_vars)
+  {
+    Node mv = d_model.computeConcreteModelValue(v);
+    d_values.push_back(mv.isConst() ? Rational(mv.getConst<Rational>().floor())
+                                    : Rational(0));
+  }
+  size_t nvars = d_vars.size();
+  size_t ncons = d_constraints.size();
+  d_tabuInc.assign(nvars, 0);
+  d_tabuDec.assign(nvars, 0);
+  d_lhs.resize(ncons);
+  d_violatedPos.assign(ncons, ncons);
+  for (uint32_t c = 0; c < ncons; ++c)
+  {
+    d_lhs[c] = evaluate(d_constraints[c]);
+    if (!isSatisfied(d_constraints[c], d_lhs[c]))
+    {
+      setViolated(c, true);
+    }
+  }
+  Trace("nl-ls") << "LocalSearch: " << nvars << " variables, " << ncons
+                 << " constraints, " << d_violated.size() << " violated"
+                 << std::endl;
+  Random& rnd = Random::getRandom();
+  ResourceManager* rm = resourceManager();
+  uint64_t maxSteps = options().arith.nlLocalSearchSteps;
+  std::vector<uint32_t> sample;
+  std::vector<Rational> candidates;
+  for (uint64_t step = 1; !d_violated.empty(); ++step)
+  {
+    if (step > maxSteps)
+    {
+      Trace("nl-ls") << "LocalSearch: step limit reached with "
+                     << d_violated.size() << " violated" << std::endl;
+      return false;
+    }
+    rm->spendResource(Resource::ArithNlLocalSearchStep);
+    if (rm->out())
+    {
+      return false;
+    }
+    ++d_statSteps;
+    sample = d_violated;
+    if (sample.size() > s_maxViolatedSample)
+    {
+      std::shuffle(sample.begin(), sample.end(), rnd);
+      sample.resize(s_maxViolatedSample);
+    }
+    // find the best non-tabu move
+    uint32_t bestVar = 0;
+    Rational bestValue;
+    int64_t bestScore = 0;
+    for (uint32_t c : sample)
+    {
+      for (const std::pair<uint32_t, uint32_t>& d : d_constraints[c].d_degrees)
+      {
+        uint32_t x = d.first;
+        candidates.clear();
+        getCandidates(c, x, candidates);
+        for (const Rational& v : candidates)
+        {
+          const Rational& cur = d_values[x];
+          if (v == cur || (v > cur && d_tabuInc[x] > step)
+              || (v < cur && d_tabuDec[x] > step))
+          {
+            continue;
+          }
+          int64_t s = score(x, v);
+          if (s > bestScore)
+          {
+            bestVar = x;
+            bestValue = v;
+            bestScore = s;
+          }
+        }
+      }
+    }
+    if (bestScore <= 0)
+    {
+      // no improving move: increase the weights of the violated constraints
+      // and take a random step
+      for (uint32_t c : d_violated)
+      {
+        d_constraints[c].d_weight++;
+      }
+      uint32_t c = sample[rnd.pick<size_t>(0, sample.size() - 1)];
+      const Constraint& con = d_constraints[c];
+      bestVar = con.d_degrees[rnd.pick<size_t>(0, con.d_degrees.size() - 1)]
+                    .first;
+      candidates.clear();
+      getCandidates(c, bestVar, candidates);
+      bestValue = candidates[rnd.pick<size_t>(0, candidates.size() - 1)];
+    }
+    // moving back is tabu for a few steps
+    uint64_t tenure = 3 + rnd.pick<uint64_t>(0, 9);
+    if (bestValue > d_values[bestVar])
+    {
+      d_tabuDec[bestVar] = step + tenure;
+    }
+    else
+    {
+      d_tabuInc[bestVar] = step + tenure;
+    }
+    Trace("nl-ls-debug") << "LocalSearch: " << d_vars[bestVar] << " := "
+                         << bestValue << ", score " << bestScore << std::endl;
+    setValue(bestVar, bestValue);
+  }
+  Trace("nl-ls") << "LocalSearch: found a solution" << std::endl;
+  ++d_statSuccess;
+  NodeManager* nm = nodeManager();
+  for (size_t i = 0; i < nvars; ++i)
+  {
+    d_solution.emplace_back(d_vars[i], nm->mkConstInt(d_values[i]));
+  }
+  return true;
+}
+
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Local search for models of non-linear integer arithmetic.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__NL__LOCAL_SEARCH_H
+#define CVC5__THEORY__ARITH__NL__LOCAL_SEARCH_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/rational.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith {
+namespace nl {
+
+class NlModel;
+
+/**
+ * A local search for integer values that satisfy the current arithmetic
+ * assertions, in the spirit of LS-NIA and of the arithmetic local search of
+ * Z3.
+ *
+ * Each assertion is a polynomial constraint p >= 0, p < 0, p = 0 or p != 0
+ * over integer variables. Starting from the values of the current model, a
+ * step changes the value of one variable of a violated constraint. The
+ * candidate values are the critical values that satisfy the constraint if
+ * it is linear in the variable, and the neighbors of the current value. The
+ * candidate that most decreases the weighted number of violated constraints
+ * is chosen, where moving a variable back in the direction it came from is
+ * tabu for a few steps. If no candidate improves, the weights of the
+ * violated constraints are increased and a random candidate is chosen.
+ *
+ * The search is bounded by nlLocalSearchSteps steps and by the resource
+ * manager. The solution is not trusted, the caller verifies it with the
+ * model check of the non-linear extension.
+ */
+class LocalSearch : protected EnvObj
+{
+ public:
+  LocalSearch(Env& env, NlModel& model);
+  /**
+   * Search for integer values for the variables of assertions that satisfy
+   * all assertions, starting from their values in the model. Returns false
+   * if none was found, or if an assertion is not supported.
+   */
+  bool search(const std::vector<Node>& assertions);
+  /** The values found by the last successful call to search */
+  const std::vector<std::pair<Node, Node>>& getSolution() const
+  {
+    return d_solution;
+  }
+
+ private:
+  /** A monomial c * x_1 * ... * x_n, where the x_i may repeat */
+  struct Monomial
+  {
+    Rational d_coeff;
+    std::vector<uint32_t> d_vars;
+  };
+  /** A constraint sum of monomials + constant >= 0 or = 0, or its negation */
+  struct Constraint
+  {
+    std::vector<Monomial> d_monomials;
+    Rational d_const;
+    bool d_isEq;
+    bool d_pol;
+    /** The variables with their degrees */
+    std::vector<std::pair<uint32_t, uint32_t>> d_degrees;
+    /** The weight for scoring */
+    uint64_t d_weight;
+  };
+  /** Clear the problem */
+  void clear();
+  /** Add the constraint for literal lit, return false if not supported */
+  bool addConstraint(TNode lit);
+  /** Get the identifier of variable v */
+  uint32_t getVarId(TNode v);
+  /** The value of the polynomial of constraint c under the current values */
+  Rational evaluate(const Constraint& c) const;
+  /** Does the polynomial value v satisfy constraint c? */
+  static bool isSatisfied(const Constraint& c, const Rational& v);
+  /** Add the candidate values for x that may satisfy constraint c */
+  void getCandidates(uint32_t c, uint32_t x, std::vector<Rational>& values);
+  /**
+   * The change of the weight of the satisfied constraints when x is set to
+   * value.
+   */
+  int64_t score(uint32_t x, const Rational& value);
+  /** Set the value of x and update the violated constraints */
+  void setValue(uint32_t x, const Rational& value);
+  /** Mark constraint c as violated or not */
+  void setViolated(uint32_t c, bool violated);
+  /** Reference to the non-linear model */
+  NlModel& d_model;
+  /** The variables and their current values */
+  std::vector<Node> d_vars;
+  std::unordered_map<Node, uint32_t> d_varIds;
+  std::vector<Rational> d_values;
+  /** The constraints that contain each variable */
+  std::vector<std::vector<uint32_t>> d_occurs;
+  /** The constraints, and the current values of their polynomials */
+  std::vector<Constraint> d_constraints;
+  std::vector<Rational> d_lhs;
+  /** The violated constraints, and the position of each in this list */
+  std::vector<uint32_t> d_violated;
+  std::vector<size_t> d_violatedPos;
+  /** The step until which increasing or decreasing each variable is tabu */
+  std::vector<uint64_t> d_tabuInc;
+  std::vector<uint64_t> d_tabuDec;
+  /** The solution of the last successful search */
+  std::vector<std::pair<Node, Node>> d_solution;
+  /** Number of calls to search */
+  IntStat d_statCalls;
+  /** Number of steps */
+  IntStat d_statSteps;
+  /** Number of calls that found a solution */
+  IntStat d_statSuccess;
+};
+
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__ARITH__NL__LOCAL_SEARCH_H */
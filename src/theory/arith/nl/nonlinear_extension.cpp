@@ -57,7 +57,8 @@ NonlinearExtension::NonlinearExtension(Env& env, TheoryArith& containing)
       d_icpSlv(d_env, d_im),
       d_iandSlv(env, d_im, d_model),
       d_piandSlv(env, d_im, d_model),
-      d_pow2Slv(env, d_im, d_model)
+      d_pow2Slv(env, d_im, d_model),
+      d_localSearch(env, d_model)
 {
   d_extTheory.addFunctionKind(Kind::NONLINEAR_MULT);
   d_extTheory.addFunctionKind(Kind::EXPONENTIAL);
@@ -267,6 +268,32 @@ bool NonlinearExtension::checkModel(const std::vector<Node>& assertions)
   return ret;
 }
 
+bool NonlinearExtension::checkModelLocalSearch(
+    const std::vector<Node>& assertions)
+{
+  if (!d_localSearch.search(assertions))
+  {
+    return false;
+  }
+  // the values of the local search are not trusted, check them as a model
+  for (const std::pair<Node, Node>& s : d_localSearch.getSolution())
+  {
+    if (!d_model.addSubstitution(s.first, s.second))
+    {
+      d_model.resetCheck();
+      return false;
+    }
+  }
+  if (checkModel(assertions))
+  {
+    Trace("nl-ext") << "...local search found a model" << std::endl;
+    return true;
+  }
+  Trace("nl-ext") << "...model of local search failed check" << std::endl;
+  d_model.resetCheck();
+  return false;
+}
+
 void NonlinearExtension::checkFullEffort(std::map<Node, Node>& arithModel,
                                          const std::set<Node>& termSet)
 {
@@ -488,11 +515,19 @@ Result::Status NonlinearExtension::modelBasedRefinement(
     if (!false_asserts.empty())
     {
       completeStatus = CheckCompletion::NEEDS_MODEL_CHECK;
-      runStrategy(assertions, false_asserts, xts);
-      if (d_im.hasSentLemma() || d_im.hasPendingLemma())
+      // try to repair the model by local search before refining it
+      if (options().arith.nlLocalSearch && checkModelLocalSearch(assertions))
       {
-        d_im.clearWaitingLemmas();
-        return Result::UNSAT;
+        completeStatus = CheckCompletion::COMPLETE;
+      }
+      else
+      {
+        runStrategy(assertions, false_asserts, xts);
+        if (d_im.hasSentLemma() || d_im.hasPendingLemma())
+        {
+          d_im.clearWaitingLemmas();
+          return Result::UNSAT;
+        }
       }
     }
     Trace("nl-ext") << "Finished check with status : "
@@ -29,6 +29,7 @@
 #include "theory/arith/nl/ext/tangent_plane_check.h"
 #include "theory/arith/nl/ext_theory_callback.h"
 #include "theory/arith/nl/iand_solver.h"
+#include "theory/arith/nl/local_search.h"
 #include "theory/arith/nl/icp/icp_solver.h"
 #include "theory/arith/nl/nl_model.h"
 #include "theory/arith/nl/piand_solver.h"
@@ -178,6 +179,12 @@ class NonlinearExtension : EnvObj
    * "Detecting Satisfiable Formulas".
    */
   bool checkModel(const std::vector<Node>& assertions);
+  /**
+   * Run the local search on assertions. If it finds integer values that
+   * satisfy them, and these pass checkModel, returns true. In this case, the
+   * values are recorded as substitutions in the model.
+   */
+  bool checkModelLocalSearch(const std::vector<Node>& assertions);
   //---------------------------end check model
   /** compute relevant assertions */
   void computeRelevantAssertions(const std::vector<Node>& assertions,
@@ -270,6 +277,9 @@ class NonlinearExtension : EnvObj
    */
   Pow2Solver d_pow2Slv;
 
+  /** The local search for models of integer constraints */
+  LocalSearch d_localSearch;
+
   /** The strategy for the nonlinear extension. */
   Strategy d_strategy;
 }; /* class NonlinearExtension */
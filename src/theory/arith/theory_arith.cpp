@@ -19,6 +19,7 @@
 #include "smt/logic_exception.h"
 #include "theory/arith/arith_evaluator.h"
 #include "theory/arith/arith_rewriter.h"
+#include "theory/arith/difference_logic_solver.h"
 #include "theory/arith/equality_solver.h"
 #include "theory/arith/linear/theory_arith_private.h"
 #include "theory/arith/nl/nonlinear_extension.h"
@@ -44,6 +45,8 @@ TheoryArith::TheoryArith(Env& env, OutputChannel& out, Valuation valuation)
       d_bab(env, d_astate, d_im, d_ppre),
       d_eqSolver(nullptr),
       d_internal(env, d_astate, d_im, d_bab),
+      d_dlSolver(nullptr),
+      d_dlReplayed(context(), false),
       d_nonlinearExtension(nullptr),
       d_opElim(d_env),
       d_arithPreproc(env, d_im, d_opElim),
@@ -92,6 +95,12 @@ void TheoryArith::finishInit()
   {
     d_nonlinearExtension.reset(new nl::NonlinearExtension(d_env, *this));
   }
+  // the difference logic solver does not produce proofs
+  if (options().arith.arithDl && logic.isLinear()
+      && !d_env.isTheoryProofProducing())
+  {
+    d_dlSolver.reset(new DifferenceLogicSolver(d_env, d_astate, d_im));
+  }
   d_eqSolver->finishInit();
   // finish initialize in the old linear solver
   eq::EqualityEngine* ee = getEqualityEngine();
@@ -171,12 +180,23 @@ void TheoryArith::preRegisterTerm(TNode n)
     throw LogicException(
         "A non-linear term was asserted to arithmetic in a linear logic.");
   }
+  if (d_dlSolver != nullptr)
+  {
+    d_dlSolver->preRegisterTerm(n);
+  }
+  // the linear solver is always notified, in case the difference logic
+  // solver is deactivated
   d_internal.preRegisterTerm(n);
 }
 
 void TheoryArith::notifySharedTerm(TNode n)
 {
   n = n.getKind() == Kind::TO_REAL ? n[0] : n;
+  // the difference logic solver does not support theory combination
+  if (d_dlSolver != nullptr)
+  {
+    d_dlSolver->deactivate();
+  }
   d_internal.notifySharedTerm(n);
 }
 
@@ -231,6 +251,15 @@ void TheoryArith::ppStaticLearn(TNode n, std::vector<TrustNode>& learned)
 bool TheoryArith::preCheck(CVC5_UNUSED Effort level)
 {
   Trace("arith-check") << "TheoryArith::preCheck " << level << std::endl;
+  if (useDifferenceLogic())
+  {
+    return false;
+  }
+  if (d_dlSolver != nullptr && !d_dlReplayed.get())
+  {
+    replayDifferenceLogicFacts();
+    return false;
+  }
   bool newFacts = !done();
   return d_internal.preCheck(newFacts);
 }
@@ -251,8 +280,18 @@ void TheoryArith::postCheck(Effort level)
   }
   // we don't check at last call
   Assert(level != Theory::EFFORT_LAST_CALL);
+  if (useDifferenceLogic())
+  {
+    // the difference logic solver checks the facts when they are asserted,
+    // only disequalities are split at full effort
+    if (d_astate.isInConflict()
+        || (Theory::fullEffort(level) && d_dlSolver->checkDisequalities()))
+    {
+      return;
+    }
+  }
   // otherwise, check with the linear solver
-  if (d_internal.postCheck(level))
+  else if (d_internal.postCheck(level))
   {
     // linear solver emitted a conflict or lemma, return
     return;
@@ -316,6 +355,19 @@ bool TheoryArith::preNotifyFact(
     // will be asserted to the equality engine in the default way.
     ret = d_eqSolver->preNotifyFact(atom, pol, fact, isPrereg, isInternal);
   }
+  if (d_dlSolver != nullptr)
+  {
+    if (d_dlSolver->isActive())
+    {
+      d_dlSolver->assertFact(fact);
+      if (d_dlSolver->isActive())
+      {
+        return ret;
+      }
+    }
+    // the difference logic solver was deactivated during this check
+    replayDifferenceLogicFacts();
+  }
   // we also always also notify the internal solver
   d_internal.preNotifyFact(fact);
   return ret;
@@ -345,10 +397,27 @@ TrustNode TheoryArith::explain(TNode n)
   {
     return texp;
   }
+  // the difference logic solver may have propagated n before it was
+  // deactivated
+  if (d_dlSolver != nullptr)
+  {
+    texp = d_dlSolver->explain(n);
+    if (!texp.isNull())
+    {
+      return texp;
+    }
+  }
   return d_internal.explain(n);
 }
 
-void TheoryArith::propagate(CVC5_UNUSED Effort e) { d_internal.propagate(); }
+void TheoryArith::propagate(CVC5_UNUSED Effort e)
+{
+  // the difference logic solver propagates when facts are asserted
+  if (!useDifferenceLogic())
+  {
+    d_internal.propagate();
+  }
+}
 
 bool TheoryArith::collectModelInfo(TheoryModel* m,
                                    const std::set<Node>& termSet)
@@ -490,6 +559,13 @@ Node TheoryArith::getCandidateModelValue(TNode var)
   return d_internal.getCandidateModelValue(var);
 }
 
+bool TheoryArith::getInfinitesimalValue(TNode term,
+                                        Rational& c,
+                                        Rational& k) const
+{
+  return d_internal.getInfinitesimalValue(term, c, k);
+}
+
 std::pair<bool, Node> TheoryArith::entailmentCheck(TNode lit)
 {
   return d_internal.entailmentCheck(lit);
@@ -513,6 +589,11 @@ void TheoryArith::updateModelCacheInternal(const std::set<Node>& termSet)
   if (!d_arithModelCacheSet)
   {
     d_arithModelCacheSet = true;
+    if (useDifferenceLogic())
+    {
+      d_dlSolver->collectModelValues(termSet, d_arithModelCache);
+      return;
+    }
     d_internal.collectModelValues(
         termSet, d_arithModelCache, d_arithModelCacheIllTyped);
   }
@@ -534,6 +615,29 @@ void TheoryArith::finalizeModelCache()
   }
 }
 
+bool TheoryArith::useDifferenceLogic() const
+{
+  return d_dlSolver != nullptr && d_dlSolver->isActive();
+}
+
+void TheoryArith::replayDifferenceLogicFacts()
+{
+  if (d_dlReplayed.get())
+  {
+    return;
+  }
+  d_dlReplayed = true;
+  size_t nfacts = d_dlSolver->getNumFacts();
+  Trace("arith-check") << "TheoryArith::replayDifferenceLogicFacts " << nfacts
+                       << std::endl;
+  d_internal.preCheck(true);
+  assertions_iterator it = facts_begin();
+  for (size_t i = 0; i < nfacts; ++i, ++it)
+  {
+    d_internal.preNotifyFact((*it).d_assertion);
+  }
+}
+
 bool TheoryArith::sanityCheckIntegerModel()
 {
   // Double check that the model from the linear solver respects integer types,
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "context/cdo.h"
 #include "expr/node.h"
 #include "theory/arith/arith_preprocess.h"
 #include "theory/arith/arith_rewriter.h"
@@ -33,6 +34,7 @@ namespace nl {
 class NonlinearExtension;
 }
 
+class DifferenceLogicSolver;
 class EqualitySolver;
 
 /**
@@ -113,6 +115,15 @@ class TheoryArith : public Theory
 
   Node getCandidateModelValue(TNode var) override;
 
+  /**
+   * Get the value of term in the assignment of the linear solver as
+   * c + k * delta, where delta is the infinitesimal used for strict bounds.
+   * Returns false if term has no such value. The model value of term is
+   * obtained by substituting the delta that is chosen for the model, hence
+   * c is the limit of term over all models with a smaller delta.
+   */
+  bool getInfinitesimalValue(TNode term, Rational& c, Rational& k) const;
+
   std::pair<bool, Node> entailmentCheck(TNode lit) override;
 
   /** Return a reference to the arith::InferenceManager. */
@@ -143,6 +154,14 @@ class TheoryArith : public Theory
    * false otherwise.
    */
   bool sanityCheckIntegerModel();
+  /** Is the difference logic solver used instead of the linear solver? */
+  bool useDifferenceLogic() const;
+  /**
+   * Assert the facts that were asserted to the difference logic solver in the
+   * current context to the linear solver, if this was not done yet. Called
+   * after the difference logic solver was deactivated.
+   */
+  void replayDifferenceLogicFacts();
 
   /** Get the proof equality engine */
   eq::ProofEqEngine* getProofEqEngine();
@@ -160,6 +179,16 @@ class TheoryArith : public Theory
   std::unique_ptr<EqualitySolver> d_eqSolver;
   /** The (old) linear arithmetic solver */
   linear::LinearSolver d_internal;
+  /**
+   * The difference logic solver, which is used instead of the linear solver
+   * while it is active.
+   */
+  std::unique_ptr<DifferenceLogicSolver> d_dlSolver;
+  /**
+   * Whether the facts of the difference logic solver were replayed to the
+   * linear solver in the current context.
+   */
+  context::CDO<bool> d_dlReplayed;
 
   /**
    * The non-linear extension, responsible for all approaches for non-linear
@@ -0,0 +1,662 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Propagation-based local search for bit-vector constraints.
+ */
+
+#include "theory/bv/bv_local_search.h"
+
+#include <set>
+
+#include "smt/env.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "util/random.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+namespace {
+
+/** The probability of a random move instead of an inverse value */
+const double s_randomMoveProb = 0.1;
+
+/** Make the width-1 bit-vector for a Boolean value */
+BitVector mkBool(bool b) { return BitVector(1, b ? 1u : 0u); }
+
+/** Is the width-1 bit-vector bv true? */
+bool isTrue(const BitVector& bv) { return bv.isBitSet(0); }
+
+/** Get a random value of width w in [lo, hi], which must be non-empty */
+BitVector randomInRange(uint32_t w, const Integer& lo, const Integer& hi)
+{
+  Assert(lo <= hi);
+  Integer range = hi - lo + 1;
+  Integer r = Integer::mkRandom(w + 1).floorDivideRemainder(range);
+  return BitVector(w, lo + r);
+}
+
+/** Flip the sign bit of bv, which maps signed to unsigned order */
+BitVector flipSign(const BitVector& bv)
+{
+  return bv ^ BitVector::mkMinSigned(bv.getSize());
+}
+
+/** The number of trailing zeros of bv, which is the width if bv is zero */
+uint32_t countTrailingZeros(const BitVector& bv)
+{
+  uint32_t i = 0, w = bv.getSize();
+  while (i < w && !bv.isBitSet(i))
+  {
+    i++;
+  }
+  return i;
+}
+
+}  // namespace
+
+BVLocalSearch::BVLocalSearch(Env& env)
+    : EnvObj(env),
+      d_statCalls(statisticsRegistry().registerInt(
+          "theory::bv::BVLocalSearch::calls")),
+      d_statSolved(statisticsRegistry().registerInt(
+          "theory::bv::BVLocalSearch::solved")),
+      d_statMoves(statisticsRegistry().registerInt(
+          "theory::bv::BVLocalSearch::moves"))
+{
+}
+
+bool BVLocalSearch::solve(const std::vector<Node>& lits, uint64_t maxMoves)
+{
+  ++d_statCalls;
+  if (!registerTerms(lits))
+  {
+    Trace("bv-ls") << "BVLocalSearch: unsupported literals" << std::endl;
+    return false;
+  }
+  std::vector<size_t> falseRoots;
+  Random& rnd = Random::getRandom();
+  uint64_t moves = 0;
+  bool solved = false;
+  while (true)
+  {
+    falseRoots.clear();
+    for (size_t r : d_roots)
+    {
+      if (!isTrue(d_values[r]))
+      {
+        falseRoots.push_back(r);
+      }
+    }
+    if (falseRoots.empty())
+    {
+      solved = true;
+      break;
+    }
+    if (moves == maxMoves)
+    {
+      break;
+    }
+    moves++;
+    move(falseRoots[rnd.pick<size_t>(0, falseRoots.size() - 1)]);
+  }
+  d_statMoves += moves;
+  Trace("bv-ls") << "BVLocalSearch: " << (solved ? "solved" : "gave up")
+                 << " after " << moves << " moves" << std::endl;
+  // remember the assignment for the next call
+  for (size_t i = 0, nterms = d_terms.size(); i < nterms; i++)
+  {
+    if (d_terms[i].isVar())
+    {
+      d_assignment[d_terms[i]] = d_values[i];
+    }
+  }
+  if (solved)
+  {
+    ++d_statSolved;
+  }
+  else
+  {
+    // the values are only available after a successful search
+    d_terms.clear();
+    d_index.clear();
+  }
+  return solved;
+}
+
+Node BVLocalSearch::getValue(TNode n) const
+{
+  std::unordered_map<Node, size_t>::const_iterator it = d_index.find(n);
+  if (it == d_index.end())
+  {
+    return Node::null();
+  }
+  const BitVector& value = d_values[it->second];
+  if (n.getType().isBoolean())
+  {
+    return nodeManager()->mkConst(isTrue(value));
+  }
+  return nodeManager()->mkConst(value);
+}
+
+bool BVLocalSearch::isSupported(TNode n)
+{
+  TypeNode tn = n.getType();
+  if (tn.isBoolean())
+  {
+    switch (n.getKind())
+    {
+      case Kind::CONST_BOOLEAN:
+      case Kind::NOT:
+      case Kind::AND:
+      case Kind::OR:
+      case Kind::XOR:
+      case Kind::BITVECTOR_ULT:
+      case Kind::BITVECTOR_ULE:
+      case Kind::BITVECTOR_SLT:
+      case Kind::BITVECTOR_SLE: return true;
+      case Kind::EQUAL: return n[0].getType().isBitVector();
+      default: return false;
+    }
+  }
+  if (!tn.isBitVector())
+  {
+    return false;
+  }
+  if (n.isVar())
+  {
+    return true;
+  }
+  switch (n.getKind())
+  {
+    case Kind::CONST_BITVECTOR:
+    case Kind::BITVECTOR_CONCAT:
+    case Kind::BITVECTOR_EXTRACT:
+    case Kind::BITVECTOR_NOT:
+    case Kind::BITVECTOR_NEG:
+    case Kind::BITVECTOR_AND:
+    case Kind::BITVECTOR_OR:
+    case Kind::BITVECTOR_XOR:
+    case Kind::BITVECTOR_ADD:
+    case Kind::BITVECTOR_SUB:
+    case Kind::BITVECTOR_MULT:
+    case Kind::BITVECTOR_UDIV:
+    case Kind::BITVECTOR_UREM:
+    case Kind::BITVECTOR_SHL:
+    case Kind::BITVECTOR_LSHR:
+    case Kind::BITVECTOR_ASHR:
+    case Kind::BITVECTOR_ZERO_EXTEND:
+    case Kind::BITVECTOR_SIGN_EXTEND:
+    case Kind::ITE: return true;
+    default: return false;
+  }
+}
+
+bool BVLocalSearch::registerTerms(const std::vector<Node>& lits)
+{
+  d_terms.clear();
+  d_index.clear();
+  d_children.clear();
+  d_parents.clear();
+  d_values.clear();
+  d_roots.clear();
+  std::unordered_map<TNode, bool> visited;
+  std::unordered_map<TNode, bool>::iterator it;
+  std::vector<TNode> visit(lits.begin(), lits.end());
+  TNode cur;
+  while (!visit.empty())
+  {
+    cur = visit.back();
+    it = visited.find(cur);
+    if (it == visited.end())
+    {
+      if (!isSupported(cur))
+      {
+        d_terms.clear();
+        d_index.clear();
+        return false;
+      }
+      visited[cur] = false;
+      if (!cur.isVar())
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    visit.pop_back();
+    if (it->second)
+    {
+      continue;
+    }
+    it->second = true;
+    size_t i = d_terms.size();
+    d_terms.push_back(cur);
+    d_index[cur] = i;
+    d_children.emplace_back();
+    d_parents.emplace_back();
+    if (!cur.isVar())
+    {
+      for (TNode c : cur)
+      {
+        size_t ci = d_index[c];
+        d_children[i].push_back(ci);
+        d_parents[ci].push_back(i);
+      }
+    }
+    if (cur.isVar())
+    {
+      std::unordered_map<Node, BitVector>::iterator ita =
+          d_assignment.find(cur);
+      d_values.push_back(ita != d_assignment.end()
+                             ? ita->second
+                             : BitVector::mkZero(utils::getSize(cur)));
+    }
+    else
+    {
+      d_values.push_back(evaluate(i));
+    }
+  }
+  for (const Node& lit : lits)
+  {
+    d_roots.push_back(d_index[lit]);
+  }
+  return true;
+}
+
+BitVector BVLocalSearch::evaluate(size_t i) const
+{
+  TNode n = d_terms[i];
+  Kind k = n.getKind();
+  size_t nchildren = d_children[i].size();
+  switch (k)
+  {
+    case Kind::CONST_BOOLEAN: return mkBool(n.getConst<bool>());
+    case Kind::CONST_BITVECTOR: return n.getConst<BitVector>();
+    case Kind::NOT:
+    case Kind::BITVECTOR_NOT: return ~childValue(i, 0);
+    case Kind::BITVECTOR_NEG: return -childValue(i, 0);
+    case Kind::EQUAL: return mkBool(childValue(i, 0) == childValue(i, 1));
+    case Kind::BITVECTOR_ULT:
+      return mkBool(childValue(i, 0).unsignedLessThan(childValue(i, 1)));
+    case Kind::BITVECTOR_ULE:
+      return mkBool(childValue(i, 0).unsignedLessThanEq(childValue(i, 1)));
+    case Kind::BITVECTOR_SLT:
+      return mkBool(childValue(i, 0).signedLessThan(childValue(i, 1)));
+    case Kind::BITVECTOR_SLE:
+      return mkBool(childValue(i, 0).signedLessThanEq(childValue(i, 1)));
+    case Kind::BITVECTOR_SUB: return childValue(i, 0) - childValue(i, 1);
+    case Kind::BITVECTOR_UDIV:
+      return childValue(i, 0).unsignedDivTotal(childValue(i, 1));
+    case Kind::BITVECTOR_UREM:
+      return childValue(i, 0).unsignedRemTotal(childValue(i, 1));
+    case Kind::BITVECTOR_SHL:
+      return childValue(i, 0).leftShift(childValue(i, 1));
+    case Kind::BITVECTOR_LSHR:
+      return childValue(i, 0).logicalRightShift(childValue(i, 1));
+    case Kind::BITVECTOR_ASHR:
+      return childValue(i, 0).arithRightShift(childValue(i, 1));
+    case Kind::BITVECTOR_EXTRACT:
+      return childValue(i, 0).extract(utils::getExtractHigh(n),
+                                      utils::getExtractLow(n));
+    case Kind::BITVECTOR_ZERO_EXTEND:
+      return childValue(i, 0).zeroExtend(
+          n.getOperator().getConst<BitVectorZeroExtend>());
+    case Kind::BITVECTOR_SIGN_EXTEND:
+      return childValue(i, 0).signExtend(utils::getSignExtendAmount(n));
+    case Kind::ITE:
+      return isTrue(childValue(i, 0)) ? childValue(i, 1) : childValue(i, 2);
+    default: break;
+  }
+  // n-ary operators
+  BitVector res = childValue(i, 0);
+  for (size_t c = 1; c < nchildren; c++)
+  {
+    const BitVector& v = childValue(i, c);
+    switch (k)
+    {
+      case Kind::AND:
+      case Kind::BITVECTOR_AND: res = res & v; break;
+      case Kind::OR:
+      case Kind::BITVECTOR_OR: res = res | v; break;
+      case Kind::XOR:
+      case Kind::BITVECTOR_XOR: res = res ^ v; break;
+      case Kind::BITVECTOR_ADD: res = res + v; break;
+      case Kind::BITVECTOR_MULT: res = res * v; break;
+      case Kind::BITVECTOR_CONCAT: res = res.concat(v); break;
+      default: Unhandled() << "BVLocalSearch::evaluate: " << k;
+    }
+  }
+  return res;
+}
+
+void BVLocalSearch::setValue(size_t i, const BitVector& value)
+{
+  Assert(d_terms[i].isVar());
+  d_values[i] = value;
+  // update the terms in the cone of i, children before parents
+  std::set<size_t> toUpdate(d_parents[i].begin(), d_parents[i].end());
+  while (!toUpdate.empty())
+  {
+    size_t p = *toUpdate.begin();
+    toUpdate.erase(toUpdate.begin());
+    BitVector v = evaluate(p);
+    if (v != d_values[p])
+    {
+      d_values[p] = v;
+      toUpdate.insert(d_parents[p].begin(), d_parents[p].end());
+    }
+  }
+}
+
+void BVLocalSearch::move(size_t i)
+{
+  size_t cur = i;
+  BitVector t = mkBool(true);
+  while (!d_terms[cur].isVar())
+  {
+    BitVector value;
+    int32_t c = selectChild(cur, t, value);
+    if (c < 0)
+    {
+      return;
+    }
+    cur = d_children[cur][c];
+    t = value;
+  }
+  Trace("bv-ls-debug") << "BVLocalSearch: set " << d_terms[cur] << " to " << t
+                       << std::endl;
+  setValue(cur, t);
+}
+
+int32_t BVLocalSearch::selectChild(size_t i,
+                                   const BitVector& t,
+                                   BitVector& value)
+{
+  TNode n = d_terms[i];
+  Kind k = n.getKind();
+  Random& rnd = Random::getRandom();
+  // the children that are not constants
+  std::vector<size_t> cands;
+  for (size_t c = 0, nchildren = d_children[i].size(); c < nchildren; c++)
+  {
+    if (!d_terms[d_children[i][c]].isConst())
+    {
+      cands.push_back(c);
+    }
+  }
+  if (cands.empty())
+  {
+    return -1;
+  }
+  if (k == Kind::ITE)
+  {
+    // change the branch that is taken, or the condition
+    size_t branch = isTrue(childValue(i, 0)) ? 1 : 2;
+    bool branchConst = d_terms[d_children[i][branch]].isConst();
+    bool condConst = d_terms[d_children[i][0]].isConst();
+    if (condConst || (!branchConst && !rnd.pickWithProb(s_randomMoveProb)))
+    {
+      if (branchConst)
+      {
+        return -1;
+      }
+      value = t;
+      return static_cast<int32_t>(branch);
+    }
+    value = ~childValue(i, 0);
+    return 0;
+  }
+  if ((k == Kind::AND || k == Kind::OR) && isTrue(t) == (k == Kind::AND))
+  {
+    // all children must have value t, select one that does not
+    std::vector<size_t> wrong;
+    for (size_t c : cands)
+    {
+      if (childValue(i, c) != t)
+      {
+        wrong.push_back(c);
+      }
+    }
+    if (wrong.empty())
+    {
+      return -1;
+    }
+    value = t;
+    return static_cast<int32_t>(wrong[rnd.pick<size_t>(0, wrong.size() - 1)]);
+  }
+  size_t c = cands[rnd.pick<size_t>(0, cands.size() - 1)];
+  if (rnd.pickWithProb(s_randomMoveProb) || !inverseValue(i, c, t, value))
+  {
+    value = BitVector::mkRandom(childValue(i, c).getSize());
+  }
+  return static_cast<int32_t>(c);
+}
+
+bool BVLocalSearch::inverseValue(size_t i,
+                                 size_t c,
+                                 const BitVector& t,
+                                 BitVector& value)
+{
+  TNode n = d_terms[i];
+  Kind k = n.getKind();
+  size_t nchildren = d_children[i].size();
+  uint32_t w = childValue(i, c).getSize();
+  // the combined value of the other children, for n-ary operators
+  auto others = [&]() {
+    BitVector s;
+    bool first = true;
+    for (size_t j = 0; j < nchildren; j++)
+    {
+      if (j == c)
+      {
+        continue;
+      }
+      const BitVector& v = childValue(i, j);
+      if (first)
+      {
+        s = v;
+        first = false;
+        continue;
+      }
+      switch (k)
+      {
+        case Kind::BITVECTOR_ADD: s = s + v; break;
+        case Kind::BITVECTOR_MULT: s = s * v; break;
+        case Kind::AND:
+        case Kind::BITVECTOR_AND: s = s & v; break;
+        case Kind::OR:
+        case Kind::BITVECTOR_OR: s = s | v; break;
+        default: s = s ^ v; break;
+      }
+    }
+    return s;
+  };
+  switch (k)
+  {
+    case Kind::NOT:
+    case Kind::BITVECTOR_NOT: value = ~t; return true;
+    case Kind::BITVECTOR_NEG: value = -t; return true;
+    case Kind::XOR:
+    case Kind::BITVECTOR_XOR: value = t ^ others(); return true;
+    case Kind::BITVECTOR_ADD: value = t - others(); return true;
+    case Kind::BITVECTOR_SUB:
+      value = c == 0 ? t + childValue(i, 1) : childValue(i, 0) - t;
+      return true;
+    case Kind::AND:
+    case Kind::BITVECTOR_AND:
+    {
+      // the bits of t must be set in the other children, and the bits that
+      // are set in the other children but not in t must be unset in x
+      BitVector s = others();
+      if ((t & ~s) != BitVector::mkZero(w))
+      {
+        return false;
+      }
+      value = t | (BitVector::mkRandom(w) & ~s);
+      return true;
+    }
+    case Kind::OR:
+    case Kind::BITVECTOR_OR:
+    {
+      BitVector s = others();
+      if ((s & ~t) != BitVector::mkZero(w))
+      {
+        return false;
+      }
+      value = (t & ~s) | (BitVector::mkRandom(w) & s);
+      return true;
+    }
+    case Kind::BITVECTOR_MULT:
+    {
+      // x * s = t is solvable iff t has at least as many trailing zeros as s
+      BitVector s = others();
+      uint32_t tzs = countTrailingZeros(s);
+      if (tzs == w)
+      {
+        if (t != BitVector::mkZero(w))
+        {
+          return false;
+        }
+        value = BitVector::mkRandom(w);
+        return true;
+      }
+      if (countTrailingZeros(t) < tzs)
+      {
+        return false;
+      }
+      Integer two(2);
+      Integer mod = two.pow(w - tzs);
+      Integer sOdd = s.getValue().floorDivideQuotient(two.pow(tzs));
+      Integer tRed = t.getValue().floorDivideQuotient(two.pow(tzs));
+      Integer x = tRed.modMultiply(sOdd.modInverse(mod), mod);
+      // the upper bits of x are unconstrained
+      if (tzs > 0)
+      {
+        x = x + Integer::mkRandom(tzs) * mod;
+      }
+      value = BitVector(w, x);
+      return true;
+    }
+    case Kind::BITVECTOR_CONCAT:
+    {
+      // the bits of t that correspond to child c
+      uint32_t low = 0;
+      for (size_t j = c + 1; j < nchildren; j++)
+      {
+        low += childValue(i, j).getSize();
+      }
+      value = t.extract(low + w - 1, low);
+      return true;
+    }
+    case Kind::BITVECTOR_EXTRACT:
+    {
+      // replace the extracted bits of the current value by t
+      const BitVector& cur = childValue(i, c);
+      uint32_t high = utils::getExtractHigh(n);
+      uint32_t low = utils::getExtractLow(n);
+      value = t;
+      if (high + 1 < w)
+      {
+        value = cur.extract(w - 1, high + 1).concat(value);
+      }
+      if (low > 0)
+      {
+        value = value.concat(cur.extract(low - 1, 0));
+      }
+      return true;
+    }
+    case Kind::BITVECTOR_ZERO_EXTEND:
+    {
+      BitVector x = t.extract(w - 1, 0);
+      if (x.zeroExtend(t.getSize() - w) != t)
+      {
+        return false;
+      }
+      value = x;
+      return true;
+    }
+    case Kind::BITVECTOR_SIGN_EXTEND:
+    {
+      BitVector x = t.extract(w - 1, 0);
+      if (x.signExtend(t.getSize() - w) != t)
+      {
+        return false;
+      }
+      value = x;
+      return true;
+    }
+    case Kind::EQUAL:
+    {
+      const BitVector& s = childValue(i, 1 - c);
+      value = s;
+      if (!isTrue(t))
+      {
+        // any other value
+        value = BitVector::mkRandom(w);
+        if (value == s)
+        {
+          value = value + BitVector::mkOne(w);
+        }
+      }
+      return true;
+    }
+    case Kind::BITVECTOR_ULT:
+    case Kind::BITVECTOR_ULE:
+    case Kind::BITVECTOR_SLT:
+    case Kind::BITVECTOR_SLE:
+    {
+      // signed comparisons are unsigned comparisons with flipped sign bits
+      bool isSigned = k == Kind::BITVECTOR_SLT || k == Kind::BITVECTOR_SLE;
+      bool strict = k == Kind::BITVECTOR_ULT || k == Kind::BITVECTOR_SLT;
+      BitVector s = childValue(i, 1 - c);
+      if (isSigned)
+      {
+        s = flipSign(s);
+      }
+      // x < s, x <= s, s < x or s <= x, negated if t is false
+      bool xLeft = c == 0;
+      if (!isTrue(t))
+      {
+        // not (x < s) iff s <= x, not (x <= s) iff s < x
+        xLeft = !xLeft;
+        strict = !strict;
+      }
+      Integer sv = s.getValue();
+      Integer max = BitVector::mkOnes(w).getValue();
+      Integer lo, hi;
+      if (xLeft)
+      {
+        lo = Integer(0);
+        hi = strict ? sv - 1 : sv;
+      }
+      else
+      {
+        lo = strict ? sv + 1 : sv;
+        hi = max;
+      }
+      if (lo > hi)
+      {
+        return false;
+      }
+      value = randomInRange(w, lo, hi);
+      if (isSigned)
+      {
+        value = flipSign(value);
+      }
+      return true;
+    }
+    default: break;
+  }
+  // no inverse for the remaining operators
+  return false;
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,126 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Propagation-based local search for bit-vector constraints.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__BV__BV_LOCAL_SEARCH_H
+#define CVC5__THEORY__BV__BV_LOCAL_SEARCH_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/bitvector.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace bv {
+
+/**
+ * Word-level local search for a set of bit-vector literals, in the spirit of
+ * the propagation-based local search of Niemetz, Preiner and Biere.
+ *
+ * The search maintains a value for each variable and evaluates all terms
+ * under this assignment. A move selects a literal that is false under the
+ * current assignment and propagates the target value true down to a
+ * variable: at each operator, it selects a child and computes a value for it
+ * that produces the target value given the current values of the other
+ * children (an inverse value), or a random value if no such value exists.
+ * The variable is then set to the propagated value, and the values of the
+ * terms that depend on it are updated.
+ *
+ * The search only handles literals whose terms are built from bit-vector
+ * variables, constants, and the operators supported by evaluate. If a
+ * literal contains anything else, solve returns false without searching.
+ */
+class BVLocalSearch : protected EnvObj
+{
+ public:
+  BVLocalSearch(Env& env);
+  /**
+   * Search for an assignment to the variables of the given literals that
+   * satisfies all of them, using at most maxMoves moves. The search starts
+   * from the assignment found by the previous call, where variables that
+   * were not assigned before are assigned zero.
+   *
+   * @param lits The bit-vector literals
+   * @param maxMoves The maximum number of moves
+   * @return true if a satisfying assignment was found
+   */
+  bool solve(const std::vector<Node>& lits, uint64_t maxMoves);
+  /**
+   * Get the value of term n in the assignment found by the last successful
+   * call to solve. Returns the null node if n does not occur in the literals
+   * of that call.
+   */
+  Node getValue(TNode n) const;
+
+ private:
+  /**
+   * Register the terms of the literals, in post-order. Returns false if the
+   * literals contain a term that is not supported.
+   */
+  bool registerTerms(const std::vector<Node>& lits);
+  /** Is n a term that we can evaluate? */
+  static bool isSupported(TNode n);
+  /** Compute the value of the term with index i from its children */
+  BitVector evaluate(size_t i) const;
+  /** Set the value of the variable with index i, and update its parents */
+  void setValue(size_t i, const BitVector& value);
+  /** Perform a move that tries to make the root with index i true */
+  void move(size_t i);
+  /**
+   * Select the child of the term with index i whose value is changed to
+   * produce value t, and compute this value. Returns the index of the child
+   * in the term, or -1 if no child can be selected.
+   */
+  int32_t selectChild(size_t i, const BitVector& t, BitVector& value);
+  /**
+   * Compute a value for child index c of the term with index i that
+   * produces value t, given the current values of the other children.
+   * Returns false if there is no such value.
+   */
+  bool inverseValue(size_t i, size_t c, const BitVector& t, BitVector& value);
+  /** Get the current value of child c of the term with index i */
+  const BitVector& childValue(size_t i, size_t c) const
+  {
+    return d_values[d_children[i][c]];
+  }
+  /** The registered terms, children before parents */
+  std::vector<Node> d_terms;
+  /** Map from the registered terms to their index */
+  std::unordered_map<Node, size_t> d_index;
+  /** The indices of the children of each registered term */
+  std::vector<std::vector<size_t>> d_children;
+  /** The indices of the parents of each registered term */
+  std::vector<std::vector<size_t>> d_parents;
+  /** The current value of each registered term, Booleans have width 1 */
+  std::vector<BitVector> d_values;
+  /** The indices of the literals */
+  std::vector<size_t> d_roots;
+  /** The values of the variables from the previous calls */
+  std::unordered_map<Node, BitVector> d_assignment;
+  /** Number of calls to solve */
+  IntStat d_statCalls;
+  /** Number of calls to solve that found a satisfying assignment */
+  IntStat d_statSolved;
+  /** Number of moves */
+  IntStat d_statMoves;
+};
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__BV__BV_LOCAL_SEARCH_H */
@@ -121,6 +121,7 @@ BVSolverBitblast::BVSolverBitblast(Env& env,
       d_bvProofChecker(nodeManager()),
       d_factLiteralCache(context()),
       d_literalFactCache(context()),
+      d_localSearchModel(false),
       d_propagate(options().bv.bitvectorPropagate),
       d_resetNotify(new NotifyResetAssertions(userContext()))
 {
@@ -128,6 +129,14 @@ BVSolverBitblast::BVSolverBitblast(Env& env,
   {
     d_bvProofChecker.registerTo(env.getProofNodeManager()->getChecker());
   }
+  // The local search assigns the bit-vector variables only, hence it can only
+  // be used if there are no other theories sharing terms with BV.
+  if (options().bv.bvLocalSearch
+      && options().bv.bitblastMode != options::BitblastMode::EAGER
+      && !logicInfo().isSharingEnabled())
+  {
+    d_localSearch.reset(new BVLocalSearch(env));
+  }
 
   initSatSolver();
 }
@@ -211,6 +220,23 @@ void BVSolverBitblast::postCheck(Theory::Effort level)
     d_assumptions.push_back(d_factLiteralCache[fact]);
   }
 
+  // Try to find a model by local search first. If successful, the model
+  // values are given by the local search until the next check.
+  d_localSearchModel = false;
+  if (d_localSearch != nullptr && level == Theory::Effort::EFFORT_FULL)
+  {
+    std::vector<Node> facts(d_assertions.begin(), d_assertions.end());
+    for (const prop::SatLiteral& lit : d_assumptions)
+    {
+      facts.push_back(d_literalFactCache[lit]);
+    }
+    if (d_localSearch->solve(facts, options().bv.bvLocalSearchMoves))
+    {
+      d_localSearchModel = true;
+      return;
+    }
+  }
+
   std::vector<prop::SatLiteral> assumptions(d_assumptions.begin(),
                                             d_assumptions.end());
   prop::SatValue val = d_satSolver->solve(assumptions);
@@ -369,6 +395,15 @@ Node BVSolverBitblast::getValue(TNode node, bool initialize)
   }
 
   NodeManager* nm = node.getNodeManager();
+  if (d_localSearchModel)
+  {
+    Node value = d_localSearch->getValue(node);
+    if (value.isNull() && initialize)
+    {
+      value = utils::mkConst(nm, utils::getSize(node), 0u);
+    }
+    return value;
+  }
   if (!d_bitblaster->hasBBTerm(node))
   {
     return initialize ? utils::mkConst(nm, utils::getSize(node), 0u) : Node();
@@ -23,6 +23,7 @@
 #include "prop/sat_solver.h"
 #include "smt/env_obj.h"
 #include "theory/bv/bitblast/node_bitblaster.h"
+#include "theory/bv/bv_local_search.h"
 #include "theory/bv/bv_solver.h"
 #include "theory/bv/proof_checker.h"
 
@@ -130,6 +131,18 @@ class BVSolverBitblast : public BVSolver
   context::CDHashMap<prop::SatLiteral, Node, prop::SatLiteralHashFunction>
       d_literalFactCache;
 
+  /**
+   * Local search that is tried before solving the bit-blasted constraints
+   * at full effort, if --bv-local-search is enabled.
+   */
+  std::unique_ptr<BVLocalSearch> d_localSearch;
+
+  /**
+   * Whether the current model is given by d_localSearch instead of the SAT
+   * solver.
+   */
+  bool d_localSearchModel;
+
   /** Option to enable/disable bit-level propagation. */
   bool d_propagate;
 
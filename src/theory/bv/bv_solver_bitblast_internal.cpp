@@ -19,6 +19,7 @@
 #include "theory/bv/theory_bv.h"
 #include "theory/bv/theory_bv_utils.h"
 #include "theory/theory_model.h"
+#include "util/statistics_registry.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -69,6 +70,13 @@ void collectBVAtoms(TNode n, std::unordered_set<Node>& atoms)
 BVSolverBitblastInternal::BVSolverBitblastInternal(
     Env& env, TheoryState* s, TheoryInferenceManager& inferMgr)
     : BVSolver(env, *s, inferMgr),
+      d_relevantOnly(options().bv.bvBitblastRelevant
+                     && options().bv.bitblastMode
+                            != options::BitblastMode::EAGER),
+      d_assertedAtoms(context()),
+      d_bbLemmas(userContext()),
+      d_statSkipped(statisticsRegistry().registerInt(
+          "theory::bv::BVSolverBitblastInternal::irrelevantSkipped")),
       d_bitblaster(new BBProof(env, s, false)),
       d_epg(new EagerProofGenerator(d_env))
 {
@@ -76,6 +84,10 @@ BVSolverBitblastInternal::BVSolverBitblastInternal(
 
 void BVSolverBitblastInternal::addBBLemma(TNode fact)
 {
+  if (d_relevantOnly && !d_bbLemmas.insert(fact))
+  {
+    return;
+  }
   if (!d_bitblaster->hasBBAtom(fact))
   {
     d_bitblaster->bbAtom(fact);
@@ -116,7 +128,15 @@ bool BVSolverBitblastInternal::preNotifyFact(CVC5_UNUSED TNode atom,
 
   if (isBVAtom(fact))
   {
-    addBBLemma(fact);
+    if (d_relevantOnly)
+    {
+      // bit-blasted at full effort if relevant
+      d_assertedAtoms.push_back(fact);
+    }
+    else
+    {
+      addBBLemma(fact);
+    }
   }
   else if (fact.getKind() == Kind::BITVECTOR_EAGER_ATOM)
   {
@@ -149,6 +169,35 @@ bool BVSolverBitblastInternal::preNotifyFact(CVC5_UNUSED TNode atom,
   return options().bv.bitblastMode == options::BitblastMode::EAGER;
 }
 
+void BVSolverBitblastInternal::postCheck(Theory::Effort level)
+{
+  if (!d_relevantOnly || !Theory::fullEffort(level))
+  {
+    return;
+  }
+  Valuation& val = d_state.getValuation();
+  size_t nskipped = 0;
+  for (const Node& atom : d_assertedAtoms)
+  {
+    if (d_bbLemmas.contains(atom))
+    {
+      continue;
+    }
+    if (val.isRelevant(atom))
+    {
+      addBBLemma(atom);
+    }
+    else
+    {
+      nskipped++;
+      ++d_statSkipped;
+    }
+  }
+  Trace("bv-bitblast-internal")
+      << "postCheck: " << d_bbLemmas.size() << " atoms bit-blasted, "
+      << nskipped << " irrelevant atoms skipped" << std::endl;
+}
+
 TrustNode BVSolverBitblastInternal::explain(TNode n)
 {
   Trace("bv-bitblast-internal") << "explain called on " << n << std::endl;
@@ -16,10 +16,13 @@
 #ifndef CVC5__THEORY__BV__BV_SOLVER_BITBLAST_INTERNAL_H
 #define CVC5__THEORY__BV__BV_SOLVER_BITBLAST_INTERNAL_H
 
+#include "context/cdhashset.h"
+#include "context/cdlist.h"
 #include "proof/eager_proof_generator.h"
 #include "smt/env_obj.h"
 #include "theory/bv/bitblast/proof_bitblaster.h"
 #include "theory/bv/bv_solver.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -31,6 +34,16 @@ namespace bv {
  * BITVECTOR_EAGER_ATOM.
  *
  * Sends lemmas atom <=> bb(atom) to MiniSat on preNotifyFact().
+ *
+ * If --bv-bitblast-relevant is enabled, asserted atoms are only recorded on
+ * preNotifyFact(), and the lemmas are sent at full effort for the asserted
+ * atoms that are relevant, as determined by the relevance manager. Asserted
+ * atoms that do not matter for satisfying the input (e.g. those in the
+ * branches of an ITE that is not taken) are never bit-blasted. Word-level
+ * reasoning on the remaining atoms is done by the equality engine. This is
+ * only enabled for quantifier-free pure bit-vector logics, since the
+ * relevance manager does not justify the literals of lemmas that are not
+ * marked as needing justification, e.g. the splits of theory combination.
  */
 class BVSolverBitblastInternal : public BVSolver
 {
@@ -50,6 +63,8 @@ class BVSolverBitblastInternal : public BVSolver
                      bool isPrereg,
                      bool isInternal) override;
 
+  void postCheck(Theory::Effort level) override;
+
   TrustNode explain(TNode n) override;
 
   std::string identify() const override { return "BVSolverBitblastInternal"; };
@@ -66,6 +81,17 @@ class BVSolverBitblastInternal : public BVSolver
    */
   void addBBLemma(TNode fact);
 
+  /** Are we bit-blasting the relevant atoms only? */
+  bool d_relevantOnly;
+  /** The asserted BV atoms (SAT context dependent) */
+  context::CDList<Node> d_assertedAtoms;
+  /** The atoms we have sent a bit-blasting lemma for (user context dependent) */
+  context::CDHashSet<Node> d_bbLemmas;
+  /**
+   * Number of times an asserted atom was not bit-blasted at a full effort
+   * check since it was not relevant
+   */
+  IntStat d_statSkipped;
   /** Bit-blaster used to bit-blast atoms/terms. */
   std::unique_ptr<BBProof> d_bitblaster;
   /** Proof generator for unpacking BITVECTOR_EAGER_ATOM. */
@@ -94,6 +94,12 @@ const EeTheoryInfo* CombinationEngine::getEeTheoryInfo(TheoryId tid) const
 
 void CombinationEngine::resetModel() { d_mmanager->resetModel(); }
 
+bool CombinationEngine::buildPartialModel(const std::vector<Node>& terms,
+                                          const std::vector<TypeNode>& types)
+{
+  return d_mmanager->buildPartialModel(terms, types);
+}
+
 void CombinationEngine::postProcessModel(bool incomplete)
 {
   d_eemanager->notifyModel(incomplete);
@@ -65,6 +65,14 @@ class CombinationEngine : protected EnvObj
    * @return true if model building was successful.
    */
   virtual bool buildModel() = 0;
+  /**
+   * Build a partial model for the given terms and types, see
+   * ModelManager::buildPartialModel.
+   *
+   * @return true if model building was successful.
+   */
+  bool buildPartialModel(const std::vector<Node>& terms,
+                         const std::vector<TypeNode>& types);
   /**
    * Post process the model maintained by this class. This is called after
    * a successful call to buildModel. This does any theory-specific
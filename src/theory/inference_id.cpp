@@ -49,12 +49,14 @@ const char* toString(InferenceId i)
     case InferenceId::ARITH_CONF_REPLAY_LOG_REC:
       return "ARITH_CONF_REPLAY_LOG_REC";
     case InferenceId::ARITH_CONF_UNATE_PROP: return "ARITH_CONF_UNATE_PROP";
+    case InferenceId::ARITH_DL_CONFLICT: return "ARITH_DL_CONFLICT";
     case InferenceId::ARITH_SPLIT_DEQ: return "ARITH_SPLIT_DEQ";
     case InferenceId::ARITH_TIGHTEN_CEIL: return "ARITH_TIGHTEN_CEIL";
     case InferenceId::ARITH_TIGHTEN_FLOOR: return "ARITH_TIGHTEN_FLOOR";
     case InferenceId::ARITH_APPROX_CUT: return "ARITH_APPROX_CUT";
     case InferenceId::ARITH_BB_LEMMA: return "ARITH_BB_LEMMA";
     case InferenceId::ARITH_DIO_CUT: return "ARITH_DIO_CUT";
+    case InferenceId::ARITH_GOMORY_CUT: return "ARITH_GOMORY_CUT";
     case InferenceId::ARITH_DIO_DECOMPOSITION: return "ARITH_DIO_DECOMPOSITION";
     case InferenceId::ARITH_UNATE: return "ARITH_UNATE";
     case InferenceId::ARITH_ROW_IMPL: return "ARITH_ROW_IMPL";
@@ -82,6 +82,8 @@ enum class InferenceId
   ARITH_CONF_REPLAY_LOG_REC,
   // conflict from handleUnateProp
   ARITH_CONF_UNATE_PROP,
+  // negative cycle found by the difference logic solver
+  ARITH_DL_CONFLICT,
   // introduces split on a disequality
   ARITH_SPLIT_DEQ,
   // tighten integer inequalities to ceiling
@@ -91,6 +93,8 @@ enum class InferenceId
   ARITH_APPROX_CUT,
   ARITH_BB_LEMMA,
   ARITH_DIO_CUT,
+  // Gomory mixed-integer cut derived from a row of the tableau
+  ARITH_GOMORY_CUT,
   ARITH_DIO_DECOMPOSITION,
   // unate lemma during presolve
   ARITH_UNATE,
@@ -0,0 +1,323 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Profiling of the cost and usefulness of lemmas per inference identifier.
+ */
+
+#include "theory/inference_profiler.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+
+namespace {
+
+/** Prints the profile to an output stream */
+class StreamPrinter
+{
+ public:
+  StreamPrinter(std::ostream& out) : d_out(out) {}
+  void text(const char* s) { d_out << s; }
+  void left(const char* s, size_t w)
+  {
+    d_out << std::left << std::setw(w) << s << std::right;
+  }
+  void right(const char* s, size_t w) { d_out << std::setw(w) << s; }
+  void endl() { d_out << std::endl; }
+
+ private:
+  std::ostream& d_out;
+};
+
+/**
+ * Prints the profile to a file descriptor. Does not allocate memory, and is
+ * hence safe to use in a signal handler.
+ */
+class FdPrinter
+{
+ public:
+  FdPrinter(int fd) : d_fd(fd) {}
+  void text(const char* s) { write(s, strlen(s)); }
+  void left(const char* s, size_t w)
+  {
+    size_t len = strlen(s);
+    write(s, len);
+    pad(len, w);
+  }
+  void right(const char* s, size_t w)
+  {
+    size_t len = strlen(s);
+    pad(len, w);
+    write(s, len);
+  }
+  void endl() { write("\n", 1); }
+
+ private:
+  void pad(size_t len, size_t w)
+  {
+    for (; len < w; ++len)
+    {
+      write(" ", 1);
+    }
+  }
+  void write(const char* s, size_t len)
+  {
+    if (::write(d_fd, s, len) != static_cast<ssize_t>(len))
+    {
+      abort();
+    }
+  }
+  int d_fd;
+};
+
+/** The size of the buffers for formatting numbers */
+constexpr size_t s_bufSize = 32;
+
+/** Format n into buf, returns buf */
+const char* formatUInt(char* buf, uint64_t n)
+{
+  char digits[s_bufSize];
+  size_t i = 0;
+  do
+  {
+    digits[i++] = static_cast<char>('0' + n % 10);
+    n /= 10;
+  } while (n > 0);
+  size_t j = 0;
+  while (i > 0)
+  {
+    buf[j++] = digits[--i];
+  }
+  buf[j] = '\0';
+  return buf;
+}
+
+/** Format t / 1000 with three decimals into buf, returns buf */
+const char* formatThousandths(char* buf, uint64_t t)
+{
+  formatUInt(buf, t / 1000);
+  size_t len = strlen(buf);
+  uint64_t frac = t % 1000;
+  buf[len] = '.';
+  buf[len + 1] = static_cast<char>('0' + frac / 100);
+  buf[len + 2] = static_cast<char>('0' + frac / 10 % 10);
+  buf[len + 3] = static_cast<char>('0' + frac % 10);
+  buf[len + 4] = '\0';
+  return buf;
+}
+
+/**
+ * Get the wall-clock time, in nanoseconds. Unlike the CPU time of the
+ * process, it is not affected by other solvers running in other threads.
+ */
+uint64_t getTime()
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace
+
+InferenceProfiler::InferenceProfiler(StatisticsRegistry& sr)
+    : d_infs(static_cast<size_t>(InferenceId::UNKNOWN) + 1),
+      d_theories(static_cast<size_t>(THEORY_LAST) + 1),
+      d_inCheck(false),
+      d_checkTheory(THEORY_LAST),
+      d_checkStart(0),
+      d_current(InferenceId::NONE),
+      d_ranked(d_infs.size()),
+      d_statLemmas(sr.registerHistogram<InferenceId>(
+          "theory::inferenceProfile::lemmas", false)),
+      d_statTime(sr.registerHistogram<InferenceId>(
+          "theory::inferenceProfile::timeMicros", false)),
+      d_statPropagations(sr.registerHistogram<InferenceId>(
+          "theory::inferenceProfile::propagations", false)),
+      d_statConflicts(sr.registerHistogram<InferenceId>(
+          "theory::inferenceProfile::conflicts", false)),
+      d_statChecks(sr.registerHistogram<TheoryId>(
+          "theory::inferenceProfile::checks", false)),
+      d_statCheckTime(sr.registerHistogram<TheoryId>(
+          "theory::inferenceProfile::checkTimeMicros", false)),
+      d_statIdleTime(sr.registerHistogram<TheoryId>(
+          "theory::inferenceProfile::idleTimeMicros", false))
+{
+}
+
+void InferenceProfiler::beginCheck(TheoryId tid)
+{
+  d_inCheck = true;
+  d_checkTheory = tid;
+  d_checkStart = getTime();
+  d_checkLemmas.clear();
+}
+
+void InferenceProfiler::endCheck()
+{
+  if (!d_inCheck)
+  {
+    return;
+  }
+  d_inCheck = false;
+  uint64_t time = getTime() - d_checkStart;
+  TheoryData& td = d_theories[d_checkTheory];
+  ++td.d_checks;
+  td.d_time += time;
+  d_statChecks << d_checkTheory;
+  d_statCheckTime.add(d_checkTheory, time / 1000);
+  if (d_checkLemmas.empty())
+  {
+    td.d_idleTime += time;
+    d_statIdleTime.add(d_checkTheory, time / 1000);
+    return;
+  }
+  uint64_t share = time / d_checkLemmas.size();
+  for (InferenceId id : d_checkLemmas)
+  {
+    d_infs[static_cast<size_t>(id)].d_time += share;
+    d_statTime.add(id, share / 1000);
+  }
+}
+
+void InferenceProfiler::notifyLemma(InferenceId id, TheoryId from)
+{
+  InferenceData& d = d_infs[static_cast<size_t>(id)];
+  ++d.d_lemmas;
+  d_statLemmas << id;
+  d.d_theory = from;
+  ++d_theories[from].d_lemmas;
+  if (d_inCheck)
+  {
+    d_checkLemmas.push_back(id);
+  }
+}
+
+void InferenceProfiler::notifyPropagation(InferenceId id)
+{
+  ++d_infs[static_cast<size_t>(id)].d_propagations;
+  d_statPropagations << id;
+}
+
+void InferenceProfiler::notifyConflict(InferenceId id)
+{
+  ++d_infs[static_cast<size_t>(id)].d_conflicts;
+  d_statConflicts << id;
+}
+
+void InferenceProfiler::print(std::ostream& out) const
+{
+  StreamPrinter p(out);
+  printTo(p);
+}
+
+void InferenceProfiler::printSafe(int fd) const
+{
+  FdPrinter p(fd);
+  printTo(p);
+}
+
+template <typename Printer>
+void InferenceProfiler::printTo(Printer& p) const
+{
+  // d_ranked has the size of d_infs, so that we do not allocate memory here
+  size_t nranked = 0;
+  for (size_t i = 0, n = d_infs.size(); i < n; ++i)
+  {
+    const InferenceData& d = d_infs[i];
+    if (d.d_lemmas > 0 || d.d_propagations > 0 || d.d_conflicts > 0)
+    {
+      d_ranked[nranked++] = i;
+    }
+  }
+  std::sort(d_ranked.begin(),
+            d_ranked.begin() + nranked,
+            [this](size_t i, size_t j) {
+              const InferenceData& di = d_infs[i];
+              const InferenceData& dj = d_infs[j];
+              if (di.d_time != dj.d_time)
+              {
+                return di.d_time > dj.d_time;
+              }
+              if (di.d_lemmas != dj.d_lemmas)
+              {
+                return di.d_lemmas > dj.d_lemmas;
+              }
+              return i < j;
+            });
+  char buf[s_bufSize];
+  p.text("; inference profile (wall-clock time), ranked by time:");
+  p.endl();
+  p.text(";   ");
+  p.left("inference", 48);
+  p.right("lemmas", 12);
+  p.right("time (ms)", 14);
+  p.right("props", 12);
+  p.right("conflicts", 12);
+  p.right("yield", 10);
+  p.endl();
+  for (size_t k = 0; k < nranked; ++k)
+  {
+    size_t i = d_ranked[k];
+    const InferenceData& d = d_infs[i];
+    p.text(";   ");
+    p.left(toString(static_cast<InferenceId>(i)), 48);
+    p.right(formatUInt(buf, d.d_lemmas), 12);
+    p.right(formatThousandths(buf, d.d_time / 1000), 14);
+    p.right(formatUInt(buf, d.d_propagations), 12);
+    p.right(formatUInt(buf, d.d_conflicts), 12);
+    // the number of uses per lemma
+    if (d.d_lemmas > 0)
+    {
+      uint64_t uses = d.d_propagations + d.d_conflicts;
+      p.right(formatThousandths(buf, uses * 1000 / d.d_lemmas), 10);
+    }
+    else
+    {
+      p.right("-", 10);
+    }
+    p.endl();
+  }
+  p.text("; theory profile:");
+  p.endl();
+  p.text(";   ");
+  p.left("theory", 24);
+  p.right("checks", 12);
+  p.right("time (ms)", 14);
+  p.right("no lemma (ms)", 20);
+  p.right("lemmas", 12);
+  p.endl();
+  for (size_t i = 0, n = d_theories.size(); i < n; ++i)
+  {
+    const TheoryData& td = d_theories[i];
+    if (td.d_checks == 0 && td.d_lemmas == 0)
+    {
+      continue;
+    }
+    p.text(";   ");
+    p.left(toString(static_cast<TheoryId>(i)), 24);
+    p.right(formatUInt(buf, td.d_checks), 12);
+    p.right(formatThousandths(buf, td.d_time / 1000), 14);
+    p.right(formatThousandths(buf, td.d_idleTime / 1000), 20);
+    p.right(formatUInt(buf, td.d_lemmas), 12);
+    p.endl();
+  }
+}
+
+}  // namespace theory
+}  // namespace cvc5::internal
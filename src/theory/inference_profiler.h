@@ -0,0 +1,141 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Profiling of the cost and usefulness of lemmas per inference identifier.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__INFERENCE_PROFILER_H
+#define CVC5__THEORY__INFERENCE_PROFILER_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include "theory/inference_id.h"
+#include "theory/theory_id.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class StatisticsRegistry;
+
+namespace theory {
+
+/**
+ * Collects, for each inference identifier, the number of lemmas sent with
+ * that identifier, the time spent producing them, and how often the clauses
+ * of these lemmas were used by the SAT solver afterwards.
+ *
+ * The wall-clock time of a theory check is divided evenly among the lemmas
+ * sent during that check. The time of checks that send no lemma is accounted
+ * to the theory only.
+ *
+ * The clauses obtained from a lemma (including the definitions of the atoms
+ * it introduces) are tagged with the identifier of the lemma while it is
+ * converted to CNF, see getCurrentLemma. The SAT solver reports each time a
+ * tagged clause propagates a literal, or is used in the analysis of a
+ * conflict. Only MiniSat reports these uses, since CaDiCaL does not expose
+ * the reasons of its propagations. With CaDiCaL as the CDCL(T) solver, only
+ * the numbers of lemmas and the times are profiled.
+ *
+ * The profile is also maintained in the statistics
+ * theory::inferenceProfile::*, so that it is available through the API.
+ */
+class InferenceProfiler
+{
+ public:
+  InferenceProfiler(StatisticsRegistry& sr);
+  /** Notify that theory tid starts a check */
+  void beginCheck(TheoryId tid);
+  /** Notify that the current check ends */
+  void endCheck();
+  /** Notify that a lemma with identifier id was sent by theory from */
+  void notifyLemma(InferenceId id, TheoryId from);
+  /**
+   * Set the identifier of the lemma that is being converted to clauses, or
+   * InferenceId::NONE if no lemma is converted.
+   */
+  void setCurrentLemma(InferenceId id) { d_current = id; }
+  /** Get the identifier of the lemma that is being converted to clauses */
+  InferenceId getCurrentLemma() const { return d_current; }
+  /** Notify that a clause of a lemma with identifier id propagated */
+  void notifyPropagation(InferenceId id);
+  /** Notify that a clause of a lemma with identifier id was in a conflict */
+  void notifyConflict(InferenceId id);
+  /**
+   * Print the profile as a table of the inference identifiers ranked by
+   * time, followed by a table of the theories.
+   */
+  void print(std::ostream& out) const;
+  /** Same as print(), but safe to use in a signal handler. */
+  void printSafe(int fd) const;
+
+ private:
+  /** Print the profile with p, which is a printer of inference_profiler.cpp */
+  template <typename Printer>
+  void printTo(Printer& p) const;
+  /** The profile of an inference identifier */
+  struct InferenceData
+  {
+    /** The theory that sent the lemmas */
+    TheoryId d_theory = THEORY_LAST;
+    /** The number of lemmas */
+    uint64_t d_lemmas = 0;
+    /** The time spent producing the lemmas, in nanoseconds */
+    uint64_t d_time = 0;
+    /** The number of propagations by the clauses of the lemmas */
+    uint64_t d_propagations = 0;
+    /** The number of conflicts the clauses of the lemmas were used in */
+    uint64_t d_conflicts = 0;
+  };
+  /** The profile of a theory */
+  struct TheoryData
+  {
+    /** The number of checks */
+    uint64_t d_checks = 0;
+    /** The time spent in checks, in nanoseconds */
+    uint64_t d_time = 0;
+    /** The time spent in checks that sent no lemma, in nanoseconds */
+    uint64_t d_idleTime = 0;
+    /** The number of lemmas sent */
+    uint64_t d_lemmas = 0;
+  };
+  /** The profiles, indexed by inference identifier */
+  std::vector<InferenceData> d_infs;
+  /** The profiles, indexed by theory identifier */
+  std::vector<TheoryData> d_theories;
+  /** Are we in a check? */
+  bool d_inCheck;
+  /** The theory of the current check */
+  TheoryId d_checkTheory;
+  /** The time at the start of the current check, in nanoseconds */
+  uint64_t d_checkStart;
+  /** The lemmas sent in the current check */
+  std::vector<InferenceId> d_checkLemmas;
+  /** The identifier of the lemma that is being converted to clauses */
+  InferenceId d_current;
+  /** Buffer for the inference identifiers ranked by print() */
+  mutable std::vector<size_t> d_ranked;
+  /** The statistics for d_infs */
+  HistogramStat<InferenceId> d_statLemmas;
+  HistogramStat<InferenceId> d_statTime;
+  HistogramStat<InferenceId> d_statPropagations;
+  HistogramStat<InferenceId> d_statConflicts;
+  /** The statistics for d_theories */
+  HistogramStat<TheoryId> d_statChecks;
+  HistogramStat<TheoryId> d_statCheckTime;
+  HistogramStat<TheoryId> d_statIdleTime;
+};
+
+}  // namespace theory
+}  // namespace cvc5::internal
+
+#endif /* CVC5__THEORY__INFERENCE_PROFILER_H */
@@ -12,6 +12,8 @@
 
 #include "theory/model_manager.h"
 
+#include "expr/node_algorithm.h"
+#include "options/quantifiers_options.h"
 #include "options/smt_options.h"
 #include "options/theory_options.h"
 #include "prop/prop_engine.h"
@@ -34,7 +36,9 @@ ModelManager::ModelManager(Env& env, TheoryEngine& te, EqEngineManager& eem)
           env, "DefaultModel", options().theory.assignFunctionValues)),
       d_modelBuilder(nullptr),
       d_modelBuilt(false),
-      d_modelBuiltSuccess(false)
+      d_modelBuiltSuccess(false),
+      d_partialModelSupported(false),
+      d_modelPartial(false)
 {
 }
 
@@ -60,24 +64,109 @@ void ModelManager::finishInit(eq::EqualityEngineNotify* notify)
   }
   // notice that the equality engine of the model has yet to be assigned.
   initializeModelEqEngine(notify);
+  // Partial models are only supported by the default model builder. We also
+  // do not build them if the model is post-processed by separation logic, or
+  // checked in full, and the model builder does not build them with finite
+  // model finding or in higher-order logic.
+  d_partialModelSupported =
+      options().smt.lazyModelBuild
+      && d_modelBuilder == d_alocModelBuilder.get()
+      && !logicInfo().isTheoryEnabled(THEORY_SEP)
+      && !options().smt.debugCheckModels
+      && !options().quantifiers.finiteModelFind
+      && !logicInfo().isHigherOrder();
 }
 
 void ModelManager::resetModel()
 {
   d_modelBuilt = false;
   d_modelBuiltSuccess = false;
+  d_modelPartial = false;
+  d_partialTerms.clear();
+  d_partialTypes.clear();
+  d_partialAssignments.clear();
   // Reset basic information on the model object
   d_model->reset();
 }
 
 bool ModelManager::buildModel()
 {
-  if (d_modelBuilt)
+  if (d_modelBuilt && !d_modelPartial)
   {
     // already computed
     return d_modelBuiltSuccess;
   }
+  return buildModelInternal(false);
+}
+
+bool ModelManager::buildPartialModel(const std::vector<Node>& terms,
+                                     const std::vector<TypeNode>& types)
+{
+  if (!d_partialModelSupported)
+  {
+    return buildModel();
+  }
+  if (d_modelBuilt)
+  {
+    if (!d_modelPartial)
+    {
+      // the full model was already computed
+      return d_modelBuiltSuccess;
+    }
+    bool covered = true;
+    for (const Node& t : terms)
+    {
+      covered = covered && d_partialTerms.find(t) != d_partialTerms.end();
+    }
+    for (const TypeNode& tn : types)
+    {
+      covered = covered && d_partialTypes.find(tn) != d_partialTypes.end();
+    }
+    if (covered)
+    {
+      // already computed
+      return d_modelBuiltSuccess;
+    }
+  }
+  d_partialTerms.insert(terms.begin(), terms.end());
+  d_partialTypes.insert(types.begin(), types.end());
+  return buildModelInternal(true);
+}
+
+void ModelManager::computePartialModelTheories()
+{
+  std::unordered_set<TypeNode> types(d_partialTypes.begin(),
+                                     d_partialTypes.end());
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit(d_partialTerms.begin(), d_partialTerms.end());
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    types.insert(cur.getType());
+    if (cur.getKind() == Kind::APPLY_UF)
+    {
+      visit.push_back(cur.getOperator());
+    }
+    visit.insert(visit.end(), cur.begin(), cur.end());
+  }
+  std::unordered_set<TypeNode> ctypes;
+  for (const TypeNode& tn : types)
+  {
+    expr::getComponentTypes(tn, ctypes);
+  }
+  for (const TypeNode& tn : ctypes)
+  {
+    d_collectTheories.insert(d_env.theoryOf(tn));
+  }
+}
 
+bool ModelManager::buildModelInternal(bool partial)
+{
   ResourceManager* rm = d_env.getResourceManager();
 
   // Disable resource manager limit while building the model. This ensures
@@ -85,19 +174,72 @@ bool ModelManager::buildModel()
   // long).
   rm->setEnabled(false);
 
-  // reset the flags now
-  d_modelBuilt = true;
-  d_modelBuiltSuccess = false;
-
-  // prepare the model, which is specific to the manager
-  if (!prepareModel())
+  // A partial model is first built from the model information of the
+  // theories of the requested terms and types only. If its cone contains
+  // terms of other theories, we build it again from the information of all
+  // theories.
+  d_collectTheories.clear();
+  if (partial)
   {
-    Trace("model-builder") << "ModelManager: fail prepare model" << std::endl;
+    computePartialModelTheories();
   }
-  else
+  bool rebuild;
+  do
   {
+    rebuild = false;
+    if (d_modelBuilt)
+    {
+      // we are extending a partial model, we reset the model object and build
+      // it again
+      d_model->reset();
+    }
+
+    // reset the flags now
+    d_modelBuilt = true;
+    d_modelBuiltSuccess = false;
+    d_modelPartial = false;
+
+    // prepare the model, which is specific to the manager
+    if (!prepareModel())
+    {
+      Trace("model-builder") << "ModelManager: fail prepare model" << std::endl;
+      break;
+    }
+    // preserve the values of earlier partial models
+    for (const std::pair<Node, Node>& pa : d_partialAssignments)
+    {
+      if (d_model->hasTerm(pa.first))
+      {
+        d_model->assertEquality(pa.first, pa.second, true);
+      }
+    }
+    if (partial)
+    {
+      d_modelBuilder->setPartialModelTerms(
+          std::vector<Node>(d_partialTerms.begin(), d_partialTerms.end()),
+          std::vector<TypeNode>(d_partialTypes.begin(), d_partialTypes.end()),
+          d_collectTheories);
+    }
     // now, finish building the model
     d_modelBuiltSuccess = finishBuildModel();
+    if (partial)
+    {
+      d_modelBuilder->setPartialModelTerms({}, {}, {});
+      if (d_modelBuilder->needsAllTheories())
+      {
+        Assert(!d_collectTheories.empty());
+        Trace("model-builder")
+            << "ModelManager: rebuild with all theories" << std::endl;
+        d_collectTheories.clear();
+        rebuild = true;
+        continue;
+      }
+      d_modelPartial = d_modelBuilder->isPartialModel();
+      const std::vector<std::pair<Node, Node>>& pas =
+          d_modelBuilder->getPartialModelAssignments();
+      d_partialAssignments.insert(
+          d_partialAssignments.end(), pas.begin(), pas.end());
+    }
 
     if (TraceIsOn("model-final"))
     {
@@ -107,7 +249,7 @@ bool ModelManager::buildModel()
 
     Trace("model-builder") << "ModelManager: model built success is "
                            << d_modelBuiltSuccess << std::endl;
-  }
+  } while (rebuild);
 
   // Enable resource management again.
   rm->setEnabled(true);
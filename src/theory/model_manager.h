@@ -16,6 +16,9 @@
 #define CVC5__THEORY__MODEL_MANAGER__H
 
 #include <memory>
+#include <set>
+#include <unordered_set>
+#include <vector>
 
 #include "smt/env_obj.h"
 #include "theory/ee_manager.h"
@@ -61,6 +64,27 @@ class ModelManager : protected EnvObj
    * @return true if model building was successful.
    */
   bool buildModel();
+  /**
+   * Build a partial model that assigns values only to the parts of the model
+   * that the values of the given terms and the domain elements of the given
+   * types depend on, see TheoryEngineModelBuilder::setPartialModelTerms. If
+   * a full model was already built, or a partial model for these terms and
+   * types, this does nothing. If a partial model for other terms was built,
+   * it is extended by building a partial model for the union of the terms.
+   * The values assigned by earlier partial models of this round are
+   * preserved.
+   *
+   * Only the theories of the types of (the subterms of) the given terms and
+   * the given types collect their model information, unless the cone of the
+   * partial model contains terms of other theories.
+   *
+   * This builds the full model if partial models are not supported in the
+   * current configuration.
+   *
+   * @return true if model building was successful.
+   */
+  bool buildPartialModel(const std::vector<Node>& terms,
+                         const std::vector<TypeNode>& types);
   /**
    * Have we called buildModel this round? Note this returns true whether or
    * not the model building was successful.
@@ -106,6 +130,17 @@ class ModelManager : protected EnvObj
    * @return true if we are in conflict.
    */
   bool collectModelBooleanVariables();
+  /**
+   * Build the model, which is partial for d_partialTerms and d_partialTypes
+   * if partial is true.
+   */
+  bool buildModelInternal(bool partial);
+  /**
+   * Compute d_collectTheories for a partial model, i.e. the theories of the
+   * (component) types of d_partialTypes and of the subterms of
+   * d_partialTerms.
+   */
+  void computePartialModelTheories();
 
   /** Reference to the theory engine */
   TheoryEngine& d_te;
@@ -130,6 +165,25 @@ class ModelManager : protected EnvObj
   bool d_modelBuilt;
   /** whether this model has been built successfully */
   bool d_modelBuiltSuccess;
+  /** whether partial models are supported in the current configuration */
+  bool d_partialModelSupported;
+  /** whether the model we built is partial */
+  bool d_modelPartial;
+  /**
+   * The theories whose model information is collected by prepareModel, or
+   * empty if all theories are collected. This is only non-empty while
+   * building a partial model.
+   */
+  std::set<TheoryId> d_collectTheories;
+  /** The terms the partial model was built for */
+  std::unordered_set<Node> d_partialTerms;
+  /** The types the partial model was built for */
+  std::unordered_set<TypeNode> d_partialTypes;
+  /**
+   * The values assigned by the partial models of this round, which are
+   * preserved by the models built later in this round.
+   */
+  std::vector<std::pair<Node, Node>> d_partialAssignments;
 };
 
 }  // namespace theory
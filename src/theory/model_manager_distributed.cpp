@@ -86,6 +86,14 @@ bool ModelManagerDistributed::prepareModel()
           << " as it does not contribute to the model anyway" << std::endl;
       continue;
     }
+    if (!d_collectTheories.empty()
+        && d_collectTheories.find(theoryId) == d_collectTheories.end())
+    {
+      Trace("model-builder") << "  Skipping theory " << theoryId
+                             << " as it is not relevant to the partial model"
+                             << std::endl;
+      continue;
+    }
     Trace("model-builder") << "  CollectModelInfo on theory: " << theoryId
                            << std::endl;
     // collect the asserted terms
@@ -101,7 +109,9 @@ bool ModelManagerDistributed::prepareModel()
     }
   }
 
-  if (!collectModelBooleanVariables())
+  if ((d_collectTheories.empty()
+       || d_collectTheories.find(THEORY_BOOL) != d_collectTheories.end())
+      && !collectModelBooleanVariables())
   {
     Trace("model-builder") << "ModelManagerDistributed: fail Boolean variables"
                            << std::endl;
@@ -35,6 +35,7 @@
 #include "theory/quantifiers/skolemize.h"
 #include "theory/quantifiers/term_registry.h"
 #include "theory/theory_engine.h"
+#include "util/trace_events.h"
 
 using namespace std;
 using namespace cvc5::internal::kind;
@@ -478,7 +479,11 @@ void QuantifiersEngine::checkInternal(Theory::Effort e,
           Trace("quant-engine-debug")
               << "Check " << mdl->identify().c_str() << " at effort " << quant_e
               << "..." << std::endl;
-          mdl->check(e, quant_e);
+          {
+            TraceEventScope traceEvent(
+                d_env.getTraceEvents(), "quantifiers", mdl->identify());
+            mdl->check(e, quant_e);
+          }
           if (d_qstate.isInConflict())
           {
             Trace("quant-engine-debug") << "...conflict!" << std::endl;
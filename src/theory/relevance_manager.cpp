@@ -12,6 +12,7 @@
 
 #include "theory/relevance_manager.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "expr/node_algorithm.h"
@@ -31,6 +32,9 @@ RelevanceManager::RelevanceManager(Env& env, TheoryEngine* engine)
       d_input(userContext()),
       d_atomMap(userContext()),
       d_rset(context()),
+      d_inputIndex(context(), 0),
+      d_unjustified(context()),
+      d_computed(false),
       d_inFullEffortCheck(false),
       d_fullEffortCheckFail(false),
       d_success(false),
@@ -145,12 +149,14 @@ void RelevanceManager::check(Theory::Effort effort)
   {
     d_inFullEffortCheck = true;
     d_fullEffortCheckFail = false;
+    d_computed = false;
   }
 }
 
 void RelevanceManager::postCheck(CVC5_UNUSED Theory::Effort effort)
 {
   d_inFullEffortCheck = false;
+  d_computed = false;
 }
 
 void RelevanceManager::computeRelevance()
@@ -166,13 +172,41 @@ void RelevanceManager::computeRelevance()
     d_success = false;
     return;
   }
-  for (const Node& node : d_input)
+  // The values of the SAT literals may have changed since the last check,
+  // hence we re-justify the input assertions that had no value. Notice that
+  // justify only revisits the subformulas that have no value.
+  if (!d_computed)
   {
+    for (const Node& node : d_unjustified)
+    {
+      if (!computeRelevanceFor(node))
+      {
+        d_success = false;
+        return;
+      }
+    }
+    d_computed = true;
+  }
+  // Justify the input assertions that were not processed in this SAT
+  // context. The input assertions before d_inputIndex remain justified, since
+  // their justification is cached in the same context.
+  size_t ninputs = d_input.size();
+  size_t i = std::min(d_inputIndex.get(), ninputs);
+  for (; i < ninputs; i++)
+  {
+    TNode node = d_input[i];
     if (!computeRelevanceFor(node))
     {
       d_success = false;
       return;
     }
+    RlvPair ci(node, d_ptctx.initialValue());
+    Assert(d_jcache.find(ci) != d_jcache.end());
+    if (d_jcache[ci] == 0)
+    {
+      d_unjustified.push_back(node);
+    }
+    d_inputIndex = i + 1;
   }
   if (TraceIsOn("rel-manager"))
   {
@@ -520,6 +554,7 @@ std::unordered_set<TNode> RelevanceManager::getRelevantAssertions(bool& success)
   // set in full effort check temporarily
   d_inFullEffortCheck = true;
   d_fullEffortCheckFail = false;
+  d_computed = false;
   computeRelevance();
   // update success flag
   success = d_success;
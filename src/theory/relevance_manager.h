@@ -21,6 +21,7 @@
 #include "context/cdhashmap.h"
 #include "context/cdhashset.h"
 #include "context/cdlist.h"
+#include "context/cdo.h"
 #include "expr/node.h"
 #include "expr/term_context.h"
 #include "theory/difficulty_manager.h"
@@ -71,6 +72,14 @@ class TheoryModel;
  * asserted literal is part of the current relevant selection. The relevant
  * selection is computed lazily, i.e. only when someone asks if a literal is
  * relevant, and only at most once per FULL effort check.
+ *
+ * The relevant selection is maintained incrementally in the SAT context.
+ * Once an input assertion is justified, its justification (and the literals
+ * it added to the relevant selection) remains valid until the SAT solver
+ * backtracks, hence each FULL effort check only justifies the input
+ * assertions that were added since the last check or that were popped by
+ * backtracking, and re-justifies the input assertions that could not be
+ * justified before. Within the same check, isRelevant is a lookup.
  */
 class RelevanceManager : public TheoryEngineModule
 {
@@ -213,6 +222,23 @@ class RelevanceManager : public TheoryEngineModule
    * literals that are definitely relevant in this context.
    */
   NodeSet d_rset;
+  /**
+   * The number of input assertions of d_input that have been processed by
+   * computeRelevance in the current SAT context. The input assertions before
+   * this index are justified, or are in d_unjustified.
+   */
+  context::CDO<size_t> d_inputIndex;
+  /**
+   * The input assertions that had no value when processed by
+   * computeRelevance (SAT context dependent). These are re-justified at each
+   * full effort check.
+   */
+  NodeList d_unjustified;
+  /**
+   * Have we re-justified the assertions in d_unjustified in the current full
+   * effort check?
+   */
+  bool d_computed;
   /** Are we in a full effort check? */
   bool d_inFullEffortCheck;
   /** Have we failed to justify a formula in a full effort check? */
@@ -22,6 +22,7 @@
 #include "theory/strings/theory_strings_utils.h"
 #include "theory/strings/word.h"
 #include "util/rational.h"
+#include "util/statistics_registry.h"
 #include "util/string.h"
 
 using namespace std;
@@ -48,6 +49,13 @@ CoreSolver::CoreSolver(Env& env,
       d_termReg(tr),
       d_bsolver(bs),
       d_nfPairs(context()),
+      d_nfCache(context()),
+      d_nfCacheId(0),
+      d_nfCacheRlv(context()),
+      d_statNfCacheReused(
+          statisticsRegistry().registerInt("theory::strings::nfCacheReused")),
+      d_statNfCacheInvalidated(statisticsRegistry().registerInt(
+          "theory::strings::nfCacheInvalidated")),
       d_extDeq(userContext()),
       d_modelUnsoundId(IncompleteId::NONE)
 {
@@ -579,6 +587,10 @@ void CoreSolver::checkNormalFormsEqProp()
   // calculate normal forms for each equivalence class, possibly adding
   // splitting lemmas
   d_normal_form.clear();
+  if (options().strings.stringsNfCache)
+  {
+    updateNormalFormCacheRelevance();
+  }
   // map from normal form terms (the concatenation of the terms in the normal
   // form) to the equivalence that had that normal form
   std::map<Node, Node> nf_to_eqc;
@@ -659,6 +671,27 @@ void CoreSolver::normalizeEquivalenceClass(Node eqc,
   {
     // should not have computed the normal form of this equivalence class yet
     Assert(d_normal_form.find(eqc) == d_normal_form.end());
+    bool useCache = options().strings.stringsNfCache;
+    if (useCache)
+    {
+      NodeNormalFormMap::const_iterator itc = d_nfCache.find(eqc);
+      if (itc != d_nfCache.end() && (*itc).second.d_valid)
+      {
+        const CachedNormalForm& cnf = (*itc).second;
+        std::vector<Node> reps;
+        std::vector<uint64_t> deps;
+        if (getNormalFormDeps(cnf.d_children, reps, deps)
+            && reps == cnf.d_childReps && deps == cnf.d_deps)
+        {
+          ++d_statNfCacheReused;
+          d_normal_form[eqc] = cnf.d_nf;
+          Trace("strings-process-debug")
+              << "Return process equivalence class " << eqc
+              << " : cached = " << d_normal_form[eqc].d_nf << std::endl;
+          return;
+        }
+      }
+    }
     // Normal forms for the relevant terms in the equivalence class of eqc
     std::vector<NormalForm> normal_forms;
     // map each term to its index in the above vector
@@ -691,12 +724,110 @@ void CoreSolver::normalizeEquivalenceClass(Node eqc,
       nf_index = it->second;
     }
     d_normal_form[eqc] = normal_forms[nf_index];
+    if (useCache)
+    {
+      // A new identifier invalidates the normal forms that depend on the
+      // previous one. We do not reuse normal forms that were assigned despite
+      // a model unsound step, since the step would not be repeated.
+      CachedNormalForm cnf;
+      cnf.d_id = ++d_nfCacheId;
+      if (d_modelUnsoundId == IncompleteId::NONE)
+      {
+        getConcatChildren(eqc, cnf.d_children);
+        cnf.d_valid =
+            getNormalFormDeps(cnf.d_children, cnf.d_childReps, cnf.d_deps);
+      }
+      if (cnf.d_valid)
+      {
+        cnf.d_nf = d_normal_form[eqc];
+      }
+      d_nfCache.insert(eqc, cnf);
+    }
     Trace("strings-process-debug")
         << "Return process equivalence class " << eqc
         << " : returned = " << d_normal_form[eqc].d_nf << std::endl;
   }
 }
 
+void CoreSolver::getConcatChildren(Node eqc, std::vector<Node>& children)
+{
+  // this should be in sync with the terms considered in getNormalForms
+  eq::EqualityEngine* ee = d_state.getEqualityEngine();
+  eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, ee);
+  const std::set<Node>& rlvSet = d_termReg.getRelevantTermSet();
+  while (!eqc_i.isFinished())
+  {
+    Node n = (*eqc_i);
+    ++eqc_i;
+    if (n.getKind() != Kind::STRING_CONCAT || d_bsolver.isCongruent(n)
+        || rlvSet.find(n) == rlvSet.end())
+    {
+      continue;
+    }
+    children.insert(children.end(), n.begin(), n.end());
+  }
+}
+
+bool CoreSolver::getNormalFormDeps(const std::vector<Node>& children,
+                                   std::vector<Node>& reps,
+                                   std::vector<uint64_t>& deps)
+{
+  eq::EqualityEngine* ee = d_state.getEqualityEngine();
+  for (const Node& nc : children)
+  {
+    Node nr = ee->getRepresentative(nc);
+    reps.push_back(nr);
+    if (d_state.areEqual(nr, Word::mkEmptyWord(nr.getType())))
+    {
+      // the normal form of the empty equivalence class never changes
+      deps.push_back(0);
+      continue;
+    }
+    NodeNormalFormMap::const_iterator itc = d_nfCache.find(nr);
+    if (itc == d_nfCache.end() || !(*itc).second.d_valid)
+    {
+      return false;
+    }
+    deps.push_back((*itc).second.d_id);
+  }
+  return true;
+}
+
+void CoreSolver::eqNotifyMerge(TNode t1)
+{
+  if (options().strings.stringsNfCache)
+  {
+    invalidateNormalForm(t1);
+  }
+}
+
+void CoreSolver::invalidateNormalForm(TNode eqc)
+{
+  NodeNormalFormMap::const_iterator itc = d_nfCache.find(eqc);
+  if (itc != d_nfCache.end() && (*itc).second.d_valid)
+  {
+    ++d_statNfCacheInvalidated;
+    CachedNormalForm cnf;
+    cnf.d_id = ++d_nfCacheId;
+    d_nfCache.insert(eqc, cnf);
+  }
+}
+
+void CoreSolver::updateNormalFormCacheRelevance()
+{
+  // A term that becomes relevant is considered by getNormalForms, hence the
+  // normal form of its equivalence class must be recomputed. The terms that
+  // join an equivalence class are handled by eqNotifyMerge.
+  eq::EqualityEngine* ee = d_state.getEqualityEngine();
+  for (const Node& n : d_termReg.getRelevantTermSet())
+  {
+    if (d_nfCacheRlv.insert(n) && ee->hasTerm(n))
+    {
+      invalidateNormalForm(ee->getRepresentative(n));
+    }
+  }
+}
+
 const std::vector<Node>& CoreSolver::getRelevantDeq() const { return d_rlvDeq; }
 
 bool CoreSolver::hasNormalForm(const Node& n) const
@@ -16,6 +16,8 @@
 #ifndef CVC5__THEORY__STRINGS__CORE_SOLVER_H
 #define CVC5__THEORY__STRINGS__CORE_SOLVER_H
 
+#include <cstdint>
+
 #include "context/cdhashmap.h"
 #include "context/cdhashset.h"
 #include "context/cdlist.h"
@@ -26,6 +28,7 @@
 #include "theory/strings/normal_form.h"
 #include "theory/strings/solver_state.h"
 #include "theory/strings/term_registry.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 namespace theory {
@@ -70,8 +73,25 @@ class CoreInferInfo
 class CoreSolver : public InferSideEffectProcess, protected EnvObj
 {
   friend class InferenceManager;
+  /**
+   * A normal form computed for an equivalence class, along with the
+   * children of the concatenation terms it was computed from, see
+   * getConcatChildren, and their dependencies, see getNormalFormDeps.
+   */
+  struct CachedNormalForm
+  {
+    /** A unique identifier of this computation of the normal form */
+    uint64_t d_id = 0;
+    /** Whether the normal form may be reused */
+    bool d_valid = false;
+    NormalForm d_nf;
+    std::vector<Node> d_children;
+    std::vector<Node> d_childReps;
+    std::vector<uint64_t> d_deps;
+  };
   using NodeIntMap = context::CDHashMap<Node, int>;
   using NodeSet = context::CDHashSet<Node>;
+  using NodeNormalFormMap = context::CDHashMap<Node, CachedNormalForm>;
 
  public:
   CoreSolver(Env& env,
@@ -216,6 +236,12 @@ class CoreSolver : public InferSideEffectProcess, protected EnvObj
   void checkRegisterTermsNormalForms();
   //-----------------------end inference steps
 
+  /**
+   * Called when the equivalence class of t2 is merged into the one of t1.
+   * This invalidates the cached normal form of t1, if any.
+   */
+  void eqNotifyMerge(TNode t1);
+
   //--------------------------- query functions
   /**
    * Get relevant disequalities, which is a list of disequalities that are
@@ -388,6 +414,32 @@ class CoreSolver : public InferSideEffectProcess, protected EnvObj
                       std::vector<NormalForm>& normal_forms,
                       std::map<Node, unsigned>& term_to_nf_index,
                       TypeNode stype);
+  /**
+   * Add the children of the relevant, non-congruent concatenation terms of
+   * equivalence class eqc to children.
+   */
+  void getConcatChildren(Node eqc, std::vector<Node>& children);
+  /**
+   * Add the representatives of children to reps, and the identifiers of their
+   * cached normal forms to deps, where empty representatives have identifier
+   * 0. Returns false if one of them has no valid cached normal form.
+   *
+   * The cached normal form of an equivalence class is invalidated when it is
+   * merged with another one, or when one of its terms becomes relevant. If
+   * it is valid and the representatives and the dependencies of its children
+   * are the same as when it was computed, then it is still the normal form
+   * of the equivalence class.
+   */
+  bool getNormalFormDeps(const std::vector<Node>& children,
+                         std::vector<Node>& reps,
+                         std::vector<uint64_t>& deps);
+  /** Invalidate the cached normal form of equivalence class eqc, if any */
+  void invalidateNormalForm(TNode eqc);
+  /**
+   * Invalidate the cached normal forms of the equivalence classes that
+   * contain terms that became relevant since the last call.
+   */
+  void updateNormalFormCacheRelevance();
   /** process normalize equivalence class
    *
    * This is called when an equivalence class eqc contains a set of terms that
@@ -561,6 +613,21 @@ class CoreSolver : public InferSideEffectProcess, protected EnvObj
   std::vector<Node> d_rlvDeq;
   /** map from terms to their normal forms */
   std::map<Node, NormalForm> d_normal_form;
+  /**
+   * The normal forms computed for equivalence classes in the current SAT
+   * context, which are reused by later calls to checkNormalFormsEqProp while
+   * their equivalence classes are unchanged. Since this map is context
+   * dependent, the explanations of the normal forms remain valid.
+   */
+  NodeNormalFormMap d_nfCache;
+  /** The last identifier of a computation of a normal form */
+  uint64_t d_nfCacheId;
+  /** The relevant terms seen by updateNormalFormCacheRelevance */
+  NodeSet d_nfCacheRlv;
+  /** Number of normal forms taken from d_nfCache */
+  IntStat d_statNfCacheReused;
+  /** Number of entries of d_nfCache invalidated by merges or relevance */
+  IntStat d_statNfCacheInvalidated;
   /**
    * In certain cases, we know that two terms are equivalent despite
    * not having to verify their normal forms are identical. For example,
@@ -1052,6 +1052,7 @@ void TheoryStrings::eqNotifyNewClass(TNode t)
 
 void TheoryStrings::eqNotifyMerge(TNode t1, TNode t2)
 {
+  d_csolver.eqNotifyMerge(t1);
   EqcInfo* e2 = d_state.getOrMakeEqcInfo(t2, false);
   if (e2 == nullptr)
   {
@@ -24,9 +24,11 @@ SubstitutionMap::SubstitutionMap(context::Context* context, bool compress)
     : d_context(),
       d_substitutions(context ? context : &d_context),
       d_substitutionCache(),
+      d_ctx(context ? context : &d_context),
+      d_changedSize(d_ctx, 0),
       d_cacheInvalidated(false),
       d_compress(compress),
-      d_cacheInvalidator(context ? context : &d_context, d_cacheInvalidated)
+      d_cacheInvalidator(context ? context : &d_context, *this)
 {
 }
 
@@ -111,8 +113,10 @@ Node SubstitutionMap::internalSubstitute(TNode t,
         if (tracker == nullptr && d_compress)
         {
           d_substitutions[current] = cache[rhs];
+          notifyChanged(current);
         }
         cache[current] = cache[rhs];
+        addCacheDependency(rhs, current);
         toVisit.pop_back();
         if (tracker != nullptr)
         {
@@ -130,11 +134,13 @@ Node SubstitutionMap::internalSubstitute(TNode t,
       if (current.getMetaKind() == kind::metakind::PARAMETERIZED)
       {
         builder << Node(cache[current.getOperator()]);
+        addCacheDependency(current.getOperator(), current);
       }
       for (const Node& nc : current)
       {
         Assert(cache.find(nc) != cache.end());
         builder << Node(cache[nc]);
+        addCacheDependency(nc, current);
       }
       // Mark the substitution and continue
       Node result = builder;
@@ -143,6 +149,7 @@ Node SubstitutionMap::internalSubstitute(TNode t,
         find = cache.find(result);
         if (find != cache.end())
         {
+          addCacheDependency(result, current);
           result = find->second;
         }
         else
@@ -164,8 +171,11 @@ Node SubstitutionMap::internalSubstitute(TNode t,
               if (d_compress)
               {
                 d_substitutions[result] = cache[rhs];
+                notifyChanged(result);
               }
               cache[result] = cache[rhs];
+              addCacheDependency(rhs, result);
+              addCacheDependency(result, current);
               if (tracker != nullptr)
               {
                 tracker->insert(result);
@@ -229,6 +239,69 @@ Node SubstitutionMap::internalSubstitute(TNode t,
   return cache[t];
 } /* SubstitutionMap::internalSubstitute() */
 
+void SubstitutionMap::addCacheDependency(TNode t, TNode parent)
+{
+  d_cacheParents[t].insert(parent);
+}
+
+void SubstitutionMap::notifyChanged(TNode x)
+{
+  // changes at level 0 are never popped
+  if (d_ctx->getLevel() == 0)
+  {
+    return;
+  }
+  d_changed.push_back(x);
+  d_changedSize = d_changed.size();
+}
+
+void SubstitutionMap::invalidateDependents(TNode x)
+{
+  if (d_cacheInvalidated)
+  {
+    // the entire cache will be cleared anyways
+    return;
+  }
+  if (x.getNumChildren() > 0
+      || x.getMetaKind() == kind::metakind::PARAMETERIZED)
+  {
+    d_cacheInvalidated = true;
+    return;
+  }
+  // Erase the results that were (transitively) computed from that of x. Note
+  // that results of terms that were not traversed due to a
+  // ShouldTraverseCallback do not depend on any substitution other than that
+  // of the term itself.
+  std::vector<Node> toErase;
+  toErase.push_back(x);
+  while (!toErase.empty())
+  {
+    Node cur = toErase.back();
+    toErase.pop_back();
+    if (d_substitutionCache.erase(cur) == 0)
+    {
+      continue;
+    }
+    std::unordered_map<Node, std::unordered_set<Node>>::iterator it =
+        d_cacheParents.find(cur);
+    if (it != d_cacheParents.end())
+    {
+      toErase.insert(toErase.end(), it->second.begin(), it->second.end());
+      d_cacheParents.erase(it);
+    }
+  }
+}
+
+void SubstitutionMap::notifyPop()
+{
+  // d_changedSize is already restored to its value in the current context
+  for (size_t i = d_changedSize.get(), n = d_changed.size(); i < n; ++i)
+  {
+    invalidateDependents(d_changed[i]);
+  }
+  d_changed.resize(d_changedSize.get());
+}
+
 void SubstitutionMap::addSubstitution(TNode x, TNode t, bool invalidateCache)
 {
   // don't check type equal here, since this utility may be used in conversions
@@ -247,11 +320,12 @@ void SubstitutionMap::addSubstitution(TNode x, TNode t, bool invalidateCache)
   Assert(x != t) << "cannot substitute a term for itself";
 
   d_substitutions[x] = t;
+  notifyChanged(x);
 
   // Also invalidate the cache if necessary
   if (invalidateCache)
   {
-    d_cacheInvalidated = true;
+    invalidateDependents(x);
   }
   else
   {
@@ -268,15 +342,16 @@ void SubstitutionMap::addSubstitutions(SubstitutionMap& subMap,
   {
     Assert(d_substitutions.find((*it).first) == d_substitutions.end());
     d_substitutions[(*it).first] = (*it).second;
-    if (!invalidateCache)
+    notifyChanged((*it).first);
+    if (invalidateCache)
+    {
+      invalidateDependents((*it).first);
+    }
+    else
     {
       d_substitutionCache[(*it).first] = d_substitutions[(*it).first];
     }
   }
-  if (invalidateCache)
-  {
-    d_cacheInvalidated = true;
-  }
 }
 
 void SubstitutionMap::eraseSubstitution(TNode x, bool invalidateCache)
@@ -285,9 +360,10 @@ void SubstitutionMap::eraseSubstitution(TNode x, bool invalidateCache)
   Assert(!d_compress);
   Assert(d_substitutions.find(x) != d_substitutions.end());
   d_substitutions[x] = x;
+  notifyChanged(x);
   if (invalidateCache)
   {
-    d_cacheInvalidated = true;
+    invalidateDependents(x);
   }
 }
 
@@ -302,6 +378,7 @@ Node SubstitutionMap::apply(TNode t,
   if (d_cacheInvalidated)
   {
     d_substitutionCache.clear();
+    d_cacheParents.clear();
     d_cacheInvalidated = false;
     Trace("substitution") << "-- reset the cache" << endl;
   }
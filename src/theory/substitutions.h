@@ -17,6 +17,7 @@
 
 // #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -64,6 +65,24 @@ class SubstitutionMap
   /** Cache of the already performed substitutions */
   NodeCache d_substitutionCache;
 
+  /**
+   * For each term in the cache, the terms whose cached results were computed
+   * from its result, i.e. its parents and the terms substituted by it.
+   */
+  std::unordered_map<Node, std::unordered_set<Node>> d_cacheParents;
+
+  /**
+   * The terms whose substitution was added or changed, in order. The terms
+   * after index d_changedSize were changed in popped contexts.
+   */
+  std::vector<Node> d_changed;
+
+  /** The context of the substitutions */
+  context::Context* d_ctx;
+
+  /** The number of terms in d_changed in the current context */
+  context::CDO<size_t> d_changedSize;
+
   /** Has the cache been invalidated? */
   bool d_cacheInvalidated;
 
@@ -76,26 +95,43 @@ class SubstitutionMap
                           std::set<TNode>* tracker,
                           const ShouldTraverseCallback* stc);
 
+  /** Record that the cached result of parent was computed from that of t */
+  void addCacheDependency(TNode t, TNode parent);
+
+  /** Record that the substitution for x was added or changed */
+  void notifyChanged(TNode x);
+
+  /**
+   * Invalidate the cached results that may depend on the substitution for x.
+   * This is precise if x has no children, since the result of a term can then
+   * only contain x or depend on the substitution of x if it was computed from
+   * the result of x. Otherwise, we invalidate the entire cache.
+   */
+  void invalidateDependents(TNode x);
+
+  /** Invalidate the results that depend on substitutions changed in popped
+   * contexts. */
+  void notifyPop();
+
   /** Helper class to invalidate cache on user pop */
   class CacheInvalidator : public context::ContextNotifyObj
   {
-    bool& d_cacheInvalidated;
+    SubstitutionMap& d_map;
 
    protected:
-    void contextNotifyPop() override { d_cacheInvalidated = true; }
+    void contextNotifyPop() override { d_map.notifyPop(); }
 
    public:
-    CacheInvalidator(context::Context* context, bool& cacheInvalidated)
-        : context::ContextNotifyObj(context),
-          d_cacheInvalidated(cacheInvalidated)
+    CacheInvalidator(context::Context* context, SubstitutionMap& map)
+        : context::ContextNotifyObj(context), d_map(map)
     {
     }
 
   }; /* class SubstitutionMap::CacheInvalidator */
 
   /**
-   * This object is notified on user pop and marks the SubstitutionMap's
-   * cache as invalidated.
+   * This object is notified on user pop and invalidates the part of the
+   * SubstitutionMap's cache that depends on the popped substitutions.
    */
   CacheInvalidator d_cacheInvalidator;
 
@@ -35,6 +35,7 @@
 #include "theory/conflict_processor.h"
 #include "theory/decision_manager.h"
 #include "theory/ee_manager_central.h"
+#include "theory/inference_profiler.h"
 #include "theory/partition_generator.h"
 #include "theory/plugin_module.h"
 #include "theory/quantifiers/first_order_model.h"
@@ -49,6 +50,7 @@
 #include "theory/theory_traits.h"
 #include "theory/uf/equality_engine.h"
 #include "util/resource_manager.h"
+#include "util/trace_events.h"
 
 using namespace std;
 
@@ -108,6 +110,21 @@ std::string getTheoryString(theory::TheoryId id)
   }
 }
 
+/**
+ * Get the name of the given effort level, for trace events.
+ */
+const char* getEffortString(theory::Theory::Effort effort)
+{
+  switch (effort)
+  {
+    case theory::Theory::EFFORT_STANDARD: return "standard";
+    case theory::Theory::EFFORT_FULL: return "full";
+    case theory::Theory::EFFORT_LAST_CALL: return "last-call";
+    default: break;
+  }
+  return "unknown";
+}
+
 void TheoryEngine::finishInit()
 {
   d_modules.clear();
@@ -396,7 +413,22 @@ void TheoryEngine::check(Theory::Effort effort)
 #define CVC5_FOR_EACH_THEORY_STATEMENT(THEORY)                           \
   if (theory::TheoryTraits<THEORY>::hasCheck && isTheoryEnabled(THEORY)) \
   {                                                                      \
-    theoryOf(THEORY)->check(effort);                                     \
+    {                                                                    \
+      TraceEventScope traceEvent(traceEvents,                            \
+                                 "theory",                               \
+                                 theory::toString(THEORY),               \
+                                 "effort",                               \
+                                 getEffortString(effort));               \
+      if (profiler != nullptr)                                           \
+      {                                                                  \
+        profiler->beginCheck(THEORY);                                    \
+      }                                                                  \
+      theoryOf(THEORY)->check(effort);                                   \
+      if (profiler != nullptr)                                           \
+      {                                                                  \
+        profiler->endCheck();                                            \
+      }                                                                  \
+    }                                                                    \
     if (d_inConflict)                                                    \
     {                                                                    \
       Trace("conflict") << THEORY << " in conflict. " << std::endl;      \
@@ -439,6 +471,8 @@ void TheoryEngine::check(Theory::Effort effort)
     }
 
     auto rm = d_env.getResourceManager();
+    TraceEventRecorder* traceEvents = d_env.getTraceEvents();
+    theory::InferenceProfiler* profiler = d_env.getInferenceProfiler();
 
     // Check until done
     while (d_factsAsserted && !d_inConflict && !d_lemmasAdded)
@@ -723,6 +757,19 @@ TheoryModel* TheoryEngine::getBuiltModel()
   return d_tc->getModel();
 }
 
+TheoryModel* TheoryEngine::getBuiltModel(const std::vector<Node>& terms,
+                                         const std::vector<TypeNode>& types)
+{
+  Assert(d_tc != nullptr);
+  // If this method was called, produceModels should be true.
+  AlwaysAssert(options().smt.produceModels);
+  if (!d_tc->buildPartialModel(terms, types))
+  {
+    return nullptr;
+  }
+  return d_tc->getModel();
+}
+
 bool TheoryEngine::buildModel()
 {
   Assert(d_tc != nullptr);
@@ -1616,6 +1663,16 @@ void TheoryEngine::lemma(TrustNode tlemma,
   // spendResource();
   Assert(tlemma.getKind() == TrustNodeKind::LEMMA
          || tlemma.getKind() == TrustNodeKind::CONFLICT);
+  TraceEventRecorder* traceEvents = d_env.getTraceEvents();
+  if (traceEvents != nullptr)
+  {
+    traceEvents->instant("theory", "lemma", "id", toString(id));
+  }
+  theory::InferenceProfiler* profiler = d_env.getInferenceProfiler();
+  if (profiler != nullptr)
+  {
+    profiler->notifyLemma(id, from);
+  }
 
   // minimize or generalize conflict
   if (d_cp)
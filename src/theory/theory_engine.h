@@ -356,6 +356,13 @@ class TheoryEngine : protected EnvObj
    * If the model cannot be built, then this returns the null pointer.
    */
   theory::TheoryModel* getBuiltModel();
+  /**
+   * Same as above, but the model is only guaranteed to be built for the
+   * values of the given terms and the domain elements of the given types if
+   * lazy model building is enabled, see ModelManager::buildPartialModel.
+   */
+  theory::TheoryModel* getBuiltModel(const std::vector<Node>& terms,
+                                     const std::vector<TypeNode>& types);
   /**
    * This forces the model maintained by the combination engine to be built
    * if it has not been done so already. This should be called only during a
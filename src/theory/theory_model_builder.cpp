@@ -34,7 +34,13 @@ using namespace cvc5::context;
 namespace cvc5::internal {
 namespace theory {
 
-TheoryEngineModelBuilder::TheoryEngineModelBuilder(Env& env) : EnvObj(env) {}
+TheoryEngineModelBuilder::TheoryEngineModelBuilder(Env& env)
+    : EnvObj(env),
+      d_partial(false),
+      d_needsAllTheories(false),
+      d_coneIndexed(false)
+{
+}
 
 void TheoryEngineModelBuilder::Assigner::initialize(
     TypeNode tn, TypeEnumeratorProperties* tep, const std::vector<Node>& aes)
@@ -198,6 +204,210 @@ void TheoryEngineModelBuilder::addAssignableSubterms(TNode n,
   cache.insert(n);
 }
 
+void TheoryEngineModelBuilder::setPartialModelTerms(
+    const std::vector<Node>& terms,
+    const std::vector<TypeNode>& types,
+    const std::set<TheoryId>& theories)
+{
+  d_partialTerms = terms;
+  d_partialTypes = types;
+  d_partialTheories = theories;
+}
+
+void TheoryEngineModelBuilder::getConeInfo(TheoryModel* tm,
+                                           Node eqc,
+                                           bool& hasConst,
+                                           bool& computed,
+                                           bool addUfApps)
+{
+  eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, tm->d_equalityEngine);
+  for (; !eqc_i.isFinished(); ++eqc_i)
+  {
+    Node n = *eqc_i;
+    if (addUfApps && n.getKind() == Kind::APPLY_UF)
+    {
+      d_ufApps[n.getOperator()].push_back(n);
+    }
+    if (isAssignable(n))
+    {
+      continue;
+    }
+    if (tm->isValue(n))
+    {
+      hasConst = true;
+    }
+    else if (!n.isVar() || tm->d_reps.find(n) != tm->d_reps.end())
+    {
+      computed = true;
+    }
+  }
+}
+
+void TheoryEngineModelBuilder::computeConeIndex(TheoryModel* tm)
+{
+  if (d_coneIndexed)
+  {
+    return;
+  }
+  d_coneIndexed = true;
+  eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(tm->d_equalityEngine);
+  for (; !eqcs_i.isFinished(); ++eqcs_i)
+  {
+    Node eqc = *eqcs_i;
+    TypeNode tn = eqc.getType();
+    d_eqcByType[tn].push_back(eqc);
+    bool hasConst = false;
+    bool computed = false;
+    getConeInfo(tm, eqc, hasConst, computed, true);
+    if (hasConst || computed)
+    {
+      d_eqcFixed[tn].push_back(eqc);
+    }
+  }
+}
+
+bool TheoryEngineModelBuilder::computeCone(TheoryModel* tm,
+                                           NodeSet& assignableCache)
+{
+  eq::EqualityEngine* ee = tm->d_equalityEngine;
+  std::unordered_set<TNode> visited;
+  // the types for which we added the equivalence classes in d_eqcFixed
+  std::unordered_set<TypeNode> typesAdded;
+  std::vector<TNode> toVisit(d_partialTerms.begin(), d_partialTerms.end());
+  if (!d_partialTypes.empty())
+  {
+    // we require a traversal of the equality engine to find the equivalence
+    // classes of the given types
+    computeConeIndex(tm);
+    for (const TypeNode& tn : d_partialTypes)
+    {
+      const std::vector<Node>& eqcs = d_eqcByType[tn];
+      toVisit.insert(toVisit.end(), eqcs.begin(), eqcs.end());
+    }
+  }
+  while (!toVisit.empty())
+  {
+    // the terms of the equivalence classes whose subterms are in the cone
+    std::vector<TNode> eeTerms;
+    // the visited terms that are not in the model
+    std::vector<TNode> nonEeTerms;
+    while (!toVisit.empty())
+    {
+      TNode cur = toVisit.back();
+      toVisit.pop_back();
+      if (!visited.insert(cur).second)
+      {
+        continue;
+      }
+      TypeNode tn = cur.getType();
+      if (!d_partialTheories.empty()
+          && d_partialTheories.find(d_env.theoryOf(tn))
+                 == d_partialTheories.end())
+      {
+        Trace("model-builder") << "Partial model requires the theory of " << tn
+                               << ", for " << cur << std::endl;
+        return false;
+      }
+      std::vector<TNode> terms;
+      if (ee->hasTerm(cur))
+      {
+        Node eqc = ee->getRepresentative(cur);
+        if (!d_cone.insert(eqc).second)
+        {
+          continue;
+        }
+        d_coneList.push_back(eqc);
+        bool hasConst = false;
+        bool computed = false;
+        getConeInfo(tm, eqc, hasConst, computed, false);
+        if (!hasConst)
+        {
+          d_coneUnassigned.insert(eqc);
+          eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, ee);
+          for (; !eqc_i.isFinished(); ++eqc_i)
+          {
+            terms.push_back(*eqc_i);
+          }
+          eeTerms.insert(eeTerms.end(), terms.begin(), terms.end());
+          if (typesAdded.insert(tn).second)
+          {
+            computeConeIndex(tm);
+            const std::vector<Node>& eqcs = d_eqcFixed[tn];
+            toVisit.insert(toVisit.end(), eqcs.begin(), eqcs.end());
+          }
+        }
+      }
+      else
+      {
+        // the value of a term that is not in the model is computed from its
+        // subterms
+        terms.push_back(cur);
+        nonEeTerms.push_back(cur);
+      }
+      for (TNode n : terms)
+      {
+        for (TNode nc : n)
+        {
+          toVisit.push_back(nc);
+        }
+        if (n.getKind() == Kind::APPLY_UF)
+        {
+          toVisit.push_back(n.getOperator());
+        }
+      }
+      // the value of a function is determined by all of its applications
+      if (tn.isFunction())
+      {
+        computeConeIndex(tm);
+        std::unordered_map<Node, std::vector<Node>>::iterator itu =
+            d_ufApps.find(cur);
+        if (itu != d_ufApps.end())
+        {
+          toVisit.insert(
+              toVisit.end(), itu->second.begin(), itu->second.end());
+        }
+      }
+    }
+    // Add the assignable subterms of the terms in the cone to the model, as
+    // done in buildModel. This creates new equivalence classes, which we add
+    // to the cone.
+    for (TNode n : eeTerms)
+    {
+      addAssignableSubterms(n, tm, assignableCache);
+    }
+    for (TNode n : nonEeTerms)
+    {
+      if (ee->hasTerm(n))
+      {
+        visited.erase(n);
+        toVisit.push_back(n);
+      }
+    }
+  }
+  // Adding terms may have merged equivalence classes by congruence, hence we
+  // update the cone to the current representatives.
+  std::vector<Node> coneList;
+  coneList.swap(d_coneList);
+  NodeSet coneUnassigned;
+  coneUnassigned.swap(d_coneUnassigned);
+  d_cone.clear();
+  for (const Node& eqc : coneList)
+  {
+    Node r = ee->getRepresentative(eqc);
+    if (d_cone.insert(r).second)
+    {
+      d_coneList.push_back(r);
+    }
+    if (coneUnassigned.find(eqc) != coneUnassigned.end())
+    {
+      d_coneUnassigned.insert(r);
+    }
+  }
+  Trace("model-builder") << "Partial model with " << d_cone.size()
+                         << " equivalence classes" << std::endl;
+  return true;
+}
+
 void TheoryEngineModelBuilder::assignConstantRep(TheoryModel* tm,
                                                  Node eqc,
                                                  Node constRep)
@@ -449,15 +659,60 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
   // Loop through equivalence classes of the equality engine of the model.
   eq::EqualityEngine* ee = tm->d_equalityEngine;
   NodeSet assignableCache;
+  // Determine whether we build a partial model, and if so, its equivalence
+  // classes.
+  bool partialRequested = !d_partialTerms.empty() || !d_partialTypes.empty();
+  d_partial = partialRequested && !tm->hasAssignmentExclusionSets()
+              && !options().quantifiers.finiteModelFind
+              && !logicInfo().isHigherOrder();
+  d_needsAllTheories = false;
+  d_cone.clear();
+  d_coneList.clear();
+  d_coneUnassigned.clear();
+  d_coneIndexed = false;
+  d_eqcByType.clear();
+  d_eqcFixed.clear();
+  d_ufApps.clear();
+  d_partialAssignments.clear();
+  if (d_partial)
+  {
+    d_needsAllTheories = !computeCone(tm, assignableCache);
+  }
+  else if (partialRequested)
+  {
+    // we build the full model, which requires the information of all theories
+    d_needsAllTheories = !d_partialTheories.empty();
+  }
+  if (d_needsAllTheories)
+  {
+    Trace("model-builder") << "TheoryEngineModelBuilder: requires the model "
+                              "information of all theories."
+                           << std::endl;
+    return false;
+  }
+  // The equivalence classes we assign values to, which are all equivalence
+  // classes of the equality engine of the model unless we build a partial
+  // model.
+  std::vector<Node> eqcs;
+  if (d_partial)
+  {
+    eqcs = d_coneList;
+  }
+  else
+  {
+    eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(ee);
+    for (; !eqcs_i.isFinished(); ++eqcs_i)
+    {
+      eqcs.push_back(*eqcs_i);
+    }
+  }
   std::map<Node, Node>::iterator itm;
-  eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(ee);
   // should we compute assigner objects?
   bool computeAssigners = tm->hasAssignmentExclusionSets();
   // the set of exclusion sets we have processed
   std::unordered_set<Node> processedExcSet;
-  for (; !eqcs_i.isFinished(); ++eqcs_i)
+  for (const Node& eqc : eqcs)
   {
-    Node eqc = *eqcs_i;
     Trace("model-builder") << "  Processing EQC " << eqc << std::endl;
     // Information computed for each equivalence class
 
@@ -501,8 +756,12 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
 
       // (1) Add assignable subterms, which ensures that e.g. models for
       // uninterpreted functions take into account all subterms in the
-      // equality engine of the model
-      addAssignableSubterms(n, tm, assignableCache);
+      // equality engine of the model. For partial models, this was done when
+      // computing the cone.
+      if (!d_partial)
+      {
+        addAssignableSubterms(n, tm, assignableCache);
+      }
       // model-specific processing of the term
       tm->addTermInternal(n);
 
@@ -1158,6 +1417,19 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
     }
   }
 
+  if (d_partial)
+  {
+    // remember the values we assigned, see getPartialModelAssignments
+    for (const Node& eqc : d_coneUnassigned)
+    {
+      itMap = d_constantReps.find(eqc);
+      if (itMap != d_constantReps.end() && itMap->second.isConst())
+      {
+        d_partialAssignments.emplace_back(eqc, itMap->second);
+      }
+    }
+  }
+
   // modelBuilder-specific initialization
   if (!processBuildModel(tm))
   {
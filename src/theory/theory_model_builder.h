@@ -15,10 +15,12 @@
 #ifndef CVC5__THEORY__THEORY_MODEL_BUILDER_H
 #define CVC5__THEORY__THEORY_MODEL_BUILDER_H
 
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "smt/env_obj.h"
+#include "theory/theory_id.h"
 #include "theory/theory_model.h"
 
 namespace cvc5::internal {
@@ -85,6 +87,47 @@ class TheoryEngineModelBuilder : protected EnvObj
    */
   void postProcessModel(bool incomplete, TheoryModel* m);
 
+  /**
+   * Restrict the subsequent calls to buildModel to building a partial model.
+   * A partial model only assigns values to the equivalence classes that the
+   * values of the given terms and the domain elements of the given types
+   * depend on (see computeCone). All other equivalence classes are not
+   * assigned a value. Calling this method with empty vectors restores
+   * building full models.
+   *
+   * Partial models are not built if the model has assignment exclusion sets,
+   * if finite model finding is enabled or if the logic is higher-order. In
+   * these cases buildModel builds the full model.
+   *
+   * @param terms The terms whose values are requested.
+   * @param types The types whose domain elements are requested.
+   * @param theories The theories that collected model information, or empty
+   * if all theories did. If the cone contains a term whose type belongs to
+   * another theory, or a full model must be built, buildModel fails and
+   * needsAllTheories returns true.
+   */
+  void setPartialModelTerms(const std::vector<Node>& terms,
+                            const std::vector<TypeNode>& types,
+                            const std::set<TheoryId>& theories);
+  /**
+   * Did the last call to buildModel fail since it requires the model
+   * information of the theories that were not given to setPartialModelTerms?
+   */
+  bool needsAllTheories() const { return d_needsAllTheories; }
+  /** Did the last call to buildModel build a partial model? */
+  bool isPartialModel() const { return d_partial; }
+  /**
+   * Get the values that the last call to buildModel assigned to equivalence
+   * classes that did not contain a constant, as pairs of a term and its
+   * value. This is only computed for partial models. Models built later for
+   * the same assertions should preserve these values, so that the values of
+   * the terms given to the user remain consistent.
+   */
+  const std::vector<std::pair<Node, Node>>& getPartialModelAssignments() const
+  {
+    return d_partialAssignments;
+  }
+
  protected:
   //-----------------------------------virtual functions
   /** pre-process build model
@@ -164,6 +207,48 @@ class TheoryEngineModelBuilder : protected EnvObj
   void addToTypeList(TypeNode tn,
                      std::vector<TypeNode>& type_list,
                      std::unordered_set<TypeNode>& visiting);
+  /** compute cone
+   *
+   * Computes d_cone, the equivalence classes of tm that must be assigned
+   * values in a partial model for d_partialTerms and d_partialTypes. This is
+   * the closure of the equivalence classes of these terms and of all
+   * equivalence classes of these types under the following rules:
+   * - if an equivalence class that does not contain a constant is in the
+   *   cone, so are the equivalence classes of the subterms of its terms, and
+   *   all equivalence classes of the same type that contain a constant or
+   *   whose value is computed from other terms (by evaluation or
+   *   normalization of their asserted representative), since fresh values
+   *   assigned to the former must be distinct from the values of the latter,
+   * - if an uninterpreted function f is in the cone, so are all applications
+   *   of f, which determine the value of f.
+   * The value of an equivalence class that contains a constant is that
+   * constant, hence we do not consider the subterms of its terms. The value
+   * of a term that is not in the equality engine of tm is computed from its
+   * subterms, which are in the cone.
+   *
+   * This also adds the assignable subterms of the terms in the cone to the
+   * equality engine of tm, using the given cache.
+   *
+   * @return false if the cone contains a term whose type belongs to a theory
+   * not in d_partialTheories.
+   */
+  bool computeCone(TheoryModel* tm, NodeSet& assignableCache);
+  /**
+   * Computes d_eqcByType, d_eqcFixed and d_ufApps for the equivalence classes
+   * of tm, if not already done for this model.
+   */
+  void computeConeIndex(TheoryModel* tm);
+  /**
+   * Set hasConst to true if the equivalence class eqc of tm contains a
+   * constant and computed to true if its value is computed from other terms.
+   * Adds the applications of uninterpreted functions in eqc to d_ufApps if
+   * addUfApps is true.
+   */
+  void getConeInfo(TheoryModel* tm,
+                   Node eqc,
+                   bool& hasConst,
+                   bool& computed,
+                   bool addUfApps);
 
  private:
   /** normalized cache
@@ -174,6 +259,38 @@ class TheoryEngineModelBuilder : protected EnvObj
   /** mapping from terms to the constant associated with their equivalence class
    */
   std::map<Node, Node> d_constantReps;
+  /** The terms to build a partial model for, see setPartialModelTerms */
+  std::vector<Node> d_partialTerms;
+  /** The types to build a partial model for, see setPartialModelTerms */
+  std::vector<TypeNode> d_partialTypes;
+  /** The theories that collected model information, see setPartialModelTerms */
+  std::set<TheoryId> d_partialTheories;
+  /** Whether the current (or last) model is partial */
+  bool d_partial;
+  /** Whether the last call to buildModel failed, see needsAllTheories */
+  bool d_needsAllTheories;
+  /** The equivalence classes of the partial model, see computeCone */
+  NodeSet d_cone;
+  /** The elements of d_cone, in the order they were added */
+  std::vector<Node> d_coneList;
+  /**
+   * The equivalence classes in d_cone that do not contain a constant before
+   * the model is built.
+   */
+  NodeSet d_coneUnassigned;
+  /** Whether we computed the index below, see computeConeIndex */
+  bool d_coneIndexed;
+  /** The equivalence classes of each type */
+  std::map<TypeNode, std::vector<Node>> d_eqcByType;
+  /**
+   * The equivalence classes of each type that contain a constant, or whose
+   * value is computed from other terms.
+   */
+  std::map<TypeNode, std::vector<Node>> d_eqcFixed;
+  /** The applications of each uninterpreted function */
+  std::unordered_map<Node, std::vector<Node>> d_ufApps;
+  /** The values assigned to d_coneUnassigned by the last partial model */
+  std::vector<std::pair<Node, Node>> d_partialAssignments;
 
   /** Theory engine model builder assigner class
    *
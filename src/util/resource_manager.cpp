@@ -72,6 +72,7 @@ const char* toString(Resource r)
     case Resource::ArithPivotStep: return "ArithPivotStep";
     case Resource::ArithNlCoveringStep: return "ArithNlCoveringStep";
     case Resource::ArithNlLemmaStep: return "ArithNlLemmaStep";
+    case Resource::ArithNlLocalSearchStep: return "ArithNlLocalSearchStep";
     case Resource::BitblastStep: return "BitblastStep";
     case Resource::BvSatStep: return "BvSatStep";
     case Resource::CnfStep: return "CnfStep";
@@ -72,6 +72,7 @@ enum class Resource
   ArithPivotStep,
   ArithNlCoveringStep,
   ArithNlLemmaStep,
+  ArithNlLocalSearchStep,
   BitblastStep,
   BvSatStep,
   CnfStep,
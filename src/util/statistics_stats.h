@@ -89,6 +89,14 @@ class HistogramStat
     }
     return *this;
   }
+  /** Add `count` occurrences of the value `val` to the histogram */
+  void add(Integral val, uint64_t count)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      d_data->add(val, count);
+    }
+  }
   /** Get the current value for key `val` */
   uint64_t getValue(Integral val) { return d_data->getValue(val); }
 
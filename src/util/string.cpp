@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <sstream>
@@ -28,6 +29,34 @@ namespace cvc5::internal {
 
 static_assert(UCHAR_MAX == 255, "Unsigned char is assumed to have 256 values.");
 
+/**
+ * The minimal length of a pattern and of a text such that find and rfind use
+ * a Boyer-Moore-Horspool search, which skips over the text but builds a table
+ * for the pattern first.
+ */
+static const size_t s_searcherMinPatternSize = 4;
+static const size_t s_searcherMinTextSize = 256;
+
+/**
+ * Returns the position of the first occurrence of [pbegin, pend) in
+ * [begin, end), or end if there is none.
+ */
+template <typename Iterator>
+static Iterator searchCodePoints(Iterator begin,
+                                 Iterator end,
+                                 Iterator pbegin,
+                                 Iterator pend)
+{
+  size_t psize = static_cast<size_t>(pend - pbegin);
+  if (psize >= s_searcherMinPatternSize
+      && static_cast<size_t>(end - begin) >= s_searcherMinTextSize)
+  {
+    return std::search(
+        begin, end, std::boyer_moore_horspool_searcher(pbegin, pend));
+  }
+  return std::search(begin, end, pbegin, pend);
+}
+
 String::String(const std::wstring& s)
 {
   d_str.resize(s.size());
@@ -66,21 +95,22 @@ int String::cmp(const String& y) const
   {
     return size() < y.size() ? -1 : 1;
   }
-  for (unsigned int i = 0; i < size(); ++i)
+  // std::equal compares vectors of integers with memcmp
+  if (std::equal(d_str.begin(), d_str.end(), y.d_str.begin()))
   {
-    if (d_str[i] != y.d_str[i])
-    {
-      unsigned cp = d_str[i];
-      unsigned cpy = y.d_str[i];
-      return cp < cpy ? -1 : 1;
-    }
+    return 0;
   }
-  return 0;
+  std::pair<std::vector<unsigned>::const_iterator,
+            std::vector<unsigned>::const_iterator>
+      diff = std::mismatch(d_str.begin(), d_str.end(), y.d_str.begin());
+  return *diff.first < *diff.second ? -1 : 1;
 }
 
 String String::concat(const String& other) const
 {
-  std::vector<unsigned int> ret_vec(d_str);
+  std::vector<unsigned int> ret_vec;
+  ret_vec.reserve(size() + other.size());
+  ret_vec.insert(ret_vec.end(), d_str.begin(), d_str.end());
   ret_vec.insert(ret_vec.end(), other.d_str.begin(), other.d_str.end());
   return String(ret_vec);
 }
@@ -100,11 +130,7 @@ bool String::strncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i)
-  {
-    if (d_str[i] != y.d_str[i]) return false;
-  }
-  return true;
+  return std::equal(d_str.begin(), d_str.begin() + n, y.d_str.begin());
 }
 
 bool String::rstrncmp(const String& y, std::size_t n) const
@@ -122,11 +148,7 @@ bool String::rstrncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i)
-  {
-    if (d_str[size() - i - 1] != y.d_str[y.size() - i - 1]) return false;
-  }
-  return true;
+  return std::equal(d_str.end() - n, d_str.end(), y.d_str.end() - n);
 }
 
 void String::addCharToInternal(unsigned char ch, std::vector<unsigned>& str)
@@ -288,9 +310,7 @@ std::size_t String::overlap(const String& y) const
   std::size_t i = size() < y.size() ? size() : y.size();
   for (; i > 0; i--)
   {
-    String s = suffix(i);
-    String p = y.prefix(i);
-    if (s == p)
+    if (std::equal(d_str.end() - i, d_str.end(), y.d_str.begin()))
     {
       return i;
     }
@@ -300,17 +320,7 @@ std::size_t String::overlap(const String& y) const
 
 std::size_t String::roverlap(const String& y) const
 {
-  std::size_t i = size() < y.size() ? size() : y.size();
-  for (; i > 0; i--)
-  {
-    String s = prefix(i);
-    String p = y.suffix(i);
-    if (s == p)
-    {
-      return i;
-    }
-  }
-  return i;
+  return y.overlap(*this);
 }
 
 std::string String::toString(bool useEscSequences) const
@@ -414,8 +424,8 @@ std::size_t String::find(const String& y, const std::size_t start) const
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_iterator itr = std::search(
-      d_str.begin() + start, d_str.end(), y.d_str.begin(), y.d_str.end());
+  std::vector<unsigned>::const_iterator itr = searchCodePoints(
+      d_str.cbegin() + start, d_str.cend(), y.d_str.cbegin(), y.d_str.cend());
   if (itr != d_str.end())
   {
     return itr - d_str.begin();
@@ -429,8 +439,11 @@ std::size_t String::rfind(const String& y, const std::size_t start) const
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_reverse_iterator itr = std::search(
-      d_str.rbegin() + start, d_str.rend(), y.d_str.rbegin(), y.d_str.rend());
+  std::vector<unsigned>::const_reverse_iterator itr =
+      searchCodePoints(d_str.crbegin() + start,
+                       d_str.crend(),
+                       y.d_str.crbegin(),
+                       y.d_str.crend());
   if (itr != d_str.rend())
   {
     return itr - d_str.rbegin();
@@ -446,14 +459,7 @@ bool String::hasPrefix(const String& y) const
   {
     return false;
   }
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return std::equal(y.d_str.begin(), y.d_str.end(), d_str.begin());
 }
 
 bool String::hasSuffix(const String& y) const
@@ -464,15 +470,7 @@ bool String::hasSuffix(const String& y) const
   {
     return false;
   }
-  size_t idiff = s - ys;
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i + idiff] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return std::equal(y.d_str.begin(), y.d_str.end(), d_str.end() - ys);
 }
 
 String String::update(std::size_t i, const String& t) const
@@ -516,18 +514,14 @@ String String::replace(const String& s, const String& t) const
 String String::substr(std::size_t i) const
 {
   Assert(i <= size());
-  std::vector<unsigned> ret_vec;
-  std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, d_str.end());
+  std::vector<unsigned> ret_vec(d_str.begin() + i, d_str.end());
   return String(ret_vec);
 }
 
 String String::substr(std::size_t i, std::size_t j) const
 {
   Assert(i + j <= size());
-  std::vector<unsigned> ret_vec;
-  std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, itr + j);
+  std::vector<unsigned> ret_vec(d_str.begin() + i, d_str.begin() + i + j);
   return String(ret_vec);
 }
 
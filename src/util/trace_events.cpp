@@ -0,0 +1,271 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Recording of timestamped events in the Chrome trace event format.
+ */
+
+#include "util/trace_events.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <ostream>
+
+#include "base/output.h"
+
+namespace cvc5::internal {
+
+namespace {
+
+/** Writes to an output stream */
+class StreamSink
+{
+ public:
+  StreamSink(std::ostream& os) : d_os(os) {}
+  void put(char c) { d_os << c; }
+  void put(const char* s) { d_os << s; }
+  void putUInt(uint64_t n) { d_os << n; }
+
+ private:
+  std::ostream& d_os;
+};
+
+/**
+ * Writes to a file descriptor through a fixed buffer. Does not allocate
+ * memory, and is hence safe to use in a signal handler.
+ */
+class FdSink
+{
+ public:
+  FdSink(int fd) : d_fd(fd), d_size(0) {}
+  ~FdSink() { flush(); }
+  void put(char c)
+  {
+    if (d_size == sizeof(d_buf))
+    {
+      flush();
+    }
+    d_buf[d_size++] = c;
+  }
+  void put(const char* s)
+  {
+    for (; *s != '\0'; ++s)
+    {
+      put(*s);
+    }
+  }
+  void putUInt(uint64_t n)
+  {
+    char digits[20];
+    size_t i = 0;
+    do
+    {
+      digits[i++] = static_cast<char>('0' + n % 10);
+      n /= 10;
+    } while (n > 0);
+    while (i > 0)
+    {
+      put(digits[--i]);
+    }
+  }
+
+ private:
+  void flush()
+  {
+    size_t written = 0;
+    while (written < d_size)
+    {
+      ssize_t n = ::write(d_fd, d_buf + written, d_size - written);
+      if (n <= 0)
+      {
+        break;
+      }
+      written += static_cast<size_t>(n);
+    }
+    d_size = 0;
+  }
+  int d_fd;
+  char d_buf[4096];
+  size_t d_size;
+};
+
+/** Write s as a JSON string to out */
+template <typename Sink>
+void writeJsonString(Sink& out, const char* s)
+{
+  static const char* hex = "0123456789abcdef";
+  out.put('"');
+  for (; *s != '\0'; ++s)
+  {
+    char c = *s;
+    if (c == '"' || c == '\\')
+    {
+      out.put('\\');
+      out.put(c);
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      out.put("\\u00");
+      out.put(hex[(c >> 4) & 0xf]);
+      out.put(hex[c & 0xf]);
+    }
+    else
+    {
+      out.put(c);
+    }
+  }
+  out.put('"');
+}
+
+/** Write the nanoseconds ns as microseconds to out */
+template <typename Sink>
+void writeMicros(Sink& out, uint64_t ns)
+{
+  out.putUInt(ns / 1000);
+  out.put('.');
+  uint64_t frac = ns % 1000;
+  out.put(static_cast<char>('0' + frac / 100));
+  out.put(static_cast<char>('0' + frac / 10 % 10));
+  out.put(static_cast<char>('0' + frac % 10));
+}
+
+}  // namespace
+
+TraceEventRecorder::TraceEventRecorder(const std::string& filename,
+                                       uint64_t capacity)
+    : d_filename(filename),
+      d_capacity(capacity == 0 ? 1 : capacity),
+      d_next(0),
+      d_dropped(0),
+      d_origin(std::chrono::steady_clock::now())
+{
+}
+
+TraceEventRecorder::~TraceEventRecorder() { flush(); }
+
+void TraceEventRecorder::flush() const
+{
+  std::ofstream out(d_filename);
+  if (!out)
+  {
+    Warning() << "Could not open " << d_filename
+              << " for writing the trace events" << std::endl;
+    return;
+  }
+  write(out);
+}
+
+void TraceEventRecorder::flushSafe() const
+{
+  int fd = ::open(d_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return;
+  }
+  {
+    FdSink out(fd);
+    writeTo(out);
+  }
+  ::close(fd);
+}
+
+uint64_t TraceEventRecorder::now() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - d_origin)
+      .count();
+}
+
+void TraceEventRecorder::complete(const char* cat,
+                                  const char* name,
+                                  uint64_t start,
+                                  const char* argKey,
+                                  const char* argValue)
+{
+  record({cat, name, argKey, argValue, start, now() - start, 'X'});
+}
+
+void TraceEventRecorder::instant(const char* cat,
+                                 const char* name,
+                                 const char* argKey,
+                                 const char* argValue)
+{
+  record({cat, name, argKey, argValue, now(), 0, 'i'});
+}
+
+const char* TraceEventRecorder::intern(const std::string& s)
+{
+  return d_strings.insert(s).first->c_str();
+}
+
+void TraceEventRecorder::record(const Event& e)
+{
+  if (d_events.size() < d_capacity)
+  {
+    d_events.push_back(e);
+    return;
+  }
+  d_events[d_next] = e;
+  d_next = (d_next + 1) % d_capacity;
+  ++d_dropped;
+}
+
+void TraceEventRecorder::write(std::ostream& os) const
+{
+  StreamSink out(os);
+  writeTo(out);
+  os << std::flush;
+}
+
+template <typename Sink>
+void TraceEventRecorder::writeTo(Sink& out) const
+{
+  out.put("{\"traceEvents\":[");
+  for (size_t i = 0, n = d_events.size(); i < n; ++i)
+  {
+    // start with the oldest event
+    const Event& e = d_events[(d_next + i) % n];
+    out.put(i == 0 ? "\n" : ",\n");
+    out.put("{\"name\":");
+    writeJsonString(out, e.d_name);
+    out.put(",\"cat\":");
+    writeJsonString(out, e.d_cat);
+    out.put(",\"ph\":\"");
+    out.put(e.d_phase);
+    out.put("\",\"ts\":");
+    writeMicros(out, e.d_start);
+    if (e.d_phase == 'X')
+    {
+      out.put(",\"dur\":");
+      writeMicros(out, e.d_dur);
+    }
+    else
+    {
+      // thread-scoped instant event
+      out.put(",\"s\":\"t\"");
+    }
+    out.put(",\"pid\":1,\"tid\":1");
+    if (e.d_argKey != nullptr)
+    {
+      out.put(",\"args\":{");
+      writeJsonString(out, e.d_argKey);
+      out.put(':');
+      writeJsonString(out, e.d_argValue);
+      out.put('}');
+    }
+    out.put('}');
+  }
+  out.put("\n],\"displayTimeUnit\":\"ms\",");
+  out.put("\"otherData\":{\"droppedEvents\":");
+  out.putUInt(d_dropped);
+  out.put("}}\n");
+}
+
+}  // namespace cvc5::internal
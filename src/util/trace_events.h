@@ -0,0 +1,165 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Recording of timestamped events in the Chrome trace event format.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__UTIL__TRACE_EVENTS_H
+#define CVC5__UTIL__TRACE_EVENTS_H
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace cvc5::internal {
+
+/**
+ * Records timestamped events (e.g. the application of a preprocessing pass or
+ * a theory check) and writes them in the Chrome trace event format, which can
+ * be viewed with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Events are kept in a ring buffer of fixed capacity, i.e. once the buffer is
+ * full, each new event overwrites the oldest one. Hence, the trace always
+ * covers the end of the run, which is what matters when diagnosing timeouts.
+ *
+ * The names, categories and arguments of events are not copied and must
+ * outlive the recorder. Names that are not string literals can be made
+ * persistent with intern().
+ *
+ * The trace is written to the given file by flush(), which overwrites the
+ * previously written trace, and when the recorder is destroyed. Since the
+ * destructor does not run if the process is terminated, e.g. on a timeout,
+ * flushSafe() can be used in signal handlers.
+ */
+class TraceEventRecorder
+{
+ public:
+  /**
+   * @param filename The file to write the trace to.
+   * @param capacity The maximal number of events that are kept.
+   */
+  TraceEventRecorder(const std::string& filename, uint64_t capacity);
+  ~TraceEventRecorder();
+  /** Get the current timestamp, in nanoseconds since the construction. */
+  uint64_t now() const;
+  /**
+   * Record an event that started at time `start` and ends now.
+   *
+   * @param cat The category of the event.
+   * @param name The name of the event.
+   * @param start The start time, as returned by now().
+   * @param argKey The name of an argument of the event, or nullptr.
+   * @param argValue The value of the argument.
+   */
+  void complete(const char* cat,
+                const char* name,
+                uint64_t start,
+                const char* argKey = nullptr,
+                const char* argValue = nullptr);
+  /** Record an event without duration that happens now. */
+  void instant(const char* cat,
+               const char* name,
+               const char* argKey = nullptr,
+               const char* argValue = nullptr);
+  /** Get a persistent copy of the string s. */
+  const char* intern(const std::string& s);
+  /** Write the recorded events in the Chrome trace event format to os. */
+  void write(std::ostream& os) const;
+  /** Write the recorded events to the file. */
+  void flush() const;
+  /**
+   * Same as flush(), but does not allocate memory and is hence safe to use in
+   * a signal handler.
+   */
+  void flushSafe() const;
+
+ private:
+  /** A recorded event */
+  struct Event
+  {
+    const char* d_cat;
+    const char* d_name;
+    const char* d_argKey;
+    const char* d_argValue;
+    /** The start time, in nanoseconds */
+    uint64_t d_start;
+    /** The duration, in nanoseconds */
+    uint64_t d_dur;
+    /** The phase, 'X' for complete events and 'i' for instant events */
+    char d_phase;
+  };
+  /** Add e to the ring buffer */
+  void record(const Event& e);
+  /** Write the recorded events to out, which is a sink of trace_events.cpp */
+  template <typename Sink>
+  void writeTo(Sink& out) const;
+  /** The file to write to */
+  std::string d_filename;
+  /** The maximal number of events */
+  uint64_t d_capacity;
+  /** The events, where the oldest one is at index d_next once full */
+  std::vector<Event> d_events;
+  /** The index of the next event to overwrite */
+  uint64_t d_next;
+  /** The number of overwritten events */
+  uint64_t d_dropped;
+  /** The interned strings */
+  std::unordered_set<std::string> d_strings;
+  /** The time of construction */
+  std::chrono::steady_clock::time_point d_origin;
+};
+
+/**
+ * RAII class recording a complete event spanning its lifetime. Does nothing
+ * if the given recorder is null, i.e. if tracing is disabled.
+ */
+class TraceEventScope
+{
+ public:
+  TraceEventScope(TraceEventRecorder* rec,
+                  const char* cat,
+                  const char* name,
+                  const char* argKey = nullptr,
+                  const char* argValue = nullptr)
+      : d_rec(rec), d_cat(cat), d_name(name), d_argKey(argKey),
+        d_argValue(argValue), d_start(rec == nullptr ? 0 : rec->now())
+  {
+  }
+  /** Same as above, for a name that is interned if tracing is enabled. */
+  TraceEventScope(TraceEventRecorder* rec,
+                  const char* cat,
+                  const std::string& name)
+      : TraceEventScope(rec, cat, rec == nullptr ? nullptr : rec->intern(name))
+  {
+  }
+  ~TraceEventScope()
+  {
+    if (d_rec != nullptr)
+    {
+      d_rec->complete(d_cat, d_name, d_start, d_argKey, d_argValue);
+    }
+  }
+
+ private:
+  TraceEventRecorder* d_rec;
+  const char* d_cat;
+  const char* d_name;
+  const char* d_argKey;
+  const char* d_argValue;
+  uint64_t d_start;
+};
+
+}  // namespace cvc5::internal
+
+#endif /* CVC5__UTIL__TRACE_EVENTS_H */
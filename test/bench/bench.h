@@ -0,0 +1,125 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Harness for the micro-benchmarks.
+ */
+
+#ifndef CVC5__TEST__BENCH__BENCH_H
+#define CVC5__TEST__BENCH__BENCH_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cvc5::internal {
+namespace bench {
+
+/**
+ * The state of a benchmark run. A benchmark performs its setup, and then
+ * runs the measured operation in a loop of the form
+ *
+ *   while (state.keepRunning()) { ... }
+ *
+ * Only the time spent in the loop is measured. The number of iterations is
+ * fixed at registration (and scaled by --scale), so that results are
+ * repeatable and comparable between commits.
+ */
+class State
+{
+ public:
+  State(uint64_t iterations) : d_iterations(iterations), d_done(0) {}
+  /** Returns true while there are iterations left to run. */
+  bool keepRunning()
+  {
+    if (d_done == 0)
+    {
+      d_start = Clock::now();
+    }
+    if (d_done < d_iterations)
+    {
+      ++d_done;
+      return true;
+    }
+    d_end = Clock::now();
+    return false;
+  }
+  /** The number of iterations */
+  uint64_t iterations() const { return d_iterations; }
+  /** The time spent in the loop, in nanoseconds */
+  uint64_t elapsed() const
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d_end
+                                                                - d_start)
+        .count();
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  uint64_t d_iterations;
+  uint64_t d_done;
+  Clock::time_point d_start;
+  Clock::time_point d_end;
+};
+
+/** A benchmark function */
+using BenchmarkFunction = void (*)(State&);
+
+/** A registered benchmark */
+struct Benchmark
+{
+  std::string d_name;
+  uint64_t d_iterations;
+  BenchmarkFunction d_fun;
+};
+
+/** Get all registered benchmarks */
+std::vector<Benchmark>& getBenchmarks();
+
+/** Registers a benchmark on construction */
+struct Registration
+{
+  Registration(const char* name, uint64_t iterations, BenchmarkFunction fun)
+  {
+    getBenchmarks().push_back({name, iterations, fun});
+  }
+};
+
+/**
+ * Prevents the compiler from optimizing away the computation of value.
+ */
+template <class T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  // no inline assembly, e.g. with MSVC: escape the address of value through a
+  // volatile store and prevent reordering of memory accesses across the call
+  static const void* volatile sink;
+  sink = &value;
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
+
+/**
+ * Define a benchmark with the given name, which runs the given number of
+ * iterations. The body of the benchmark has access to the State `state`.
+ */
+#define CVC5_BENCHMARK(name, iterations)                               \
+  static void name(::cvc5::internal::bench::State& state);             \
+  static ::cvc5::internal::bench::Registration name##_registration(    \
+      #name, iterations, name);                                        \
+  static void name(::cvc5::internal::bench::State& state)
+
+#endif /* CVC5__TEST__BENCH__BENCH_H */
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for the simplex tableau.
+ */
+
+#include <vector>
+
+#include "bench.h"
+#include "theory/arith/linear/tableau.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+/**
+ * Pivot a dense 50x50 tableau back and forth between a basic and a
+ * non-basic variable.
+ */
+CVC5_BENCHMARK(tableauPivot, 2000)
+{
+  using namespace theory::arith::linear;
+  const ArithVar rows = 50;
+  const ArithVar cols = 50;
+  Tableau tab;
+  for (ArithVar v = 0; v < rows + cols; ++v)
+  {
+    tab.increaseSize();
+  }
+  std::vector<ArithVar> vars;
+  for (ArithVar v = rows; v < rows + cols; ++v)
+  {
+    vars.push_back(v);
+  }
+  for (ArithVar b = 0; b < rows; ++b)
+  {
+    std::vector<Rational> coeffs;
+    for (ArithVar v = 0; v < cols; ++v)
+    {
+      coeffs.push_back(Rational((b + v) % 7 + 1, v % 3 + 1));
+    }
+    tab.addRow(b, coeffs, vars);
+  }
+  NoEffectCCCB cb;
+  ArithVar i = 0;
+  while (state.keepRunning())
+  {
+    ArithVar b = i % rows;
+    ArithVar x = rows + (i * 13) % cols;
+    ++i;
+    tab.pivot(b, x, cb);
+    tab.pivot(x, b, cb);
+  }
+  doNotOptimize(tab.getNumEntriesInTableau());
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
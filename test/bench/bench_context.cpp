@@ -0,0 +1,60 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for context-dependent data structures.
+ */
+
+#include "bench.h"
+#include "context/cdhashmap.h"
+#include "context/context.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+/** Insert into a CDHashMap in a new context level, then pop it. */
+CVC5_BENCHMARK(cdhashmapPushPop, 20000)
+{
+  context::Context ctx;
+  context::CDHashMap<uint64_t, uint64_t> map(&ctx);
+  for (uint64_t i = 0; i < 1000; ++i)
+  {
+    map.insert(i, i);
+  }
+  while (state.keepRunning())
+  {
+    ctx.push();
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+      map.insert(i * 7, i);
+      map.insert(1000 + i, i);
+    }
+    ctx.pop();
+  }
+  doNotOptimize(map.size());
+}
+
+/** Look up keys of a CDHashMap. */
+CVC5_BENCHMARK(cdhashmapFind, 1000000)
+{
+  context::Context ctx;
+  context::CDHashMap<uint64_t, uint64_t> map(&ctx);
+  for (uint64_t i = 0; i < 1000; ++i)
+  {
+    map.insert(i, i);
+  }
+  uint64_t i = 0;
+  while (state.keepRunning())
+  {
+    auto it = map.find(i++ % 2000);
+    doNotOptimize(it);
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
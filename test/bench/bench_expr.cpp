@@ -0,0 +1,85 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for node construction and rewriting.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "bench.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+#include "theory/rewriter.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+/** Construct the same node repeatedly, which hits the node pool. */
+CVC5_BENCHMARK(mkNodeHit, 1000000)
+{
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  Node x = sm->mkDummySkolem("x", nm.integerType());
+  Node y = sm->mkDummySkolem("y", nm.integerType());
+  while (state.keepRunning())
+  {
+    Node n = nm.mkNode(Kind::ADD, x, y);
+    doNotOptimize(n);
+  }
+}
+
+/** Construct distinct nodes, which are inserted into the node pool. */
+CVC5_BENCHMARK(mkNodeMiss, 200000)
+{
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  Node x = sm->mkDummySkolem("x", nm.integerType());
+  std::vector<Node> nodes;
+  nodes.reserve(state.iterations());
+  uint64_t i = 0;
+  while (state.keepRunning())
+  {
+    nodes.push_back(nm.mkNode(Kind::ADD, x, nm.mkConstInt(Rational(++i))));
+  }
+  doNotOptimize(nodes);
+}
+
+/** Rewrite distinct arithmetic terms, so that the rewrite cache misses. */
+CVC5_BENCHMARK(rewriteArith, 50000)
+{
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  theory::Rewriter* rr = slv.getEnv().getRewriter();
+  Node x = sm->mkDummySkolem("x", nm.integerType());
+  Node y = sm->mkDummySkolem("y", nm.integerType());
+  std::vector<Node> terms;
+  for (uint64_t i = 0, n = state.iterations(); i < n; ++i)
+  {
+    Node c = nm.mkConstInt(Rational(i));
+    terms.push_back(nm.mkNode(
+        Kind::GEQ,
+        nm.mkNode(Kind::ADD, nm.mkNode(Kind::MULT, c, x), y, c),
+        nm.mkNode(Kind::SUB, y, x)));
+  }
+  size_t i = 0;
+  while (state.keepRunning())
+  {
+    Node r = rr->rewrite(terms[i++]);
+    doNotOptimize(r);
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
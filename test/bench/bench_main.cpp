@@ -0,0 +1,179 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Driver for the micro-benchmarks.
+ *
+ * Usage: cvc5-bench [--filter=SUBSTRING] [--repetitions=N] [--scale=F]
+ *                   [--out=FILE] [--list]
+ *
+ * Each benchmark is run the given number of times (default 5). A table is
+ * printed to stdout, and if --out is given, one JSON object per benchmark is
+ * written to FILE. Such files can be compared with compare.py.
+ */
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "bench.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+std::vector<Benchmark>& getBenchmarks()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+namespace {
+
+/**
+ * Get the peak resident set size of this process so far, in kilobytes. Since
+ * all benchmarks run in the same process, this is not the memory used by the
+ * last benchmark, but the maximum over it and all benchmarks that ran before
+ * it. Hence, it is only comparable between runs with the same --filter.
+ */
+uint64_t getProcessPeakRssKb()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+/** Get the value of option `--name=value` in arg, or nullptr */
+const char* getOption(const char* arg, const char* name)
+{
+  size_t len = std::strlen(name);
+  if (std::strncmp(arg, name, len) == 0 && arg[len] == '=')
+  {
+    return arg + len + 1;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+int runBenchmarks(int argc, char** argv)
+{
+  std::string filter;
+  uint64_t repetitions = 5;
+  double scale = 1.0;
+  std::string out;
+  bool list = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    const char* val;
+    if ((val = getOption(argv[i], "--filter")) != nullptr)
+    {
+      filter = val;
+    }
+    else if ((val = getOption(argv[i], "--repetitions")) != nullptr)
+    {
+      repetitions = std::max(1L, std::atol(val));
+    }
+    else if ((val = getOption(argv[i], "--scale")) != nullptr)
+    {
+      scale = std::atof(val);
+    }
+    else if ((val = getOption(argv[i], "--out")) != nullptr)
+    {
+      out = val;
+    }
+    else if (std::strcmp(argv[i], "--list") == 0)
+    {
+      list = true;
+    }
+    else
+    {
+      std::cerr << "unknown argument " << argv[i] << std::endl;
+      return 1;
+    }
+  }
+  std::vector<Benchmark> benchmarks = getBenchmarks();
+  std::sort(benchmarks.begin(),
+            benchmarks.end(),
+            [](const Benchmark& a, const Benchmark& b) {
+              return a.d_name < b.d_name;
+            });
+  std::ofstream outFile;
+  if (!out.empty())
+  {
+    outFile.open(out);
+    if (!outFile)
+    {
+      std::cerr << "could not open " << out << std::endl;
+      return 1;
+    }
+  }
+  if (!list)
+  {
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right
+              << std::setw(12) << "iterations" << std::setw(14) << "median ns"
+              << std::setw(14) << "min ns" << std::setw(14) << "max ns"
+              << std::setw(18) << "process peak kb" << std::endl;
+  }
+  for (const Benchmark& b : benchmarks)
+  {
+    if (b.d_name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+    if (list)
+    {
+      std::cout << b.d_name << std::endl;
+      continue;
+    }
+    uint64_t iterations =
+        std::max<uint64_t>(1, static_cast<uint64_t>(b.d_iterations * scale));
+    std::vector<double> times;
+    for (uint64_t r = 0; r < repetitions; ++r)
+    {
+      State state(iterations);
+      b.d_fun(state);
+      times.push_back(static_cast<double>(state.elapsed()) / iterations);
+    }
+    std::sort(times.begin(), times.end());
+    double median = times[times.size() / 2];
+    uint64_t rss = getProcessPeakRssKb();
+    std::cout << std::left << std::setw(40) << b.d_name << std::right
+              << std::setw(12) << iterations << std::fixed
+              << std::setprecision(1) << std::setw(14) << median
+              << std::setw(14) << times.front() << std::setw(14)
+              << times.back() << std::setw(18) << rss << std::endl;
+    if (outFile)
+    {
+      outFile << std::fixed << std::setprecision(1) << "{\"name\": \""
+              << b.d_name << "\", \"iterations\": " << iterations
+              << ", \"repetitions\": " << repetitions
+              << ", \"median_ns\": " << median
+              << ", \"min_ns\": " << times.front()
+              << ", \"max_ns\": " << times.back()
+              << ", \"max_rss_kb\": " << rss << "}" << std::endl;
+    }
+  }
+  return 0;
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
+
+int main(int argc, char** argv)
+{
+  return cvc5::internal::bench::runBenchmarks(argc, argv);
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for the SMT-LIB parser.
+ */
+
+#include <cvc5/cvc5.h>
+#include <cvc5/cvc5_parser.h>
+
+#include <sstream>
+
+#include "bench.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+/**
+ * Parse an SMT-LIB script with 200 assertions of nested arithmetic terms.
+ * This measures the lexer and parser, as well as term construction via the
+ * API.
+ */
+CVC5_BENCHMARK(parseSmt2, 200)
+{
+  std::stringstream ss;
+  ss << "(set-logic QF_LIA)\n";
+  for (size_t i = 0; i < 50; ++i)
+  {
+    ss << "(declare-const x" << i << " Int)\n";
+  }
+  for (size_t i = 0; i < 200; ++i)
+  {
+    ss << "(assert (or (>= (+ x" << i % 50 << " (* " << i << " x"
+       << (i + 1) % 50 << ")) " << i << ") (not (= x" << (i + 2) % 50
+       << " (- x" << (i + 3) % 50 << " 17)))))\n";
+  }
+  std::string input = ss.str();
+  cvc5::TermManager tm;
+  while (state.keepRunning())
+  {
+    cvc5::Solver solver(tm);
+    cvc5::parser::SymbolManager sm(tm);
+    cvc5::parser::InputParser parser(&solver, &sm);
+    parser.setStringInput(
+        cvc5::modes::InputLanguage::SMT_LIB_2_6, input, "bench");
+    std::stringstream out;
+    while (true)
+    {
+      cvc5::parser::Command cmd = parser.nextCommand();
+      if (cmd.isNull())
+      {
+        break;
+      }
+      // declarations only take effect when the command is invoked
+      cmd.invoke(&solver, &sm, out);
+    }
+  }
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
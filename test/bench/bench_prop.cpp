@@ -0,0 +1,111 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for the conversion to CNF.
+ */
+
+#include <vector>
+
+#include "bench.h"
+#include "context/context.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "prop/cnf_stream.h"
+#include "prop/registrar.h"
+#include "prop/sat_solver.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+namespace {
+
+/** A SAT solver that only counts the clauses it is given. */
+class CountingSatSolver : public prop::SatSolver
+{
+ public:
+  CountingSatSolver() : d_nextVar(0), d_clauses(0) {}
+  void initialize() override {}
+  prop::SatVariable newVar(bool, bool) override { return d_nextVar++; }
+  prop::SatVariable trueVar() override { return d_nextVar++; }
+  prop::SatVariable falseVar() override { return d_nextVar++; }
+  ClauseId addClause(const prop::SatClause&, bool) override
+  {
+    ++d_clauses;
+    return ClauseIdUndef;
+  }
+  void interrupt() override {}
+  prop::SatValue solve() override { return prop::SAT_VALUE_UNKNOWN; }
+  prop::SatValue solve(long unsigned int&) override
+  {
+    return prop::SAT_VALUE_UNKNOWN;
+  }
+  prop::SatValue solve(const std::vector<prop::SatLiteral>&) override
+  {
+    return prop::SAT_VALUE_UNKNOWN;
+  }
+  void getUnsatAssumptions(std::vector<prop::SatLiteral>&) override {}
+  prop::SatValue value(prop::SatLiteral) override
+  {
+    return prop::SAT_VALUE_UNKNOWN;
+  }
+  prop::SatValue modelValue(prop::SatLiteral) override
+  {
+    return prop::SAT_VALUE_UNKNOWN;
+  }
+  bool ok() const override { return true; }
+  uint64_t numClauses() const { return d_clauses; }
+
+ private:
+  prop::SatVariable d_nextVar;
+  uint64_t d_clauses;
+};
+
+}  // namespace
+
+/**
+ * Convert distinct formulas with nested Boolean connectives over fresh
+ * atoms to CNF.
+ */
+CVC5_BENCHMARK(cnfConvertAndAssert, 20000)
+{
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  CountingSatSolver sat;
+  prop::NullRegistrar registrar;
+  context::Context ctx;
+  prop::CnfStream cnf(slv.getEnv(), &sat, &registrar, &ctx);
+  std::vector<Node> formulas;
+  for (uint64_t i = 0, n = state.iterations(); i < n; ++i)
+  {
+    std::vector<Node> atoms;
+    for (size_t j = 0; j < 6; ++j)
+    {
+      atoms.push_back(sm->mkDummySkolem("a", nm.booleanType()));
+    }
+    std::vector<Node> conj{
+        nm.mkNode(Kind::OR, atoms[0], atoms[1].notNode(), atoms[2]),
+        nm.mkNode(Kind::EQUAL, atoms[3], atoms[4]),
+        nm.mkNode(Kind::ITE, atoms[5], atoms[0], atoms[3].notNode()),
+        nm.mkNode(Kind::XOR, atoms[1], atoms[4])};
+    formulas.push_back(nm.mkNode(Kind::AND, conj));
+  }
+  size_t i = 0;
+  while (state.keepRunning())
+  {
+    cnf.convertAndAssert(formulas[i++], false, false);
+  }
+  doNotOptimize(sat.numClauses());
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for the equality engine.
+ */
+
+#include <vector>
+
+#include "bench.h"
+#include "context/context.h"
+#include "expr/node_manager.h"
+#include "expr/skolem_manager.h"
+#include "smt/env.h"
+#include "smt/solver_engine.h"
+#include "theory/uf/equality_engine.h"
+
+namespace cvc5::internal {
+namespace bench {
+
+/**
+ * In a new context level, merge a chain of constants, which causes
+ * congruences between applications of a unary function, then pop it.
+ */
+CVC5_BENCHMARK(eqEngineMerge, 2000)
+{
+  NodeManager nm;
+  SkolemManager* sm = nm.getSkolemManager();
+  SolverEngine slv(&nm);
+  slv.finishInit();
+  context::Context ctx;
+  theory::eq::EqualityEngine ee(slv.getEnv(), &ctx, "bench", false);
+  ee.addFunctionKind(Kind::APPLY_UF);
+  TypeNode u = nm.mkSort("U");
+  Node f = sm->mkDummySkolem("f", nm.mkFunctionType(u, u));
+  std::vector<Node> eqs;
+  std::vector<Node> xs;
+  for (size_t i = 0; i < 200; ++i)
+  {
+    Node x = sm->mkDummySkolem("x" + std::to_string(i), u);
+    xs.push_back(x);
+    ee.addTerm(nm.mkNode(Kind::APPLY_UF, f, x));
+  }
+  for (size_t i = 1; i < xs.size(); ++i)
+  {
+    eqs.push_back(xs[i - 1].eqNode(xs[i]));
+  }
+  while (state.keepRunning())
+  {
+    ctx.push();
+    for (const Node& eq : eqs)
+    {
+      ee.assertEquality(eq, true, eq);
+    }
+    ctx.pop();
+  }
+  doNotOptimize(ee.consistent());
+}
+
+}  // namespace bench
+}  // namespace cvc5::internal
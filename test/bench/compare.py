@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+###############################################################################
+# This file is part of the cvc5 project.
+#
+# Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+# in the top-level source directory and their institutional affiliations.
+# All rights reserved.  See the file COPYING in the top-level source
+# directory for licensing information.
+# #############################################################################
+##
+"""
+Compares two benchmark reports written by cvc5-bench or run_macro.py, e.g.,
+of a baseline build and of a build with a change. Exits with a non-zero
+status if a benchmark got slower, or used more memory, by more than the given
+threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def read_report(filename):
+    """Returns a dictionary from benchmark names to their results."""
+    report = {}
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if line:
+                r = json.loads(line)
+                report[r['name']] = r
+    return report
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compares two benchmark reports.')
+    parser.add_argument('--threshold',
+                        type=float,
+                        default=5.0,
+                        help='the allowed slowdown in percent (default: 5)')
+    parser.add_argument('baseline', help='the report of the baseline')
+    parser.add_argument('current', help='the report to compare')
+    args = parser.parse_args()
+
+    baseline = read_report(args.baseline)
+    current = read_report(args.current)
+    regressions = 0
+    print('{:<44}{:>16}{:>16}{:>10}{:>10}'.format('benchmark', 'baseline ns',
+                                                  'current ns', 'time',
+                                                  'memory'))
+    for name in sorted(current):
+        if name not in baseline:
+            print('{:<44}{:>16}{:>16.1f}'.format(name, '-',
+                                                 current[name]['median_ns']))
+            continue
+        b = baseline[name]
+        c = current[name]
+        time_change = 100.0 * (c['median_ns'] / max(b['median_ns'], 1) - 1)
+        mem_change = 100.0 * (c['max_rss_kb'] / max(b['max_rss_kb'], 1) - 1)
+        regressed = (time_change > args.threshold
+                     or mem_change > args.threshold)
+        regressions += 1 if regressed else 0
+        print('{:<44}{:>16.1f}{:>16.1f}{:>+9.1f}%{:>+9.1f}%{}'.format(
+            name, b['median_ns'], c['median_ns'], time_change, mem_change,
+            '  <- regression' if regressed else ''))
+    for name in sorted(set(baseline) - set(current)):
+        print('{:<44}{:>16.1f}{:>16}'.format(name, baseline[name]['median_ns'],
+                                             '-'))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
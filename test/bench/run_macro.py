@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+###############################################################################
+# This file is part of the cvc5 project.
+#
+# Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+# in the top-level source directory and their institutional affiliations.
+# All rights reserved.  See the file COPYING in the top-level source
+# directory for licensing information.
+# #############################################################################
+##
+"""
+Runs the macro-benchmarks listed in a benchmark file (see
+macro/benchmarks.txt) and checks their results, running times and peak memory
+usage against the given budgets. Writes one JSON object per benchmark to the
+output file, in the same format as cvc5-bench.
+"""
+
+import argparse
+import json
+import os
+import shlex
+import subprocess
+import sys
+import threading
+import time
+
+
+def parse_benchmarks(filename):
+    """Returns the list of (file, expected, time, memory, options)."""
+    benchmarks = []
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            fields = shlex.split(line)
+            benchmarks.append((fields[0], fields[1], float(fields[2]),
+                               float(fields[3]), fields[4:]))
+    return benchmarks
+
+
+def run_benchmark(cvc5, benchmark, time_budget, options):
+    """
+    Runs a benchmark and returns the first line of its output, the wall-clock
+    time in seconds and the peak resident set size in kilobytes. Benchmarks
+    that take more than twice their time budget are killed.
+    """
+    start = time.monotonic()
+    proc = subprocess.Popen([cvc5] + options + [benchmark],
+                            stdout=subprocess.PIPE,
+                            stderr=subprocess.DEVNULL)
+    timer = threading.Timer(2 * time_budget, proc.kill)
+    timer.start()
+    out = proc.stdout.read().decode()
+    proc.stdout.close()
+    # wait4 gives the resource usage of this process only
+    _, status, usage = os.wait4(proc.pid, 0)
+    timer.cancel()
+    elapsed = time.monotonic() - start
+    rss = usage.ru_maxrss
+    if sys.platform == 'darwin':
+        rss //= 1024
+    if os.WIFSIGNALED(status):
+        result = 'killed'
+    else:
+        result = out.split('\n')[0] if out else 'error'
+    return result, elapsed, rss
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Runs macro-benchmarks with time and memory budgets.')
+    parser.add_argument('--out', help='write the results to this file')
+    parser.add_argument('--filter',
+                        default='',
+                        help='only run benchmarks whose name contains this')
+    parser.add_argument('cvc5', help='the cvc5 binary')
+    parser.add_argument('benchmarks', help='the file listing the benchmarks')
+    args = parser.parse_args()
+
+    failures = 0
+    results = []
+    print('{:<44}{:>10}{:>12}{:>14}  {}'.format('benchmark', 'result',
+                                                'time (s)', 'max rss kb',
+                                                'status'))
+    for (benchmark, expected, time_budget, mem_budget,
+         options) in parse_benchmarks(args.benchmarks):
+        if args.filter not in benchmark:
+            continue
+        result, elapsed, rss = run_benchmark(args.cvc5, benchmark,
+                                             time_budget, options)
+        status = []
+        if result != expected:
+            status.append('expected ' + expected)
+        if elapsed > time_budget:
+            status.append('over time budget of {}s'.format(time_budget))
+        if rss > mem_budget * 1024:
+            status.append('over memory budget of {}MB'.format(mem_budget))
+        failures += 1 if status else 0
+        print('{:<44}{:>10}{:>12.2f}{:>14}  {}'.format(
+            benchmark, result, elapsed, rss,
+            ', '.join(status) if status else 'ok'))
+        results.append({
+            'name': benchmark,
+            'iterations': 1,
+            'repetitions': 1,
+            'median_ns': round(elapsed * 1e9, 1),
+            'min_ns': round(elapsed * 1e9, 1),
+            'max_ns': round(elapsed * 1e9, 1),
+            'max_rss_kb': rss,
+        })
+    if args.out:
+        with open(args.out, 'w') as f:
+            for r in results:
+                f.write(json.dumps(r) + '\n')
+    return 1 if failures > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,27 @@
+; COMMAND-LINE: --arith-dl --incremental --check-models
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_IDL)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= (- x y) 1))
+(assert (<= (- y z) 1))
+(check-sat)
+(push 1)
+; closes a negative cycle
+(assert (<= (- z x) (- 3)))
+(check-sat)
+(pop 1)
+(check-sat)
+(push 1)
+(assert (= (- z x) (- 2)))
+(check-sat)
+(assert (< (- x y) 1))
+(check-sat)
+(pop 1)
+(check-sat)
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --arith-dl --incremental --check-models
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_RDL)
+(declare-fun a () Real)
+(declare-fun b () Real)
+(declare-fun c () Real)
+(assert (< (- a b) 0))
+(assert (< (- b c) 0))
+(assert (< (- c a) 1))
+(check-sat)
+(assert (<= c a))
+(check-sat)
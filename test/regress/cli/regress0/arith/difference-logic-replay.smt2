@@ -0,0 +1,26 @@
+; COMMAND-LINE: --arith-dl --incremental --check-models
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= (- x y) 2))
+(assert (<= (- y z) 1))
+(check-sat)
+(push 1)
+; not a difference constraint, hence the difference logic solver is
+; deactivated and its facts are replayed to the linear solver
+(assert (>= (+ (- x z) (- y z)) 5))
+(check-sat)
+(pop 1)
+(check-sat)
+(push 1)
+(assert (>= (- x z) 3))
+(check-sat)
+(assert (> (- x z) 3))
+(check-sat)
+(pop 1)
@@ -0,0 +1,14 @@
+; COMMAND-LINE: --arith-dl --incremental --check-models
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_IDL)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= (- x y) 2))
+(assert (<= (- y z) (- 3)))
+(assert (>= (- x z) (- 2)))
+(assert (distinct (- x z) (- 1)))
+(check-sat)
+(assert (> (- x z) (- 2)))
+(check-sat)
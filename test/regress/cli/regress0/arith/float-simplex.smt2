@@ -0,0 +1,15 @@
+; COMMAND-LINE: --arith-float-simplex --incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (>= (+ x y) 2))
+(assert (<= (- x y) 1))
+(assert (<= (+ (* 2 x) (* 3 z)) 5))
+(assert (>= (+ y z) 1.5))
+(assert (>= x 0.5))
+(check-sat)
+(assert (< (+ x y z) 2))
+(check-sat)
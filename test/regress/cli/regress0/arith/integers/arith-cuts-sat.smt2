@@ -0,0 +1,12 @@
+; COMMAND-LINE: --arith-cuts
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (= (+ (* 4 x) y) 1))
+(assert (>= y 0))
+(assert (<= y 4))
+(assert (>= (+ (* 3 z) (* 2 y)) 1))
+(assert (<= (+ (* 3 z) (* 2 y)) 2))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --arith-cuts
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (>= x 1))
+(assert (>= y 1))
+(assert (>= (+ (* 4 x) (* 6 y)) 11))
+(assert (<= (+ (* 4 x) (* 6 y)) 13))
+(check-sat)
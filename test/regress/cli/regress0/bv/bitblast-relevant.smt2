@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental --bv-solver=bitblast-internal --bv-bitblast-relevant
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun c () Bool)
+(assert (ite c (bvult x y) (= (bvmul x y) #x07)))
+(assert (=> c (bvult y x)))
+(check-sat)
+(push 1)
+(assert (= (bvand x #x01) #x00))
+(check-sat)
+(pop 1)
+(assert (bvugt x #x01))
+(check-sat)
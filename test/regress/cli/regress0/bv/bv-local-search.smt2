@@ -0,0 +1,20 @@
+; COMMAND-LINE: --incremental --bv-local-search
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun z () (_ BitVec 8))
+(assert (= (bvadd x y) #xc8))
+(assert (bvult x y))
+(assert (= (bvmul x #x03) #x09))
+(check-sat)
+(push 1)
+(assert (bvult y x))
+(check-sat)
+(pop 1)
+(assert (= ((_ extract 3 0) z) #x5))
+(assert (bvslt z #x00))
+(assert (not (= z (bvor x y))))
+(check-sat)
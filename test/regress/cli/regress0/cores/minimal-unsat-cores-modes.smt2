@@ -0,0 +1,20 @@
+; COMMAND-LINE: --minimal-unsat-cores --minimal-unsat-cores-mode=quickxplain
+; COMMAND-LINE: --minimal-unsat-cores --minimal-unsat-cores-mode=deletion
+; COMMAND-LINE: --minimal-unsat-cores --minimal-unsat-cores-mode=fresh
+; EXPECT: unsat
+; EXPECT: (
+; EXPECT: a1
+; EXPECT: a4
+; EXPECT: )
+(set-logic QF_LIA)
+(set-option :produce-unsat-cores true)
+(declare-const x Int)
+(declare-const y Int)
+(define-fun two () Int 2)
+(assert (! (> x 5) :named a1))
+(assert (! (< y 100) :named a2))
+(assert (! (> y 3) :named a3))
+(assert (! (< x two) :named a4))
+(assert (! (or (> (+ x y) 0) (< x y)) :named a5))
+(check-sat)
+(get-unsat-core)
@@ -0,0 +1,29 @@
+; COMMAND-LINE: --lazy-model-build
+; EXPECT: sat
+; EXPECT: ((y 6))
+; EXPECT: (((f x) 6) ((= a b) false))
+; EXPECT: (((g a) 2) ((g (ite (= a b) a b)) 4))
+(set-info :smt-lib-version 2.6)
+(set-option :produce-models true)
+(set-logic QF_UFLIA)
+(declare-sort U 0)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun f (Int) Int)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun g (U) Int)
+
+(assert (= x 3))
+(assert (= (f x) y))
+(assert (> y 5))
+(assert (< y 7))
+(assert (distinct a b))
+(assert (= (g a) 2))
+(assert (= (g b) 4))
+
+(check-sat)
+; each query only builds the part of the model it needs, and extends it
+(get-value (y))
+(get-value ((f x) (= a b)))
+(get-value ((g a) (g (ite (= a b) a b))))
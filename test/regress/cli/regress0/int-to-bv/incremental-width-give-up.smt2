@@ -0,0 +1,12 @@
+; REQUIRES: statistics
+; COMMAND-LINE: --solve-int-as-bv-inc --solve-int-as-bv-inc-rlimit=1
+; SCRUBBER: grep -o -E '^sat$|"int-to-bv-inc::gave-up" [0-9]+'
+; EXPECT: sat
+; EXPECT: "int-to-bv-inc::gave-up" 1
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(assert (> (+ x y) 1000))
+(assert (< x y))
+(check-sat)
+(get-info :all-statistics)
@@ -0,0 +1,11 @@
+; COMMAND-LINE: --solve-int-as-bv-inc --solve-int-as-bv-inc-max=16
+; EXPECT: unsat
+(set-logic QF_NIA)
+(declare-const x Int)
+(declare-const y Int)
+(assert (= (* x y) 7))
+(assert (> x 1))
+(assert (> y 1))
+(assert (< x 8))
+(assert (< y 8))
+(check-sat)
@@ -0,0 +1,11 @@
+; COMMAND-LINE: --solve-int-as-bv-inc
+; EXPECT: sat
+(set-logic QF_NIA)
+(declare-const x Int)
+(declare-const y Int)
+(declare-const z Int)
+(assert (= (* x y) 391))
+(assert (> x 1))
+(assert (> y x))
+(assert (or (< z (- x)) (> (* z z) 1000)))
+(check-sat)
@@ -0,0 +1,11 @@
+; COMMAND-LINE: --nl-local-search --check-models
+; EXPECT: sat
+(set-logic QF_NIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (= (+ (* x x) (* y y)) 25))
+(assert (> x 0))
+(assert (> y x))
+(assert (= (* x y z) 24))
+(check-sat)
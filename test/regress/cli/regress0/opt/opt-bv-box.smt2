@@ -0,0 +1,12 @@
+; EXPECT: sat
+; EXPECT: ((b #x15 optimal) (a #x4f optimal))
+(set-logic QF_BV)
+(set-option :produce-models true)
+(declare-fun a () (_ BitVec 8))
+(declare-fun b () (_ BitVec 8))
+(assert (= (bvadd a b) #x64))
+(assert (bvult a #x50))
+(minimize b)
+(maximize a)
+(check-sat)
+(get-objectives)
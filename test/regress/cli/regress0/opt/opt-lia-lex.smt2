@@ -0,0 +1,20 @@
+; COMMAND-LINE: --opt-combination=lex
+; EXPECT: sat
+; EXPECT: ((x 7 optimal) (y 3 optimal) (z (- 12345) optimal))
+; EXPECT: ((x 7) (y 3))
+(set-logic QF_LIA)
+(set-option :produce-models true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (>= x 0))
+(assert (>= y 0))
+(assert (<= (+ x y) 10))
+(assert (<= (- x y) 4))
+(assert (>= z (- 12345)))
+(maximize x)
+(maximize y)
+(minimize z)
+(check-sat)
+(get-objectives)
+(get-value (x y))
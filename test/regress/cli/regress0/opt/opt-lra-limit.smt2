@@ -0,0 +1,14 @@
+; EXPECT: sat
+; EXPECT: ((x 1.0 limit-optimal) (y 3.0 optimal))
+(set-logic QF_LRA)
+(set-option :produce-models true)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (< x 1.0))
+(assert (> x (- 5.0)))
+(assert (<= y 3.0))
+(assert (<= (+ x y) 4.0))
+(maximize x)
+(maximize y)
+(check-sat)
+(get-objectives)
@@ -0,0 +1,17 @@
+; EXPECT: sat
+; EXPECT: (((+ x y) 7.0 optimal))
+; EXPECT: unsat
+(set-logic QF_LRA)
+(set-option :produce-models true)
+(set-option :incremental true)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (>= x 0.0))
+(assert (<= x 3.0))
+(assert (>= y 1.0))
+(assert (<= (+ (* 2.0 x) y) 7.0))
+(maximize (+ x y))
+(check-sat)
+(get-objectives)
+(assert (> (+ x y) 7.0))
+(check-sat)
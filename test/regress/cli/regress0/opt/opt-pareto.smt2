@@ -0,0 +1,16 @@
+; COMMAND-LINE: --incremental --opt-combination=pareto
+; EXPECT: sat
+; EXPECT: ((x 2 optimal) (y 2 optimal))
+; EXPECT: unsat
+(set-logic QF_LIA)
+(set-option :produce-models true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (<= x 2))
+(assert (<= y 2))
+(assert (<= (+ x y) 10))
+(maximize x)
+(maximize y)
+(check-sat)
+(get-objectives)
+(check-sat)
@@ -0,0 +1,17 @@
+; REQUIRES: statistics
+; COMMAND-LINE: --profile-inferences --sat-solver=minisat
+; SCRUBBER: grep -o -E '^(sat|unsat)$|"theory::inferenceProfile::(lemmas|propagations)" \{ [A-Z]' | sed -E 's/\{ [A-Z]$/nonempty/'
+; EXPECT: sat
+; EXPECT: "theory::inferenceProfile::lemmas" nonempty
+; EXPECT: "theory::inferenceProfile::propagations" nonempty
+(set-logic QF_SLIA)
+(declare-const x String)
+(declare-const y String)
+(declare-const z String)
+(declare-const w String)
+(assert (= (str.++ x "ab" y) (str.++ z w)))
+(assert (= (str.len z) (+ (str.len x) 1)))
+(assert (> (str.len y) 1))
+(assert (not (= w y)))
+(check-sat)
+(get-info :all-statistics)
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --produce-proofs --check-proofs --proof-compress-res --proof-intern
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-const x U)
+(declare-const y U)
+(declare-const p Bool)
+(assert (or p (= x y)))
+(assert (or (not p) (= x y)))
+(assert (or (not (= (f x) (f y))) p))
+(assert (or (not (= (f x) (f y))) (not p)))
+(check-sat)
@@ -0,0 +1,19 @@
+; REQUIRES: statistics
+; COMMAND-LINE: --produce-proofs --check-proofs --proof-compress-res --proof-compress-res-time=0
+; SCRUBBER: grep -o -E '^unsat$|"proofCompress::(chainStepsBefore|rejectedSteps)" [0-9]+' | sed -E 's/(chainStepsBefore") [1-9][0-9]*$/\1 positive/'
+; EXPECT: unsat
+; EXPECT: "proofCompress::chainStepsBefore" positive
+; EXPECT: "proofCompress::rejectedSteps" 0
+(set-logic QF_UF)
+(declare-const a Bool)
+(declare-const b Bool)
+(declare-const c Bool)
+(declare-const d Bool)
+(assert (or a b))
+(assert (or a (not b)))
+(assert (or (not a) c d))
+(assert (or (not a) c (not d)))
+(assert (or (not a) (not c) d))
+(assert (or (not a) (not c) (not d)))
+(check-sat)
+(get-info :all-statistics)
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --proof-intern
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun g (Int Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (= x y))
+(assert (= y z))
+(assert (= (g (f x) (f y)) (+ (f z) 1)))
+(assert (= (g (f z) (f z)) (f x)))
+(check-sat)
@@ -0,0 +1,21 @@
+; COMMAND-LINE: --produce-proofs --proof-print-stream
+; DISABLE-TESTER: dump
+; DISABLE-TESTER: lfsc
+; DISABLE-TESTER: alethe
+; SCRUBBER: grep -o -E '^(unsat|\(define @t|\(step)' | sort -u
+; EXPECT: (define @t
+; EXPECT: (step
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun p (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(assert (= a b))
+(assert (= b c))
+(assert (p (f (f a))))
+(assert (or (not (p (f (f c)))) (not (= (f a) (f b)))))
+(check-sat)
+(get-proof)
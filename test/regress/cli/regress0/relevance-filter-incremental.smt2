@@ -0,0 +1,24 @@
+; COMMAND-LINE: --incremental --relevance-filter
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+(set-logic QF_UFLIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun f (Int) Int)
+(declare-fun p () Bool)
+(assert (or p (> (f x) y)))
+(assert (=> p (< x y)))
+(check-sat)
+(push 1)
+(assert (> x y))
+(assert (not (> (f x) y)))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= (f x) (+ y 1)))
+(check-sat)
+(pop 1)
+(assert (not p))
+(check-sat)
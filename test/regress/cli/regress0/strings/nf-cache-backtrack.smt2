@@ -0,0 +1,20 @@
+; COMMAND-LINE: -i --strings-nf-cache
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_SLIA)
+(declare-const x String)
+(declare-const y String)
+(declare-const z String)
+(declare-const w String)
+(assert (= (str.++ x "ab" y) (str.++ z w)))
+(assert (= (str.len z) (str.len x)))
+(assert (> (str.len y) 1))
+(check-sat)
+(push 1)
+(assert (= x z))
+(assert (= w (str.++ "ba" y)))
+(check-sat)
+(pop 1)
+(assert (= w (str.++ "ab" y)))
+(check-sat)
@@ -0,0 +1,20 @@
+; REQUIRES: statistics
+; COMMAND-LINE: --strings-nf-cache
+; SCRUBBER: grep -o -E '^sat$|"theory::strings::nfCache(Reused|Invalidated)" [0-9]+' | sed -E 's/ [1-9][0-9]*$/ positive/'
+; EXPECT: sat
+; EXPECT: "theory::strings::nfCacheInvalidated" positive
+; EXPECT: "theory::strings::nfCacheReused" positive
+(set-logic QF_SLIA)
+(declare-const x String)
+(declare-const y String)
+(declare-const z String)
+(declare-const w String)
+(declare-const u String)
+(declare-const v String)
+(assert (= u (str.++ v "cd" v)))
+(assert (= (str.len v) 3))
+(assert (= (str.++ x "ab" y) (str.++ z w)))
+(assert (= (str.len z) (str.len x)))
+(assert (> (str.len y) 1))
+(check-sat)
+(get-info :all-statistics)
@@ -3320,6 +3320,103 @@ TEST_F(TestCApiBlackSolver, block_model_values5)
   cvc5_block_model_values(d_solver, args.size(), args.data());
 }
 
+TEST_F(TestCApiBlackSolver, minimize_maximize)
+{
+  Cvc5Term x = cvc5_mk_const(d_tm, d_int, "x");
+  Cvc5Term b = cvc5_mk_const(d_tm, d_bool, "b");
+  cvc5_minimize(d_solver, x);
+  cvc5_maximize(d_solver, cvc5_mk_const(d_tm, d_real, "y"));
+  cvc5_minimize(d_solver, cvc5_mk_const(d_tm, cvc5_mk_bv_sort(d_tm, 4), "z"));
+  ASSERT_CVC5_ERROR(cvc5_minimize(nullptr, x), "unexpected NULL argument");
+  ASSERT_CVC5_ERROR(cvc5_maximize(d_solver, nullptr), "invalid term");
+  ASSERT_CVC5_ERROR(cvc5_minimize(d_solver, b),
+                    "expected a term of sort Int, Real or bit-vector");
+  ASSERT_CVC5_ERROR(cvc5_maximize(d_solver, b),
+                    "expected a term of sort Int, Real or bit-vector");
+}
+
+TEST_F(TestCApiBlackSolver, get_objectives)
+{
+  cvc5_set_option(d_solver, "produce-models", "true");
+  cvc5_set_option(d_solver, "incremental", "true");
+  size_t size;
+  Cvc5Term *terms, *values;
+  Cvc5OptimizationStatus* statuses;
+  Cvc5Term x = cvc5_mk_const(d_tm, d_int, "x");
+  Cvc5Term y = cvc5_mk_const(d_tm, d_int, "y");
+  Cvc5Term zero = cvc5_mk_integer_int64(d_tm, 0);
+  Cvc5Term hundred = cvc5_mk_integer_int64(d_tm, 100);
+  std::vector<Cvc5Term> args = {x, zero};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_GEQ, args.size(), args.data()));
+  args = {y, zero};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_GEQ, args.size(), args.data()));
+  args = {x, y};
+  args = {cvc5_mk_term(d_tm, CVC5_KIND_ADD, args.size(), args.data()), hundred};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_LEQ, args.size(), args.data()));
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(nullptr, &size, &terms, &values, &statuses),
+      "unexpected NULL argument");
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, nullptr, &terms, &values, &statuses),
+      "unexpected NULL argument");
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, &size, nullptr, &values, &statuses),
+      "unexpected NULL argument");
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, &size, &terms, nullptr, &statuses),
+      "unexpected NULL argument");
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, &size, &terms, &values, nullptr),
+      "unexpected NULL argument");
+  // cannot ask before a check sat
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, &size, &terms, &values, &statuses),
+      "can only get objectives after SAT or UNKNOWN response");
+  cvc5_push(d_solver, 1);
+  cvc5_maximize(d_solver, x);
+  cvc5_minimize(d_solver, y);
+  ASSERT_TRUE(cvc5_result_is_sat(cvc5_check_sat(d_solver)));
+  cvc5_get_objectives(d_solver, &size, &terms, &values, &statuses);
+  ASSERT_EQ(size, 2);
+  ASSERT_TRUE(cvc5_term_is_equal(terms[0], x));
+  ASSERT_TRUE(cvc5_term_is_equal(values[0], hundred));
+  ASSERT_EQ(statuses[0], CVC5_OPTIMIZATION_STATUS_OPTIMAL);
+  ASSERT_TRUE(cvc5_term_is_equal(terms[1], y));
+  ASSERT_TRUE(cvc5_term_is_equal(values[1], zero));
+  ASSERT_EQ(statuses[1], CVC5_OPTIMIZATION_STATUS_OPTIMAL);
+  cvc5_pop(d_solver, 1);
+  // the objectives are removed by pop
+  ASSERT_TRUE(cvc5_result_is_sat(cvc5_check_sat(d_solver)));
+  ASSERT_CVC5_ERROR(
+      cvc5_get_objectives(d_solver, &size, &terms, &values, &statuses),
+      "can only get objectives after SAT or UNKNOWN response");
+}
+
+TEST_F(TestCApiBlackSolver, get_objectives_limit)
+{
+  cvc5_set_option(d_solver, "produce-models", "true");
+  size_t size;
+  Cvc5Term *terms, *values;
+  Cvc5OptimizationStatus* statuses;
+  Cvc5Term x = cvc5_mk_const(d_tm, d_real, "x");
+  Cvc5Term one = cvc5_mk_real_int64(d_tm, 1);
+  std::vector<Cvc5Term> args = {x, one};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_LT, args.size(), args.data()));
+  args = {x, cvc5_mk_real_int64(d_tm, 0)};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_GEQ, args.size(), args.data()));
+  cvc5_maximize(d_solver, x);
+  ASSERT_TRUE(cvc5_result_is_sat(cvc5_check_sat(d_solver)));
+  cvc5_get_objectives(d_solver, &size, &terms, &values, &statuses);
+  ASSERT_EQ(size, 1);
+  ASSERT_TRUE(cvc5_term_is_equal(values[0], one));
+  ASSERT_EQ(statuses[0], CVC5_OPTIMIZATION_STATUS_LIMIT_OPTIMAL);
+}
+
 TEST_F(TestCApiBlackSolver, get_instantiations)
 {
   std::vector<Cvc5Sort> sorts = {d_int};
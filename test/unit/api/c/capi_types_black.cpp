@@ -37,6 +37,9 @@ TEST_F(TestCApiBlackTypes, printEnum)
   ASSERT_CVC5_ERROR(cvc5_unknown_explanation_to_string(
                         static_cast<Cvc5UnknownExplanation>(-5)),
                     "invalid unknown explanation kind");
+  ASSERT_CVC5_ERROR(cvc5_optimization_status_to_string(
+                        static_cast<Cvc5OptimizationStatus>(-5)),
+                    "invalid optimization status");
   ASSERT_CVC5_ERROR(cvc5_modes_block_models_mode_to_string(
                         static_cast<Cvc5BlockModelsMode>(-5)),
                     "invalid block models mode");
@@ -56,8 +59,8 @@ TEST_F(TestCApiBlackTypes, printEnum)
       cvc5_modes_proof_format_to_string(static_cast<Cvc5ProofFormat>(-5)),
       "invalid proof format");
   std::string expected =
-      "CVC5_KIND_LT CVC5_SORT_KIND_ARRAY_SORT RTZ UNKNOWN_REASON literals "
-      "preprocess full enum smt_lib_2_6 lfsc";
+      "CVC5_KIND_LT CVC5_SORT_KIND_ARRAY_SORT RTZ UNKNOWN_REASON "
+      "limit-optimal literals preprocess full enum smt_lib_2_6 lfsc";
   std::stringstream ss;
   ss << cvc5_kind_to_string(CVC5_KIND_LT) << " ";
   ss << cvc5_sort_kind_to_string(CVC5_SORT_KIND_ARRAY_SORT) << " ";
@@ -65,6 +68,9 @@ TEST_F(TestCApiBlackTypes, printEnum)
   ss << cvc5_unknown_explanation_to_string(
       CVC5_UNKNOWN_EXPLANATION_UNKNOWN_REASON)
      << " ";
+  ss << cvc5_optimization_status_to_string(
+      CVC5_OPTIMIZATION_STATUS_LIMIT_OPTIMAL)
+     << " ";
   ss << cvc5_modes_block_models_mode_to_string(CVC5_BLOCK_MODELS_MODE_LITERALS)
      << " ";
   ss << cvc5_modes_learned_lit_type_to_string(CVC5_LEARNED_LIT_TYPE_PREPROCESS)
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <set>
 
 #include "base/output.h"
 #include "test_api.h"
@@ -1851,6 +1852,170 @@ TEST_F(TestApiBlackSolver, blockModelValues5)
   ASSERT_NO_THROW(d_solver->blockModelValues({x}));
 }
 
+TEST_F(TestApiBlackSolver, enumerateModels1)
+{
+  Term x = d_tm.mkConst(d_bool, "x");
+  Term y = d_tm.mkConst(d_bool, "y");
+  auto count = [](const std::vector<Term>&) { return true; };
+  ASSERT_THROW(d_solver->enumerateModels({x}, count), CVC5ApiException);
+  d_solver->setOption("produce-models", "true");
+  ASSERT_THROW(d_solver->enumerateModels({x}, count), CVC5ApiException);
+  d_solver->setOption("incremental", "true");
+  ASSERT_THROW(d_solver->enumerateModels({}, count), CVC5ApiException);
+  ASSERT_THROW(d_solver->enumerateModels({Term()}, count), CVC5ApiException);
+
+  TermManager tm;
+  Solver slv(tm);
+  slv.setOption("produce-models", "true");
+  slv.setOption("incremental", "true");
+  ASSERT_THROW(slv.enumerateModels({x}, count), CVC5ApiException);
+}
+
+TEST_F(TestApiBlackSolver, enumerateModels2)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("incremental", "true");
+  Term x = d_tm.mkConst(d_bool, "x");
+  Term y = d_tm.mkConst(d_bool, "y");
+  Term z = d_tm.mkConst(d_bool, "z");
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {x, y}));
+  // projected onto x, the three models of (or x y) collapse to two
+  std::vector<Term> xvals;
+  cvc5::Result r =
+      d_solver->enumerateModels({x}, [&](const std::vector<Term>& v) {
+        xvals.push_back(v[0]);
+        return true;
+      });
+  ASSERT_TRUE(r.isUnsat());
+  ASSERT_EQ(xvals.size(), 2);
+  ASSERT_NE(xvals[0], xvals[1]);
+
+  d_solver->resetAssertions();
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {x, y, z}));
+  size_t n = 0;
+  auto count = [&n](const std::vector<Term>&) {
+    n++;
+    return true;
+  };
+  r = d_solver->enumerateModels({x, y, z}, count, 3);
+  ASSERT_TRUE(r.isSat());
+  ASSERT_EQ(n, 3);
+  // resumes the enumeration
+  r = d_solver->enumerateModels({x, y, z}, count);
+  ASSERT_TRUE(r.isUnsat());
+  ASSERT_EQ(n, 7);
+}
+
+TEST_F(TestApiBlackSolver, enumerateModels3)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("incremental", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::AND,
+      {d_tm.mkTerm(Kind::GEQ, {x, d_tm.mkInteger(0)}),
+       d_tm.mkTerm(Kind::LT, {x, d_tm.mkInteger(10)})}));
+  size_t n = 0;
+  std::set<int64_t> xvals;
+  // the callback stops the enumeration
+  cvc5::Result r =
+      d_solver->enumerateModels({x}, [&](const std::vector<Term>& v) {
+        xvals.insert(v[0].getInt64Value());
+        return ++n < 5;
+      });
+  ASSERT_TRUE(r.isSat());
+  ASSERT_EQ(n, 5);
+  ASSERT_EQ(xvals.size(), 5);
+}
+
+TEST_F(TestApiBlackSolver, enumerateModels4)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("incremental", "true");
+  d_solver->setOption("lazy-model-build", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  Term zero = d_tm.mkInteger(0);
+  Term three = d_tm.mkInteger(3);
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LEQ, {zero, x}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LT, {x, three}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GT, {y, x}));
+  // the models are only built for x, but are still blocked correctly
+  std::set<int64_t> xvals;
+  cvc5::Result r =
+      d_solver->enumerateModels({x}, [&](const std::vector<Term>& v) {
+        xvals.insert(v[0].getInt64Value());
+        return true;
+      });
+  ASSERT_TRUE(r.isUnsat());
+  ASSERT_EQ(xvals, std::set<int64_t>({0, 1, 2}));
+}
+
+TEST_F(TestApiBlackSolver, minimizeMaximize)
+{
+  Term x = d_tm.mkConst(d_int, "x");
+  Term b = d_tm.mkConst(d_bool, "b");
+  ASSERT_NO_THROW(d_solver->minimize(x));
+  ASSERT_NO_THROW(d_solver->maximize(d_tm.mkConst(d_real, "y")));
+  ASSERT_NO_THROW(d_solver->minimize(d_tm.mkConst(d_tm.mkBitVectorSort(4))));
+  ASSERT_THROW(d_solver->minimize(b), CVC5ApiException);
+  ASSERT_THROW(d_solver->maximize(Term()), CVC5ApiException);
+
+  TermManager tm;
+  Solver slv(tm);
+  ASSERT_THROW(slv.minimize(x), CVC5ApiException);
+}
+
+TEST_F(TestApiBlackSolver, getObjectives)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("incremental", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  Term zero = d_tm.mkInteger(0);
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {x, zero}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {y, zero}));
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::LEQ, {d_tm.mkTerm(Kind::ADD, {x, y}), d_tm.mkInteger(100)}));
+  ASSERT_THROW(d_solver->getObjectives(), CVC5ApiException);
+  d_solver->push();
+  d_solver->maximize(x);
+  d_solver->minimize(y);
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  std::vector<std::tuple<Term, Term, OptimizationStatus>> objs =
+      d_solver->getObjectives();
+  ASSERT_EQ(objs.size(), 2);
+  ASSERT_EQ(std::get<0>(objs[0]), x);
+  ASSERT_EQ(std::get<1>(objs[0]), d_tm.mkInteger(100));
+  ASSERT_EQ(std::get<2>(objs[0]), OptimizationStatus::OPTIMAL);
+  ASSERT_EQ(std::get<0>(objs[1]), y);
+  ASSERT_EQ(std::get<1>(objs[1]), zero);
+  ASSERT_EQ(std::get<2>(objs[1]), OptimizationStatus::OPTIMAL);
+  d_solver->pop();
+  // the objectives are removed by pop
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  ASSERT_THROW(d_solver->getObjectives(), CVC5ApiException);
+}
+
+TEST_F(TestApiBlackSolver, getObjectivesLimit)
+{
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_real, "x");
+  Term one = d_tm.mkReal(1);
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LT, {x, one}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {x, d_tm.mkReal(0)}));
+  d_solver->maximize(x);
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  std::vector<std::tuple<Term, Term, OptimizationStatus>> objs =
+      d_solver->getObjectives();
+  ASSERT_EQ(objs.size(), 1);
+  ASSERT_EQ(std::get<1>(objs[0]), one);
+  ASSERT_EQ(std::get<2>(objs[0]), OptimizationStatus::LIMIT_OPTIMAL);
+  // the solution approaches the limit
+  Term lt = d_tm.mkTerm(Kind::LT, {d_solver->getValue(x), one});
+  ASSERT_TRUE(d_solver->simplify(lt).getBooleanValue());
+}
+
 TEST_F(TestApiBlackSolver, getInstantiations)
 {
   Term p = d_solver->declareFun("p", {d_int}, d_bool);
@@ -28,8 +28,8 @@ class TestApiBlackTypes : public ::testing::Test
 TEST_F(TestApiBlackTypes, printEnum)
 {
   std::string expected =
-      "LT ARRAY_SORT RTZ UNKNOWN_REASON literals preprocess full "
-      "enum "
+      "LT ARRAY_SORT RTZ UNKNOWN_REASON limit-optimal literals preprocess "
+      "full enum "
       "smt_lib_2_6 lfsc regular";
   {
     std::stringstream ss;
@@ -37,6 +37,7 @@ TEST_F(TestApiBlackTypes, printEnum)
     ss << cvc5::SortKind::ARRAY_SORT << " ";
     ss << cvc5::RoundingMode::ROUND_TOWARD_ZERO << " ";
     ss << cvc5::UnknownExplanation::UNKNOWN_REASON << " ";
+    ss << cvc5::OptimizationStatus::LIMIT_OPTIMAL << " ";
     ss << cvc5::modes::BlockModelsMode::LITERALS << " ";
     ss << cvc5::modes::LearnedLitType::PREPROCESS << " ";
     ss << cvc5::modes::ProofComponent::FULL << " ";
@@ -52,6 +53,7 @@ TEST_F(TestApiBlackTypes, printEnum)
     ss << std::to_string(cvc5::SortKind::ARRAY_SORT) << " ";
     ss << std::to_string(cvc5::RoundingMode::ROUND_TOWARD_ZERO) << " ";
     ss << std::to_string(cvc5::UnknownExplanation::UNKNOWN_REASON) << " ";
+    ss << std::to_string(cvc5::OptimizationStatus::LIMIT_OPTIMAL) << " ";
     ss << std::to_string(cvc5::modes::BlockModelsMode::LITERALS) << " ";
     ss << std::to_string(cvc5::modes::LearnedLitType::PREPROCESS) << " ";
     ss << std::to_string(cvc5::modes::ProofComponent::FULL) << " ";
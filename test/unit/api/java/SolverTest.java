@@ -1067,6 +1067,47 @@ class SolverTest
     }
   }
 
+  @Test
+  void minimizeMaximize() throws CVC5ApiException
+  {
+    Term x = d_tm.mkConst(d_tm.getIntegerSort(), "x");
+    assertDoesNotThrow(() -> d_solver.minimize(x));
+    assertDoesNotThrow(() -> d_solver.maximize(d_tm.mkConst(d_tm.getRealSort(), "y")));
+    assertDoesNotThrow(() -> d_solver.minimize(d_tm.mkConst(d_tm.mkBitVectorSort(4))));
+    Term b = d_tm.mkConst(d_tm.getBooleanSort(), "b");
+    assertThrows(CVC5ApiException.class, () -> d_solver.minimize(b));
+  }
+
+  @Test
+  void getObjectives() throws CVC5ApiException
+  {
+    d_solver.setOption("produce-models", "true");
+    d_solver.setOption("incremental", "true");
+    Term x = d_tm.mkConst(d_tm.getIntegerSort(), "x");
+    Term y = d_tm.mkConst(d_tm.getRealSort(), "y");
+    Term one = d_tm.mkReal(1);
+    d_solver.assertFormula(d_tm.mkTerm(GEQ, x, d_tm.mkInteger(0)));
+    d_solver.assertFormula(d_tm.mkTerm(LEQ, x, d_tm.mkInteger(100)));
+    d_solver.assertFormula(d_tm.mkTerm(LT, y, one));
+    d_solver.assertFormula(d_tm.mkTerm(GEQ, y, d_tm.mkReal(0)));
+    assertThrows(CVC5ApiException.class, () -> d_solver.getObjectives());
+    d_solver.push();
+    d_solver.maximize(x);
+    d_solver.maximize(y);
+    assertTrue(d_solver.checkSat().isSat());
+    List<Triplet<Term, Term, OptimizationStatus>> objs = d_solver.getObjectives();
+    assertEquals(2, objs.size());
+    assertEquals(x, objs.get(0).first);
+    assertEquals(d_tm.mkInteger(100), objs.get(0).second);
+    assertEquals(OptimizationStatus.OPTIMAL, objs.get(0).third);
+    assertEquals(y, objs.get(1).first);
+    assertEquals(one, objs.get(1).second);
+    assertEquals(OptimizationStatus.LIMIT_OPTIMAL, objs.get(1).third);
+    d_solver.pop();
+    assertTrue(d_solver.checkSat().isSat());
+    assertThrows(CVC5ApiException.class, () -> d_solver.getObjectives());
+  }
+
   @Test
   void getLearnedLiterals()
   {
@@ -1595,6 +1636,78 @@ class SolverTest
     assertDoesNotThrow(() -> d_solver.blockModelValues(new Term[] {x}));
   }
 
+  @Test
+  void enumerateModels1() throws CVC5ApiException
+  {
+    Term x = d_tm.mkConst(d_tm.getBooleanSort(), "x");
+    assertThrows(CVC5ApiException.class,
+        () -> d_solver.enumerateModels(new Term[] {x}, v -> true));
+    d_solver.setOption("produce-models", "true");
+    assertThrows(CVC5ApiException.class,
+        () -> d_solver.enumerateModels(new Term[] {x}, v -> true));
+    d_solver.setOption("incremental", "true");
+    assertThrows(CVC5ApiException.class,
+        () -> d_solver.enumerateModels(new Term[] {}, v -> true));
+
+    TermManager tm = new TermManager();
+    Solver slv = new Solver(tm);
+    slv.setOption("produce-models", "true");
+    slv.setOption("incremental", "true");
+    assertThrows(CVC5ApiException.class,
+        () -> slv.enumerateModels(new Term[] {x}, v -> true));
+  }
+
+  @Test
+  void enumerateModels2() throws CVC5ApiException
+  {
+    d_solver.setOption("produce-models", "true");
+    d_solver.setOption("incremental", "true");
+    Term x = d_tm.mkConst(d_tm.getBooleanSort(), "x");
+    Term y = d_tm.mkConst(d_tm.getBooleanSort(), "y");
+    Term z = d_tm.mkConst(d_tm.getBooleanSort(), "z");
+    d_solver.assertFormula(d_tm.mkTerm(OR, x, y));
+    // projected onto x, the three models of (or x y) collapse to two
+    List<Term> xvals = new ArrayList<>();
+    Result r = d_solver.enumerateModels(new Term[] {x}, v -> xvals.add(v[0]));
+    assertTrue(r.isUnsat());
+    assertEquals(2, xvals.size());
+    assertNotEquals(xvals.get(0), xvals.get(1));
+
+    d_solver.resetAssertions();
+    d_solver.assertFormula(d_tm.mkTerm(OR, x, y, z));
+    List<Term[]> models = new ArrayList<>();
+    r = d_solver.enumerateModels(new Term[] {x, y, z}, v -> models.add(v), 3);
+    assertTrue(r.isSat());
+    assertEquals(3, models.size());
+    // resumes the enumeration
+    r = d_solver.enumerateModels(new Term[] {x, y, z}, v -> models.add(v));
+    assertTrue(r.isUnsat());
+    assertEquals(7, models.size());
+  }
+
+  @Test
+  void enumerateModels3() throws CVC5ApiException
+  {
+    d_solver.setOption("produce-models", "true");
+    d_solver.setOption("incremental", "true");
+    Term x = d_tm.mkConst(d_tm.getIntegerSort(), "x");
+    d_solver.assertFormula(d_tm.mkTerm(GEQ, x, d_tm.mkInteger(0)));
+    d_solver.assertFormula(d_tm.mkTerm(LT, x, d_tm.mkInteger(10)));
+    // the callback stops the enumeration
+    Set<Term> xvals = new HashSet<>();
+    Result r = d_solver.enumerateModels(new Term[] {x}, v -> {
+      xvals.add(v[0]);
+      return xvals.size() < 5;
+    });
+    assertTrue(r.isSat());
+    assertEquals(5, xvals.size());
+    // exceptions thrown by the callback are propagated
+    assertThrows(IllegalStateException.class,
+        () -> d_solver.enumerateModels(new Term[] {x}, v -> {
+          throw new IllegalStateException("stop");
+        }));
+  }
+
   @Test
   void getInstantiations() throws CVC5ApiException
   {
@@ -14,7 +14,7 @@ import sys
 from math import isnan
 
 from cvc5 import Kind, OptionCategory, SortKind, TermManager, Solver, Plugin
-from cvc5 import RoundingMode
+from cvc5 import OptimizationStatus, RoundingMode
 from cvc5 import BlockModelsMode, LearnedLitType, FindSynthTarget
 from cvc5 import ProofComponent, ProofFormat
 
@@ -1030,6 +1030,70 @@ def test_block_model_values5(tm, solver):
     solver.checkSat()
     solver.blockModelValues([x])
 
+def test_enumerate_models1(tm, solver):
+    x = tm.mkConst(solver.getBooleanSort(), "x")
+    with pytest.raises(RuntimeError):
+        solver.enumerateModels([x], lambda v: True)
+    solver.setOption("produce-models", "true")
+    with pytest.raises(RuntimeError):
+        solver.enumerateModels([x], lambda v: True)
+    solver.setOption("incremental", "true")
+    with pytest.raises(RuntimeError):
+        solver.enumerateModels([], lambda v: True)
+
+    ttm = TermManager()
+    slv = Solver(ttm)
+    slv.setOption("produce-models", "true")
+    slv.setOption("incremental", "true")
+    with pytest.raises(RuntimeError):
+        slv.enumerateModels([x], lambda v: True)
+
+def test_enumerate_models2(tm, solver):
+    solver.setOption("produce-models", "true")
+    solver.setOption("incremental", "true")
+    x = tm.mkConst(solver.getBooleanSort(), "x")
+    y = tm.mkConst(solver.getBooleanSort(), "y")
+    z = tm.mkConst(solver.getBooleanSort(), "z")
+    solver.assertFormula(tm.mkTerm(Kind.OR, x, y))
+    # projected onto x, the three models of (or x y) collapse to two
+    xvals = []
+    r = solver.enumerateModels([x], lambda v: xvals.append(v[0]) is None)
+    assert r.isUnsat()
+    assert len(xvals) == 2
+    assert xvals[0] != xvals[1]
+
+    solver.resetAssertions()
+    solver.assertFormula(tm.mkTerm(Kind.OR, x, y, z))
+    models = []
+    r = solver.enumerateModels([x, y, z], lambda v: models.append(v) is None,
+                               3)
+    assert r.isSat()
+    assert len(models) == 3
+    # resumes the enumeration
+    r = solver.enumerateModels([x, y, z], lambda v: models.append(v) is None)
+    assert r.isUnsat()
+    assert len(models) == 7
+
+def test_enumerate_models3(tm, solver):
+    solver.setOption("produce-models", "true")
+    solver.setOption("incremental", "true")
+    x = tm.mkConst(tm.getIntegerSort(), "x")
+    solver.assertFormula(tm.mkTerm(Kind.GEQ, x, tm.mkInteger(0)))
+    solver.assertFormula(tm.mkTerm(Kind.LT, x, tm.mkInteger(10)))
+    # the callback stops the enumeration
+    xvals = set()
+    def callback(values):
+        xvals.add(values[0].getIntegerValue())
+        return len(xvals) < 5
+    r = solver.enumerateModels([x], callback)
+    assert r.isSat()
+    assert len(xvals) == 5
+    # exceptions raised by the callback are propagated
+    def fail(values):
+        raise ValueError("stop")
+    with pytest.raises(RuntimeError):
+        solver.enumerateModels([x], fail)
+
 def test_get_instantiations(tm, solver):
     iSort = tm.getIntegerSort()
     boolSort = solver.getBooleanSort()
@@ -2232,6 +2296,39 @@ def test_get_difficulty3(tm, solver):
     assert key == f0 or key == f1
     assert value.getKind() == Kind.CONST_INTEGER
 
+def test_minimize_maximize(tm, solver):
+    x = tm.mkConst(tm.getIntegerSort(), "x")
+    solver.minimize(x)
+    solver.maximize(tm.mkConst(tm.getRealSort(), "y"))
+    solver.minimize(tm.mkConst(tm.mkBitVectorSort(4)))
+    with pytest.raises(RuntimeError):
+        solver.minimize(tm.mkConst(tm.getBooleanSort(), "b"))
+
+def test_get_objectives(tm, solver):
+    solver.setOption("produce-models", "true")
+    solver.setOption("incremental", "true")
+    x = tm.mkConst(tm.getIntegerSort(), "x")
+    y = tm.mkConst(tm.getRealSort(), "y")
+    zero = tm.mkInteger(0)
+    one = tm.mkReal(1)
+    solver.assertFormula(tm.mkTerm(Kind.GEQ, x, zero))
+    solver.assertFormula(tm.mkTerm(Kind.LEQ, x, tm.mkInteger(100)))
+    solver.assertFormula(tm.mkTerm(Kind.LT, y, one))
+    solver.assertFormula(tm.mkTerm(Kind.GEQ, y, tm.mkReal(0)))
+    with pytest.raises(RuntimeError):
+        solver.getObjectives()
+    solver.push()
+    solver.maximize(x)
+    solver.maximize(y)
+    assert solver.checkSat().isSat()
+    objs = solver.getObjectives()
+    assert objs == [(x, tm.mkInteger(100), OptimizationStatus.OPTIMAL),
+                    (y, one, OptimizationStatus.LIMIT_OPTIMAL)]
+    solver.pop()
+    assert solver.checkSat().isSat()
+    with pytest.raises(RuntimeError):
+        solver.getObjectives()
+
 def test_get_model(tm, solver):
     solver.setOption("produce-models", "true")
     uSort = tm.mkUninterpretedSort("u")
@@ -11,6 +11,7 @@
  */
 
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base/output.h"
@@ -309,5 +310,104 @@ TEST_F(TestNodeBlackNodeManager, mkNode_too_many_children)
                "toSize > d_nvMaxChildren");
 #endif
 }
+
+TEST_F(TestNodeBlackNodeManager, separate_managers_per_thread)
+{
+  // Without concurrent nodes, threads may still use node managers of their
+  // own. This runs in every build, including when the node manager is built
+  // without locks.
+  const size_t nthreads = 4;
+  const int64_t nterms = 10000;
+  std::vector<std::vector<std::string>> results(nthreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nthreads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      NodeManager nm;
+      TypeNode intType = nm.integerType();
+      Node x = nm.mkBoundVar("x", intType);
+      for (int64_t i = 0; i < nterms; ++i)
+      {
+        Node c = nm.mkConstInt(Rational(i));
+        Node n = nm.mkNode(Kind::ADD, x, c);
+        // dropped immediately, so that zombies are reclaimed
+        Node u = nm.mkNode(Kind::MULT, x, nm.mkConstInt(Rational(-i)));
+        ASSERT_EQ(u.getType(), intType);
+        ASSERT_EQ(nm.mkNode(Kind::ADD, x, c), n);
+        if (i % 1000 == 0)
+        {
+          results[t].push_back(n.toString());
+        }
+      }
+    });
+  }
+  for (std::thread& th : threads)
+  {
+    th.join();
+  }
+  for (size_t t = 1; t < nthreads; ++t)
+  {
+    ASSERT_EQ(results[t], results[0]);
+  }
+}
+
+#ifdef CVC5_CONCURRENT_NODES
+TEST_F(TestNodeBlackNodeManager, concurrent_mkNode)
+{
+  TypeNode intType = d_nodeManager->integerType();
+  Node x = d_skolemManager->mkDummySkolem("x", intType);
+  const size_t nthreads = 4;
+  // each thread drops about twice as many terms as it creates, which is well
+  // above the number of zombies (5000) at which the node manager reclaims
+  // them, so that zombies are reclaimed while other threads create and
+  // resurrect the same terms
+  const int64_t nterms = 10000;
+  std::vector<std::vector<Node>> results(nthreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nthreads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (int64_t i = 0; i < nterms; ++i)
+      {
+        Node c = d_nodeManager->mkConstInt(Rational(i));
+        Node n = d_nodeManager->mkNode(Kind::ADD, x, c);
+        // a term only created by this thread, which is dropped immediately
+        Node u = d_nodeManager->mkNode(
+            Kind::MULT,
+            x,
+            d_nodeManager->mkConstInt(Rational(nterms * (t + 1) + i)));
+        ASSERT_EQ(u.getType(), intType);
+        // drop a term that is shared with the other threads
+        if (i % 2 == 0)
+        {
+          n = d_nodeManager->mkNode(Kind::MULT, n, c);
+        }
+        ASSERT_EQ(n.getType(), intType);
+        results[t].push_back(n);
+      }
+    });
+  }
+  for (std::thread& th : threads)
+  {
+    th.join();
+  }
+  // all threads must agree on the (hash-consed) terms
+  for (size_t t = 1; t < nthreads; ++t)
+  {
+    ASSERT_EQ(results[t], results[0]);
+  }
+  // terms that were reclaimed are rebuilt consistently
+  for (int64_t i = 0; i < nterms; ++i)
+  {
+    Node c = d_nodeManager->mkConstInt(Rational(i));
+    Node n = d_nodeManager->mkNode(Kind::ADD, x, c);
+    if (i % 2 == 0)
+    {
+      n = d_nodeManager->mkNode(Kind::MULT, n, c);
+    }
+    ASSERT_EQ(n, results[0][i]);
+  }
+}
+#endif
 }  // namespace test
 }  // namespace cvc5::internal
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of the interning of proof nodes in the proof node manager.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "options/options.h"
+#include "options/proof_options.h"
+#include "options/smt_options.h"
+#include "proof/proof_node.h"
+#include "proof/proof_node_algorithm.h"
+#include "proof/proof_node_manager.h"
+#include "smt/env.h"
+#include "smt/proof_manager.h"
+#include "test_node.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestProofWhiteProofNodeManager : public TestNode
+{
+ protected:
+  void SetUp() override
+  {
+    TestNode::SetUp();
+    d_options.write_smt().produceProofs = true;
+    d_options.write_smt().proofMode = options::ProofMode::FULL;
+    d_options.write_proof().proofIntern = true;
+    d_env.reset(new Env(d_nodeManager.get(), &d_options));
+    d_pfm.reset(new smt::PfManager(*d_env));
+    d_env->finishInit(d_pfm.get());
+    d_pnm = d_env->getProofNodeManager();
+    d_x = d_nodeManager->mkVar("x", d_nodeManager->integerType());
+    d_y = d_nodeManager->mkVar("y", d_nodeManager->integerType());
+  }
+  void TearDown() override
+  {
+    d_pfm.reset();
+    d_env.reset();
+  }
+
+  Options d_options;
+  std::unique_ptr<Env> d_env;
+  std::unique_ptr<smt::PfManager> d_pfm;
+  ProofNodeManager* d_pnm;
+  Node d_x;
+  Node d_y;
+};
+
+TEST_F(TestProofWhiteProofNodeManager, internLeaves)
+{
+  Node xx = d_x.eqNode(d_x);
+  Node xy = d_x.eqNode(d_y);
+  Node yx = d_y.eqNode(d_x);
+  // leaves are shared
+  std::shared_ptr<ProofNode> r1 = d_pnm->mkNode(ProofRule::REFL, {}, {d_x}, xx);
+  std::shared_ptr<ProofNode> r2 = d_pnm->mkNode(ProofRule::REFL, {}, {d_x}, xx);
+  ASSERT_EQ(r1, r2);
+  // assumptions and steps with children are not
+  std::shared_ptr<ProofNode> a1 = d_pnm->mkAssume(xy);
+  std::shared_ptr<ProofNode> a2 = d_pnm->mkAssume(xy);
+  ASSERT_NE(a1, a2);
+  std::shared_ptr<ProofNode> s1 = d_pnm->mkNode(ProofRule::SYMM, {a1}, {}, yx);
+  std::shared_ptr<ProofNode> s2 = d_pnm->mkNode(ProofRule::SYMM, {a1}, {}, yx);
+  ASSERT_NE(s1, s2);
+  // other leaves are not
+  std::shared_ptr<ProofNode> tr1 =
+      d_pnm->mkTrustedNode(TrustId::THEORY_LEMMA, {}, {}, xx);
+  std::shared_ptr<ProofNode> tr2 =
+      d_pnm->mkTrustedNode(TrustId::THEORY_LEMMA, {}, {}, xx);
+  ASSERT_NE(tr1, tr2);
+  // a shared leaf is not updated, since r2 would change as well
+  ASSERT_TRUE(d_pnm->updateNode(r1.get(), tr1.get()));
+  ASSERT_EQ(r1->getRule(), ProofRule::REFL);
+  ASSERT_EQ(r2->getRule(), ProofRule::REFL);
+  std::shared_ptr<ProofNode> r3 = d_pnm->mkNode(ProofRule::REFL, {}, {d_x}, xx);
+  ASSERT_EQ(r1, r3);
+}
+
+TEST_F(TestProofWhiteProofNodeManager, updateUnsharedLeaf)
+{
+  Node yy = d_y.eqNode(d_y);
+  std::shared_ptr<ProofNode> r1 = d_pnm->mkNode(ProofRule::REFL, {}, {d_y}, yy);
+  // a leaf that was handed out once is updated, and no longer handed out
+  std::shared_ptr<ProofNode> tr =
+      d_pnm->mkTrustedNode(TrustId::THEORY_LEMMA, {}, {}, yy);
+  ASSERT_TRUE(d_pnm->updateNode(r1.get(), tr.get()));
+  ASSERT_EQ(r1->getRule(), ProofRule::TRUST);
+  std::shared_ptr<ProofNode> r2 = d_pnm->mkNode(ProofRule::REFL, {}, {d_y}, yy);
+  ASSERT_NE(r1, r2);
+  ASSERT_EQ(r2->getRule(), ProofRule::REFL);
+}
+
+TEST_F(TestProofWhiteProofNodeManager, shareAcrossScopes)
+{
+  Node yy = d_y.eqNode(d_y);
+  Node xy = d_x.eqNode(d_y);
+  // two proofs of x = y from the assumption x = y that share the leaf REFL(y)
+  std::shared_ptr<ProofNode> r1 = d_pnm->mkNode(ProofRule::REFL, {}, {d_y}, yy);
+  std::shared_ptr<ProofNode> t1 =
+      d_pnm->mkNode(ProofRule::TRANS, {d_pnm->mkAssume(xy), r1}, {}, xy);
+  std::shared_ptr<ProofNode> r2 = d_pnm->mkNode(ProofRule::REFL, {}, {d_y}, yy);
+  std::shared_ptr<ProofNode> t2 =
+      d_pnm->mkNode(ProofRule::TRANS, {d_pnm->mkAssume(xy), r2}, {}, xy);
+  ASSERT_EQ(r1, r2);
+  ASSERT_NE(t1, t2);
+  std::vector<Node> assumps{xy};
+  std::shared_ptr<ProofNode> sc1 = d_pnm->mkScope(t1, assumps);
+  std::shared_ptr<ProofNode> sc2 = d_pnm->mkScope(t2, assumps);
+  std::vector<Node> free;
+  expr::getFreeAssumptions(sc1.get(), free);
+  ASSERT_TRUE(free.empty());
+  expr::getFreeAssumptions(sc2.get(), free);
+  ASSERT_TRUE(free.empty());
+  // updating the body of the first scope to depend on an assumption it does
+  // not discharge does not change the second scope
+  Node z = d_nodeManager->mkVar("z", d_nodeManager->integerType());
+  std::shared_ptr<ProofNode> xz = d_pnm->mkAssume(d_x.eqNode(z));
+  std::shared_ptr<ProofNode> zy = d_pnm->mkAssume(z.eqNode(d_y));
+  std::shared_ptr<ProofNode> t3 =
+      d_pnm->mkNode(ProofRule::TRANS, {xz, zy}, {}, xy);
+  ASSERT_TRUE(d_pnm->updateNode(t1.get(), t3.get()));
+  expr::getFreeAssumptions(sc1.get(), free);
+  ASSERT_FALSE(free.empty());
+  free.clear();
+  expr::getFreeAssumptions(sc2.get(), free);
+  ASSERT_TRUE(free.empty());
+  ASSERT_EQ(t2->getRule(), ProofRule::TRANS);
+  ASSERT_EQ(sc2->getResult(), sc1->getResult());
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
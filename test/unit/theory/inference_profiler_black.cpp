@@ -0,0 +1,103 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::theory::InferenceProfiler.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "base/configuration.h"
+#include "test.h"
+#include "theory/inference_profiler.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+
+namespace test {
+
+class TestTheoryBlackInferenceProfiler : public TestInternal
+{
+};
+
+TEST_F(TestTheoryBlackInferenceProfiler, profile)
+{
+  StatisticsRegistry sr;
+  InferenceProfiler prof(sr);
+  // a check with two lemmas
+  prof.beginCheck(THEORY_ARITH);
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  prof.notifyLemma(InferenceId::ARITH_NL_TANGENT_PLANE, THEORY_ARITH);
+  prof.notifyLemma(InferenceId::ARITH_NL_TANGENT_PLANE, THEORY_ARITH);
+  prof.endCheck();
+  // a check without lemmas
+  prof.beginCheck(THEORY_UF);
+  prof.endCheck();
+  // a lemma outside of checks
+  prof.notifyLemma(InferenceId::UF_HO_APP_ENCODE, THEORY_UF);
+  prof.setCurrentLemma(InferenceId::UF_HO_APP_ENCODE);
+  ASSERT_EQ(prof.getCurrentLemma(), InferenceId::UF_HO_APP_ENCODE);
+  prof.setCurrentLemma(InferenceId::NONE);
+  prof.notifyPropagation(InferenceId::UF_HO_APP_ENCODE);
+  prof.notifyPropagation(InferenceId::UF_HO_APP_ENCODE);
+  prof.notifyConflict(InferenceId::UF_HO_APP_ENCODE);
+
+  std::stringstream ss;
+  prof.print(ss);
+  std::string s = ss.str();
+  size_t tangent = s.find("ARITH_NL_TANGENT_PLANE");
+  size_t encode = s.find("UF_HO_APP_ENCODE");
+  ASSERT_NE(tangent, std::string::npos);
+  ASSERT_NE(encode, std::string::npos);
+  // ranked by time
+  ASSERT_LT(tangent, encode);
+  // three uses for one lemma
+  ASSERT_NE(s.find("3.000", encode), std::string::npos);
+  ASSERT_NE(s.find("THEORY_ARITH"), std::string::npos);
+  ASSERT_NE(s.find("THEORY_UF"), std::string::npos);
+  ASSERT_EQ(s.find("THEORY_BV"), std::string::npos);
+
+  // the profile is also available as statistics
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    std::stringstream sss;
+    sr.print(sss);
+    std::string stats = sss.str();
+    ASSERT_NE(stats.find("theory::inferenceProfile::lemmas = { "
+                         "ARITH_NL_TANGENT_PLANE: 2, UF_HO_APP_ENCODE: 1 }"),
+              std::string::npos);
+    ASSERT_NE(stats.find("theory::inferenceProfile::propagations = { "
+                         "UF_HO_APP_ENCODE: 2 }"),
+              std::string::npos);
+    ASSERT_NE(stats.find("theory::inferenceProfile::checks = { "
+                         "THEORY_ARITH: 1, THEORY_UF: 1 }"),
+              std::string::npos);
+  }
+
+  // the signal-safe version prints the same profile
+  std::FILE* f = std::tmpfile();
+  ASSERT_NE(f, nullptr);
+  prof.printSafe(fileno(f));
+  std::rewind(f);
+  std::string fs;
+  for (int c = std::fgetc(f); c != EOF; c = std::fgetc(f))
+  {
+    fs.push_back(static_cast<char>(c));
+  }
+  std::fclose(f);
+  ASSERT_EQ(fs, s);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
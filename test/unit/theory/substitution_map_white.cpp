@@ -0,0 +1,122 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of the cache of substitution maps.
+ */
+
+#include "context/context.h"
+#include "expr/node.h"
+#include "expr/skolem_manager.h"
+#include "test_node.h"
+#include "theory/substitutions.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+
+namespace test {
+
+class TestTheoryWhiteSubstitutionMap : public TestNode
+{
+ protected:
+  void SetUp() override
+  {
+    TestNode::SetUp();
+    TypeNode intType = d_nodeManager->integerType();
+    d_x = d_skolemManager->mkDummySkolem("x", intType);
+    d_y = d_skolemManager->mkDummySkolem("y", intType);
+    d_z = d_skolemManager->mkDummySkolem("z", intType);
+    d_a = d_skolemManager->mkDummySkolem("a", intType);
+    d_f = d_skolemManager->mkDummySkolem(
+        "f", d_nodeManager->mkFunctionType(intType, intType));
+    d_g = d_skolemManager->mkDummySkolem(
+        "g", d_nodeManager->mkFunctionType({intType, intType}, intType));
+  }
+
+  Node f(const Node& t)
+  {
+    return d_nodeManager->mkNode(Kind::APPLY_UF, d_f, t);
+  }
+
+  Node g(const Node& s, const Node& t)
+  {
+    return d_nodeManager->mkNode(Kind::APPLY_UF, d_g, s, t);
+  }
+
+  context::Context d_context;
+  Node d_x;
+  Node d_y;
+  Node d_z;
+  Node d_a;
+  Node d_f;
+  Node d_g;
+};
+
+TEST_F(TestTheoryWhiteSubstitutionMap, add_after_apply)
+{
+  SubstitutionMap sm(&d_context);
+  sm.addSubstitution(d_y, f(d_x));
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_x), d_z));
+  // x occurs in the cached result of y and g(y, z)
+  sm.addSubstitution(d_x, d_a);
+  ASSERT_FALSE(sm.d_cacheInvalidated);
+  ASSERT_EQ(sm.d_substitutionCache.find(d_y), sm.d_substitutionCache.end());
+  ASSERT_EQ(sm.d_substitutionCache.find(g(d_y, d_z)),
+            sm.d_substitutionCache.end());
+  // the result of z does not depend on x
+  ASSERT_NE(sm.d_substitutionCache.find(d_z), sm.d_substitutionCache.end());
+  ASSERT_EQ(sm.apply(d_y), f(d_a));
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_a), d_z));
+}
+
+TEST_F(TestTheoryWhiteSubstitutionMap, dependencies_are_unique)
+{
+  SubstitutionMap sm(&d_context);
+  sm.addSubstitution(d_z, d_a);
+  ASSERT_EQ(sm.apply(g(d_x, d_x)), g(d_x, d_x));
+  ASSERT_EQ(sm.d_cacheParents[d_x].size(), 1u);
+  ASSERT_EQ(sm.apply(g(d_x, d_y)), g(d_x, d_y));
+  ASSERT_EQ(sm.d_cacheParents[d_x].size(), 2u);
+  // invalidates the result of g(x, y) but not that of x
+  sm.addSubstitution(d_y, d_a);
+  ASSERT_NE(sm.d_substitutionCache.find(d_x), sm.d_substitutionCache.end());
+  ASSERT_EQ(sm.apply(g(d_x, d_y)), g(d_x, d_a));
+  ASSERT_EQ(sm.d_cacheParents[d_x].size(), 2u);
+}
+
+TEST_F(TestTheoryWhiteSubstitutionMap, erase)
+{
+  SubstitutionMap sm(&d_context, false);
+  sm.addSubstitution(d_x, d_a);
+  sm.addSubstitution(d_y, f(d_x));
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_a), d_z));
+  sm.eraseSubstitution(d_x);
+  ASSERT_FALSE(sm.d_cacheInvalidated);
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_x), d_z));
+  ASSERT_EQ(sm.apply(d_x), d_x);
+}
+
+TEST_F(TestTheoryWhiteSubstitutionMap, backtrack)
+{
+  SubstitutionMap sm(&d_context);
+  sm.addSubstitution(d_y, f(d_x));
+  d_context.push();
+  sm.addSubstitution(d_x, d_a);
+  // compresses the substitution of y to f(a) in the current context
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_a), d_z));
+  d_context.pop();
+  ASSERT_FALSE(sm.d_cacheInvalidated);
+  ASSERT_FALSE(sm.hasSubstitution(d_x));
+  ASSERT_EQ(sm.getSubstitution(d_y), f(d_x));
+  ASSERT_EQ(sm.apply(g(d_y, d_z)), g(f(d_x), d_z));
+  ASSERT_EQ(sm.apply(d_x), d_x);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
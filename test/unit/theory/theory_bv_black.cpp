@@ -171,5 +171,26 @@ TEST_F(TestTheoryBlackBv, reg8361)
   slv.assertFormula(d_tm.mkTerm(cvc5::Kind::DISTINCT, bvs));
   ASSERT_TRUE(slv.checkSat().isUnsat());
 }
+
+TEST_F(TestTheoryBlackBv, bitblastRelevant)
+{
+  d_solver->setOption("bv-bitblast-relevant", "true");
+  d_solver->setLogic("QF_BV");
+  Sort bv8 = d_tm.mkBitVectorSort(8);
+  Term x = d_tm.mkConst(bv8, "x");
+  Term y = d_tm.mkConst(bv8, "y");
+  Term a1 = d_tm.mkTerm(cvc5::Kind::BITVECTOR_ULT, {x, y});
+  Term mul = d_tm.mkTerm(cvc5::Kind::BITVECTOR_MULT, {x, y});
+  Term a2 = d_tm.mkTerm(cvc5::Kind::EQUAL, {mul, d_tm.mkBitVector(8, 7)});
+  Term div = d_tm.mkTerm(cvc5::Kind::BITVECTOR_UDIV, {y, x});
+  Term a3 = d_tm.mkTerm(cvc5::Kind::EQUAL, {div, d_tm.mkBitVector(8, 3)});
+  d_solver->assertFormula(d_tm.mkTerm(cvc5::Kind::OR, {a1, a2, a3}));
+  ASSERT_TRUE(d_solver->checkSat().isSat());
+  // the atoms of the disjuncts that are not needed to satisfy the disjunction
+  // are not bit-blasted
+  Statistics stats = d_solver->getStatistics();
+  Stat s = stats.get("theory::bv::BVSolverBitblastInternal::irrelevantSkipped");
+  ASSERT_GT(s.getInt(), 0);
+}
 }  // namespace test
 }  // namespace cvc5::internal
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of cvc5::internal::theory::bv::BVLocalSearch.
+ */
+
+#include <vector>
+
+#include "test_smt.h"
+#include "theory/bv/bv_local_search.h"
+#include "util/bitvector.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+using namespace theory::bv;
+
+namespace test {
+
+class TestTheoryWhiteBvLocalSearch : public TestSmt
+{
+ protected:
+  Node mkConst(uint32_t w, uint32_t v)
+  {
+    return d_nodeManager->mkConst(BitVector(w, v));
+  }
+  BitVector getValue(BVLocalSearch& ls, Node n)
+  {
+    Node v = ls.getValue(n);
+    return v.getConst<BitVector>();
+  }
+};
+
+TEST_F(TestTheoryWhiteBvLocalSearch, arith)
+{
+  BVLocalSearch ls(d_slvEngine->getEnv());
+  TypeNode bv8 = d_nodeManager->mkBitVectorType(8);
+  Node x = d_nodeManager->mkVar("x", bv8);
+  Node y = d_nodeManager->mkVar("y", bv8);
+  std::vector<Node> lits;
+  lits.push_back(d_nodeManager->mkNode(
+      Kind::EQUAL, d_nodeManager->mkNode(Kind::BITVECTOR_ADD, x, y),
+      mkConst(8, 200)));
+  lits.push_back(d_nodeManager->mkNode(Kind::BITVECTOR_ULT, x, y));
+  lits.push_back(d_nodeManager->mkNode(
+      Kind::EQUAL, d_nodeManager->mkNode(Kind::BITVECTOR_MULT, x,
+                                         mkConst(8, 3)),
+      mkConst(8, 9)));
+  ASSERT_TRUE(ls.solve(lits, 10000));
+  BitVector xv = getValue(ls, x);
+  BitVector yv = getValue(ls, y);
+  ASSERT_EQ(xv + yv, BitVector(8, 200u));
+  ASSERT_TRUE(xv.unsignedLessThan(yv));
+  ASSERT_EQ(xv * BitVector(8, 3u), BitVector(8, 9u));
+}
+
+TEST_F(TestTheoryWhiteBvLocalSearch, bits)
+{
+  BVLocalSearch ls(d_slvEngine->getEnv());
+  TypeNode bv8 = d_nodeManager->mkBitVectorType(8);
+  Node x = d_nodeManager->mkVar("x", bv8);
+  Node y = d_nodeManager->mkVar("y", bv8);
+  Node hi = d_nodeManager->mkNode(
+      d_nodeManager->mkConst(BitVectorExtract(7, 4)), x);
+  std::vector<Node> lits;
+  lits.push_back(hi.eqNode(mkConst(4, 5)));
+  lits.push_back(
+      d_nodeManager->mkNode(Kind::BITVECTOR_AND, x, y).eqNode(mkConst(8, 3)));
+  lits.push_back(d_nodeManager->mkNode(Kind::BITVECTOR_SLT, y, mkConst(8, 0)));
+  lits.push_back(x.eqNode(y).notNode());
+  ASSERT_TRUE(ls.solve(lits, 10000));
+  BitVector xv = getValue(ls, x);
+  BitVector yv = getValue(ls, y);
+  ASSERT_EQ(xv.extract(7, 4), BitVector(4, 5u));
+  ASSERT_EQ(xv & yv, BitVector(8, 3u));
+  ASSERT_TRUE(yv.signedLessThan(BitVector(8, 0u)));
+  ASSERT_NE(xv, yv);
+}
+
+TEST_F(TestTheoryWhiteBvLocalSearch, unsat)
+{
+  BVLocalSearch ls(d_slvEngine->getEnv());
+  TypeNode bv4 = d_nodeManager->mkBitVectorType(4);
+  Node x = d_nodeManager->mkVar("x", bv4);
+  std::vector<Node> lits;
+  lits.push_back(d_nodeManager->mkNode(Kind::BITVECTOR_ULT, x, mkConst(4, 2)));
+  lits.push_back(d_nodeManager->mkNode(Kind::BITVECTOR_ULT, mkConst(4, 5), x));
+  ASSERT_FALSE(ls.solve(lits, 100));
+  ASSERT_TRUE(ls.getValue(x).isNull());
+}
+
+TEST_F(TestTheoryWhiteBvLocalSearch, unsupported)
+{
+  BVLocalSearch ls(d_slvEngine->getEnv());
+  TypeNode bv4 = d_nodeManager->mkBitVectorType(4);
+  Node x = d_nodeManager->mkVar("x", bv4);
+  Node f = d_nodeManager->mkVar(
+      "f", d_nodeManager->mkFunctionType({bv4}, bv4));
+  Node fx = d_nodeManager->mkNode(Kind::APPLY_UF, f, x);
+  std::vector<Node> lits;
+  lits.push_back(fx.eqNode(mkConst(4, 1)));
+  ASSERT_FALSE(ls.solve(lits, 100));
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
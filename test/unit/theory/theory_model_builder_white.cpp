@@ -0,0 +1,79 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of partial models built by the model builder.
+ */
+
+#include "expr/node.h"
+#include "smt/smt_solver.h"
+#include "test_smt.h"
+#include "theory/logic_info.h"
+#include "theory/theory_engine.h"
+#include "theory/theory_model.h"
+#include "util/rational.h"
+#include "util/result.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+
+namespace test {
+
+class TestTheoryWhiteModelBuilder : public TestSmtNoFinishInit
+{
+ protected:
+  void SetUp() override
+  {
+    TestSmtNoFinishInit::SetUp();
+    d_slvEngine->setOption("produce-models", "true");
+    d_slvEngine->setOption("lazy-model-build", "true");
+    d_slvEngine->setLogic(LogicInfo("QF_UFLIA"));
+    d_slvEngine->finishInit();
+  }
+};
+
+TEST_F(TestTheoryWhiteModelBuilder, partial_model)
+{
+  NodeManager* nm = d_nodeManager.get();
+  TypeNode intType = nm->integerType();
+  TypeNode u = nm->mkSort("U");
+  Node y = nm->mkVar("y", intType);
+  Node a = nm->mkVar("a", u);
+  Node b = nm->mkVar("b", u);
+  Node c = nm->mkVar("c", u);
+  Node d = nm->mkVar("d", u);
+  Node g = nm->mkVar("g", nm->mkFunctionType(u, intType));
+  Node ga = nm->mkNode(Kind::APPLY_UF, g, a);
+  Node gb = nm->mkNode(Kind::APPLY_UF, g, b);
+  Node two = nm->mkConstInt(Rational(2));
+  d_slvEngine->assertFormula(nm->mkNode(Kind::GT, y, nm->mkConstInt(5)));
+  d_slvEngine->assertFormula(nm->mkNode(Kind::LT, y, nm->mkConstInt(7)));
+  d_slvEngine->assertFormula(ga.eqNode(two));
+  d_slvEngine->assertFormula(gb.eqNode(nm->mkConstInt(Rational(4))));
+  d_slvEngine->assertFormula(c.eqNode(d).notNode());
+  ASSERT_EQ(d_slvEngine->checkSat().getStatus(), Result::SAT);
+
+  TheoryModel* m = d_slvEngine->d_smtSolver->getTheoryEngine()->getModel();
+  ASSERT_EQ(d_slvEngine->getValue(y), nm->mkConstInt(Rational(6)));
+  // only arithmetic collected its model information
+  ASSERT_FALSE(m->hasTerm(c));
+
+  ASSERT_EQ(d_slvEngine->getValue(ga), two);
+  ASSERT_EQ(m->getRepresentative(ga), two);
+  // c is in the model, but not in the cone of (g a), hence it has no value
+  ASSERT_TRUE(m->hasTerm(c));
+  ASSERT_FALSE(m->getRepresentative(c).isConst());
+
+  // a full model assigns a value to c
+  ASSERT_TRUE(d_slvEngine->d_smtSolver->getTheoryEngine()->buildModel());
+  ASSERT_TRUE(m->getRepresentative(c).isConst());
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::String.
+ */
+
+#include <string>
+
+#include "test.h"
+#include "util/string.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestUtilBlackString : public TestInternal
+{
+ protected:
+  /** A string of length n over "ab" that ends with suffix */
+  static String mkLong(size_t n, const std::string& suffix)
+  {
+    std::string s;
+    for (size_t i = 0, m = n - suffix.size(); i < m; ++i)
+    {
+      s.push_back(i % 3 == 0 ? 'b' : 'a');
+    }
+    return String(s + suffix);
+  }
+};
+
+TEST_F(TestUtilBlackString, compare)
+{
+  String abc("abc");
+  ASSERT_EQ(abc, String("abc"));
+  ASSERT_LT(String("abb"), abc);
+  ASSERT_GT(String("abd"), abc);
+  ASSERT_LT(String("zz"), abc);
+  ASSERT_TRUE(abc.strncmp(String("abd"), 2));
+  ASSERT_FALSE(abc.strncmp(String("abd"), 3));
+  ASSERT_FALSE(abc.strncmp(String("ab"), 3));
+  ASSERT_TRUE(abc.rstrncmp(String("xbc"), 2));
+  ASSERT_FALSE(abc.rstrncmp(String("xbc"), 3));
+}
+
+TEST_F(TestUtilBlackString, prefix_suffix)
+{
+  String abc("abc");
+  ASSERT_TRUE(abc.hasPrefix(String("ab")));
+  ASSERT_TRUE(abc.hasPrefix(String("")));
+  ASSERT_FALSE(abc.hasPrefix(String("b")));
+  ASSERT_FALSE(abc.hasPrefix(String("abcd")));
+  ASSERT_TRUE(abc.hasSuffix(String("bc")));
+  ASSERT_FALSE(abc.hasSuffix(String("ab")));
+  ASSERT_EQ(abc.substr(1), String("bc"));
+  ASSERT_EQ(abc.substr(1, 1), String("b"));
+  ASSERT_EQ(abc.concat(String("de")), String("abcde"));
+}
+
+TEST_F(TestUtilBlackString, overlap)
+{
+  String x("abcdef");
+  ASSERT_EQ(x.overlap(String("defg")), 3u);
+  ASSERT_EQ(x.overlap(String("ab")), 0u);
+  ASSERT_EQ(x.overlap(String("bcdefdef")), 5u);
+  ASSERT_EQ(x.roverlap(String("aaabc")), 3u);
+  ASSERT_EQ(x.roverlap(String("def")), 0u);
+  ASSERT_EQ(x.roverlap(String("defabcde")), 5u);
+}
+
+TEST_F(TestUtilBlackString, find)
+{
+  String x("abcabc");
+  ASSERT_EQ(x.find(String("bc")), 1u);
+  ASSERT_EQ(x.find(String("bc"), 2), 4u);
+  ASSERT_EQ(x.find(String("cb")), std::string::npos);
+  ASSERT_EQ(x.rfind(String("ab")), 1u);
+  ASSERT_EQ(x.rfind(String("ab"), 3), 4u);
+  // long texts and patterns use a different search
+  String l = mkLong(1000, "abcd");
+  ASSERT_EQ(l.find(String("abcd")), 996u);
+  ASSERT_EQ(l.find(String("abcd"), 996), 996u);
+  ASSERT_EQ(l.find(String("abce")), std::string::npos);
+  ASSERT_EQ(l.find(String("baab")), 0u);
+  ASSERT_EQ(l.find(String("baab"), 1), 3u);
+  ASSERT_EQ(l.rfind(String("abcd")), 0u);
+  ASSERT_EQ(l.rfind(String("dcba")), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2026 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::internal::TraceEventRecorder.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "test.h"
+#include "util/trace_events.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestUtilBlackTraceEvents : public TestInternal
+{
+ protected:
+  void SetUp() override
+  {
+    d_file = (std::filesystem::temp_directory_path()
+              / "cvc5_trace_events_black.json")
+                 .string();
+  }
+  void TearDown() override { std::filesystem::remove(d_file); }
+  std::string d_file;
+};
+
+TEST_F(TestUtilBlackTraceEvents, write)
+{
+  std::stringstream ss;
+  {
+    TraceEventRecorder rec(d_file, 10);
+    {
+      TraceEventScope scope(&rec, "theory", "THEORY_UF", "effort", "full");
+    }
+    rec.instant("sat", "restart");
+    {
+      TraceEventScope scope(&rec, "preprocess", std::string("a\"b"));
+    }
+    rec.write(ss);
+  }
+  std::string s = ss.str();
+  ASSERT_NE(s.find("{\"name\":\"THEORY_UF\",\"cat\":\"theory\",\"ph\":\"X\""),
+            std::string::npos);
+  ASSERT_NE(s.find("\"args\":{\"effort\":\"full\"}"), std::string::npos);
+  ASSERT_NE(s.find("{\"name\":\"restart\",\"cat\":\"sat\",\"ph\":\"i\""),
+            std::string::npos);
+  ASSERT_NE(s.find("\"name\":\"a\\\"b\""), std::string::npos);
+  ASSERT_NE(s.find("\"droppedEvents\":0"), std::string::npos);
+  // the trace is written to the file on destruction
+  std::ifstream in(d_file);
+  std::stringstream fs;
+  fs << in.rdbuf();
+  ASSERT_EQ(fs.str(), s);
+}
+
+TEST_F(TestUtilBlackTraceEvents, ringBuffer)
+{
+  TraceEventRecorder rec(d_file, 2);
+  rec.instant("sat", "e1");
+  rec.instant("sat", "e2");
+  rec.instant("sat", "e3");
+  std::stringstream ss;
+  rec.write(ss);
+  std::string s = ss.str();
+  ASSERT_EQ(s.find("\"e1\""), std::string::npos);
+  size_t e2 = s.find("\"e2\"");
+  size_t e3 = s.find("\"e3\"");
+  ASSERT_NE(e2, std::string::npos);
+  ASSERT_NE(e3, std::string::npos);
+  // the oldest kept event comes first
+  ASSERT_LT(e2, e3);
+  ASSERT_NE(s.find("\"droppedEvents\":1"), std::string::npos);
+}
+
+TEST_F(TestUtilBlackTraceEvents, flush)
+{
+  TraceEventRecorder rec(d_file, 10);
+  rec.instant("sat", "restart", "arg", "a\nb");
+  {
+    TraceEventScope scope(&rec, "cnf", "convert");
+  }
+  std::stringstream ss;
+  rec.write(ss);
+  // both flushes overwrite the file with the current trace
+  rec.flush();
+  rec.flushSafe();
+  std::ifstream in(d_file);
+  std::stringstream fs;
+  fs << in.rdbuf();
+  ASSERT_EQ(fs.str(), ss.str());
+  ASSERT_NE(fs.str().find("\"arg\":\"a\\u000ab\""), std::string::npos);
+}
+
+TEST_F(TestUtilBlackTraceEvents, disabled)
+{
+  // scopes with a null recorder do nothing
+  TraceEventScope scope(nullptr, "preprocess", std::string("pass"));
+}
+
+}  // namespace test
+}  // namespace cvc5::internal